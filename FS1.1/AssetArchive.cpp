@@ -0,0 +1,158 @@
+#include "AssetArchive.h"
+#include "AssetArchiveFormat.h"
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace AssetArchiveFormat;
+
+//=== DESTRUCTOR ===
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+//=== ARCHIVE MAPPING ===
+// Maps the archive read-only and indexes its entries
+// Validates the header and every entry range before exposing any data
+bool AssetArchive::open(const string& path) {
+    close();
+
+    //=== PLATFORM MAPPING ===
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    FILETIME writeTime;
+    if (GetFileTime(file, nullptr, nullptr, &writeTime)) {
+        stamp = (static_cast<uint64_t>(writeTime.dwHighDateTime) << 32) | writeTime.dwLowDateTime;
+    }
+
+    fileHandle = file;
+    mappingHandle = mapping;
+    mappedData = static_cast<const unsigned char*>(view);
+    mappedSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping keeps its own reference to the file
+    if (view == MAP_FAILED) {
+        return false;
+    }
+
+    mappedData = static_cast<const unsigned char*>(view);
+    mappedSize = static_cast<size_t>(info.st_size);
+    stamp = static_cast<uint64_t>(info.st_mtime) * 1000000000ull + static_cast<uint64_t>(info.st_mtim.tv_nsec);
+#endif
+
+    //=== HEADER VALIDATION ===
+    ArchiveHeader header;
+    if (mappedSize < sizeof(header)) {
+        cerr << "Asset archive " << path << " is truncated" << endl;
+        close();
+        return false;
+    }
+    memcpy(&header, mappedData, sizeof(header));
+
+    uint64_t indexEnd = sizeof(header) + static_cast<uint64_t>(header.entryCount) * sizeof(ArchiveEntry);
+    // Range checks never add two header values: a corrupt size must not wrap around past the end
+    if (header.magic != Magic || header.version != Version || indexEnd > mappedSize ||
+        header.nameTableOffset > mappedSize || header.nameTableSize > mappedSize - header.nameTableOffset) {
+        cerr << "Asset archive " << path << " has an invalid header" << endl;
+        close();
+        return false;
+    }
+
+    //=== INDEX CONSTRUCTION ===
+    const char* names = reinterpret_cast<const char*>(mappedData + header.nameTableOffset);
+    index.reserve(header.entryCount);
+
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        ArchiveEntry entry;
+        memcpy(&entry, mappedData + sizeof(header) + i * sizeof(ArchiveEntry), sizeof(entry));
+
+        // Reject entries pointing outside the mapping
+        if (entry.dataOffset > mappedSize || entry.dataSize > mappedSize - entry.dataOffset ||
+            static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > header.nameTableSize) {
+            cerr << "Asset archive " << path << " has a corrupt entry (" << i << ")" << endl;
+            close();
+            return false;
+        }
+
+        string name(names + entry.nameOffset, entry.nameLength);
+        index[name] = AssetView{ mappedData + entry.dataOffset, static_cast<size_t>(entry.dataSize) };
+    }
+
+    cout << "Mapped asset archive " << path << ": " << index.size() << " assets, "
+         << mappedSize / 1024 << " KB" << endl;
+    return true;
+}
+
+void AssetArchive::close() {
+    index.clear();
+
+#ifdef _WIN32
+    if (mappedData) UnmapViewOfFile(mappedData);
+    if (mappingHandle) CloseHandle(static_cast<HANDLE>(mappingHandle));
+    if (fileHandle) CloseHandle(static_cast<HANDLE>(fileHandle));
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    if (mappedData) munmap(const_cast<unsigned char*>(mappedData), mappedSize);
+#endif
+
+    mappedData = nullptr;
+    mappedSize = 0;
+    stamp = 0;
+}
+
+//=== LOOKUP SYSTEM ===
+AssetView AssetArchive::find(const string& path) const {
+    if (index.empty()) {
+        return AssetView();
+    }
+    auto it = index.find(normalizePath(path));
+    return it != index.end() ? it->second : AssetView();
+}
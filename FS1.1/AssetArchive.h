@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+//=== ASSET VIEW ===
+// Read-only window into a file stored in the mapped archive
+// The bytes stay valid for as long as the archive remains open
+struct AssetView {
+    const void* data = nullptr;     // First byte of the asset inside the mapping
+    size_t size = 0;                // Asset size in bytes
+
+    explicit operator bool() const { return data != nullptr; }
+};
+
+//=== ASSET ARCHIVE CLASS DECLARATION ===
+// Runtime reader for the packed asset archive produced by Tools/AssetPacker
+// - The whole archive is memory-mapped once at startup (single file open)
+// - Lookups return pointers into the mapping; callers pass them directly to
+//   loadFromMemory/openFromMemory without copying
+// - Music can stream straight out of the mapped pages via Music::openFromMemory
+// When no archive is present every lookup fails and callers fall back to loose files
+class AssetArchive {
+public:
+    AssetArchive() = default;
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    //=== ARCHIVE MAPPING ===
+    // Map the archive file and build the lookup index
+    // Returns: false if the file is missing or not a valid archive (archive stays closed)
+    bool open(const string& path);
+
+    // Unmap the archive; previously returned views become invalid
+    void close();
+
+    bool isOpen() const { return mappedData != nullptr; }
+
+    //=== LOOKUP SYSTEM ===
+    // Find an asset by its game-relative path (e.g. "Images/Cars.png")
+    // Returns: empty view if the archive is closed or does not contain the path
+    AssetView find(const string& path) const;
+
+    size_t getEntryCount() const { return index.size(); }
+    size_t getMappedSize() const { return mappedSize; }
+
+    // Last write time of the mapped file (platform units; 0 while closed)
+    uint64_t getStamp() const { return stamp; }
+    // Position of a view returned by find() inside the archive
+    uint64_t getOffset(const AssetView& view) const { return static_cast<const unsigned char*>(view.data) - mappedData; }
+
+private:
+    const unsigned char* mappedData = nullptr;      // Start of the read-only mapping
+    size_t mappedSize = 0;                          // Size of the mapping in bytes
+    uint64_t stamp = 0;                             // Archive write time when it was opened
+    unordered_map<string, AssetView> index;         // Normalized path -> asset bytes
+
+#ifdef _WIN32
+    void* fileHandle = nullptr;                     // HANDLE of the archive file
+    void* mappingHandle = nullptr;                  // HANDLE of the file mapping object
+#endif
+};
+
+//=== GLOBAL INSTANCE DECLARATION ===
+// Defined in: FS1.1.cpp (before resources, so the mapping outlives every asset using it)
+extern AssetArchive assetArchive;
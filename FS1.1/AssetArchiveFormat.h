@@ -0,0 +1,52 @@
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <string>
+
+//=== ASSET ARCHIVE FILE FORMAT ===
+// Shared by the runtime reader (AssetArchive) and the build-time packer (Tools/AssetPacker)
+// Keep this header free of SFML and platform dependencies
+//
+// File layout (all integers little-endian):
+//   ArchiveHeader                    - fixed size, at offset 0
+//   ArchiveEntry[entryCount]         - index, sorted by normalized name
+//   char names[nameTableSize]        - name table referenced by ArchiveEntry::nameOffset
+//   data blobs                       - each aligned to ArchiveDataAlignment bytes
+//
+// Data blobs are stored uncompressed so they can be handed straight from the
+// memory-mapped file to SFML's loadFromMemory/openFromMemory functions
+
+namespace AssetArchiveFormat {
+    constexpr uint32_t Magic = 0x4B505346u;    // "FSPK" read as little-endian uint32
+    constexpr uint32_t Version = 1;
+    constexpr uint64_t DataAlignment = 64;     // Cache-line aligned blobs
+
+    struct ArchiveHeader {
+        uint32_t magic;             // Must equal Magic
+        uint32_t version;           // Must equal Version
+        uint32_t entryCount;        // Number of ArchiveEntry records following the header
+        uint32_t reserved;          // Padding (zero)
+        uint64_t nameTableOffset;   // Absolute offset of the name table
+        uint64_t nameTableSize;     // Size of the name table in bytes
+    };
+
+    struct ArchiveEntry {
+        uint64_t dataOffset;        // Absolute offset of the asset bytes
+        uint64_t dataSize;          // Size of the asset in bytes
+        uint32_t nameOffset;        // Offset of the name inside the name table
+        uint32_t nameLength;        // Length of the name (not null-terminated)
+    };
+
+    // Converts a game-relative path to its archive key
+    // Lowercase with forward slashes, so "ARIAL.TTF" and "arial.ttf" match like on Windows
+    inline std::string normalizePath(std::string path) {
+        std::replace(path.begin(), path.end(), '\\', '/');
+        std::transform(path.begin(), path.end(), path.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (path.rfind("./", 0) == 0) {
+            path.erase(0, 2);
+        }
+        return path;
+    }
+}
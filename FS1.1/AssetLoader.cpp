@@ -0,0 +1,177 @@
+#include "AssetLoader.h"
+#include "DecodeCache.h"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+using namespace sf;
+using namespace std;
+
+//=== DESTRUCTOR ===
+// Joins any running workers, then drops the loader's references to its assets
+AssetLoader::~AssetLoader() {
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    for (auto& handle : textureHandles) resources.release(handle);
+    for (auto& handle : soundBufferHandles) resources.release(handle);
+}
+
+//=== JOB REGISTRATION ===
+
+void AssetLoader::addTexture(const string& path) {
+    auto job = make_unique<Job>();
+    job->type = Job::Type::Texture;
+    job->path = path;
+    jobs.push_back(std::move(job));
+}
+
+void AssetLoader::addSoundBuffer(const string& path) {
+    auto job = make_unique<Job>();
+    job->type = Job::Type::SoundBuffer;
+    job->path = path;
+    jobs.push_back(std::move(job));
+}
+
+void AssetLoader::addAtlasImage(const string& path) {
+    auto job = make_unique<Job>();
+    job->type = Job::Type::AtlasImage;
+    job->path = path;
+    jobs.push_back(std::move(job));
+    atlasPending++;
+}
+
+//=== EXECUTION SYSTEM ===
+
+// Starts the decoder threads; the largest asset bounds the total wall-clock time
+void AssetLoader::start() {
+    if (started) {
+        return;
+    }
+    started = true;
+    if (jobs.empty()) {
+        return;
+    }
+
+    size_t threadCount = max(1u, thread::hardware_concurrency());
+    threadCount = min(threadCount, jobs.size());
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&AssetLoader::workerLoop, this);
+    }
+}
+
+// Worker thread: decode files into CPU memory only (no GPU or audio device access)
+void AssetLoader::workerLoop() {
+    while (true) {
+        size_t index = nextJob.fetch_add(1);
+        if (index >= jobs.size()) {
+            return;  // Queue exhausted
+        }
+
+        // Cache hits only decompress; misses decode the (archived or loose) source once
+        Job& job = *jobs[index];
+        if (job.type == Job::Type::SoundBuffer) {
+            job.buffer = make_unique<SoundBuffer>();
+            job.succeeded = decodeCache.loadSoundBuffer(job.path, *job.buffer);
+        } else {
+            job.succeeded = decodeCache.loadImage(job.path, job.image);
+        }
+        job.decoded.store(true, memory_order_release);  // Publish results to main thread
+
+        // The last atlas image packs them all (the others are decoded: acq_rel orders them)
+        if (job.type == Job::Type::AtlasImage && atlasPending.fetch_sub(1, memory_order_acq_rel) == 1) {
+            packAtlas();
+        }
+    }
+}
+
+void AssetLoader::packAtlas() {
+    vector<AtlasImage> images;
+    for (auto& jobPtr : jobs) {
+        if (jobPtr->type == Job::Type::AtlasImage && jobPtr->succeeded) {
+            images.push_back({ jobPtr->path, &jobPtr->image });
+        }
+    }
+    atlasPacking = textureAtlas.pack(images);
+    atlasPacked.store(true, memory_order_release);
+}
+
+// Main thread: upload decoded images and adopt decoded sound buffers
+size_t AssetLoader::update() {
+    size_t completedNow = 0;
+
+    //=== ATLAS PAGES ===
+    // Atlas images complete together, once their pages are uploaded
+    if (atlasPacked.exchange(false, memory_order_acquire)) {
+        for (TextureHandle& page : textureAtlas.upload(atlasPacking)) {
+            textureHandles.push_back(page);
+        }
+        atlasPacking = AtlasPacking();
+        for (auto& jobPtr : jobs) {
+            Job& job = *jobPtr;
+            if (job.type != Job::Type::AtlasImage) continue;
+            if (!job.succeeded) {
+                cerr << "Failed to load " << job.path << endl;
+            }
+            job.image = Image();
+            job.registered = true;
+            completedNow++;
+        }
+    }
+
+    for (auto& jobPtr : jobs) {
+        Job& job = *jobPtr;
+        if (job.registered || job.type == Job::Type::AtlasImage || !job.decoded.load(memory_order_acquire)) {
+            continue;
+        }
+
+        if (!job.succeeded) {
+            cerr << "Failed to load " << job.path << endl;
+        } else if (job.type == Job::Type::Texture) {
+            textureHandles.push_back(resources.adoptTexture(job.path, job.image));
+            job.image = Image();  // Pixels now live on the GPU
+        } else {
+            soundBufferHandles.push_back(resources.adoptSoundBuffer(job.path, std::move(job.buffer)));
+        }
+
+        job.registered = true;
+        completedNow++;
+    }
+
+    completedJobs += completedNow;
+
+    // All jobs registered - workers have nothing left to do
+    if (isFinished()) {
+        for (auto& worker : workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        workers.clear();
+    }
+    return completedNow;
+}
+
+// Only joins: the workers claimed every job once start() ran, so they all end on their own
+void AssetLoader::finish() {
+    assert(started && "AssetLoader::finish() called before start()");
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers.clear();
+    update();
+}
+
+//=== PROGRESS QUERIES ===
+
+float AssetLoader::getProgress() const {
+    if (jobs.empty()) {
+        return 1.0f;
+    }
+    return static_cast<float>(completedJobs) / static_cast<float>(jobs.size());
+}
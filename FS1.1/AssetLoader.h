@@ -0,0 +1,88 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ResourceManager.h"
+#include "TextureAtlas.h"
+
+using namespace sf;
+using namespace std;
+
+//=== ASSET LOADER CLASS DECLARATION ===
+// Decodes a batch of images and sound buffers concurrently on worker threads
+// - Workers only do CPU work (JPEG/PNG/OGG decoding into memory)
+// - GPU uploads and registration with the ResourceManager stay on the main thread
+//   and happen incrementally in update(), so a progress screen can keep rendering
+// - Atlas images are decoded like textures, then packed into textureAtlas pages by the
+//   worker that decodes the last one; update() only uploads the finished pages
+// - The loader holds one reference to every asset it loaded (atlas pages included) until
+//   it is destroyed, keeping preloaded assets resident for states that acquire them later
+class AssetLoader {
+public:
+    AssetLoader() = default;
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    //=== JOB REGISTRATION ===
+    // Queue assets for loading (must be called before start())
+    void addTexture(const string& path);
+    void addSoundBuffer(const string& path);
+    void addAtlasImage(const string& path);     // Region in textureAtlas (see TextureAtlas.h)
+
+    //=== EXECUTION SYSTEM ===
+    // Spawn worker threads (one per hardware thread, capped to the job count)
+    // Only the first call starts anything; jobs cannot be added afterwards
+    void start();
+
+    // Main thread: register every job whose decode has finished since the last call
+    // Returns: number of jobs completed during this call
+    size_t update();
+
+    //=== PROGRESS QUERIES ===
+    float getProgress() const;   // Completed fraction in range 0.0f - 1.0f
+    bool isFinished() const { return completedJobs == jobs.size(); }
+    size_t getJobCount() const { return jobs.size(); }
+    size_t getCompletedCount() const { return completedJobs; }
+
+    // Wait for all workers and register the remaining jobs (blocking)
+    // The loader must have been started: finish() never spawns workers itself
+    void finish();
+
+private:
+    //=== JOB STRUCTURE ===
+    // One asset to decode; filled in by a worker, consumed by update()
+    struct Job {
+        enum class Type { Texture, SoundBuffer, AtlasImage };
+        Type type;
+        string path;
+        Image image;                        // Decoded pixels (texture and atlas jobs)
+        unique_ptr<SoundBuffer> buffer;     // Decoded samples (sound jobs)
+        bool succeeded = false;             // Decode result
+        atomic<bool> decoded{ false };      // Set by the worker when the job is done
+        bool registered = false;            // Set by update() after upload/adoption
+    };
+
+    vector<unique_ptr<Job>> jobs;           // Pointers keep Job addresses stable
+    vector<thread> workers;                 // Decoder threads
+    atomic<size_t> nextJob{ 0 };            // Next job index to claim
+    bool started = false;                   // start() ran (workers spawned if there were jobs)
+    size_t completedJobs = 0;               // Jobs registered on the main thread
+
+    atomic<size_t> atlasPending{ 0 };       // Atlas images not decoded yet
+    AtlasPacking atlasPacking;              // Written by the worker that packs the atlas
+    atomic<bool> atlasPacked{ false };      // Publishes atlasPacking to the main thread
+
+    vector<TextureHandle> textureHandles;           // References held by the loader
+    vector<SoundBufferHandle> soundBufferHandles;
+
+    // Worker thread body: claim jobs until the queue is exhausted
+    void workerLoop();
+    // Worker thread: pack every decoded atlas image (called once, after the last decode)
+    void packAtlas();
+};
@@ -0,0 +1,233 @@
+#include "AudioSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <tuple>
+
+using namespace sf;
+using namespace std;
+
+//=== DESTRUCTOR ===
+AudioSystem::~AudioSystem() {
+    shutdown();
+}
+
+//=== THREAD LIFECYCLE ===
+
+void AudioSystem::start() {
+    if (running.load()) return;
+    batch.reserve(QueueCapacity);
+    parameterOrder.reserve(QueueCapacity);
+    running.store(true);
+    worker = thread(&AudioSystem::run, this);
+}
+
+void AudioSystem::shutdown() {
+    if (!running.load()) return;
+    running.store(false);
+    worker.join();  // run() applies the final batch before returning
+}
+
+void AudioSystem::flush() {
+    if (!running.load()) return;  // Nothing is queued: commands were applied on post
+    while (completedCommands.load(memory_order_acquire) < postedCommands) {
+        this_thread::yield();     // At most one control period
+    }
+}
+
+//=== COMMAND POSTING (main thread) ===
+
+void AudioSystem::post(const Command& command) {
+    if (!running.load()) {
+        apply(command);
+        return;
+    }
+    if (!queue.push(command)) {
+        droppedCommands++;
+        return;
+    }
+    postedCommands++;
+}
+
+void AudioSystem::play(SoundSource& source) {
+    Command command;
+    command.type = CommandType::Play;
+    command.source = &source;
+    post(command);
+}
+
+void AudioSystem::stop(SoundSource& source) {
+    Command command;
+    command.type = CommandType::Stop;
+    command.source = &source;
+    post(command);
+}
+
+void AudioSystem::restart(SoundSource& source) {
+    Command command;
+    command.type = CommandType::Restart;
+    command.source = &source;
+    post(command);
+}
+
+void AudioSystem::setVolume(SoundSource& source, float volume) {
+    Command command;
+    command.type = CommandType::SetVolume;
+    command.source = &source;
+    command.value = volume;
+    post(command);
+}
+
+void AudioSystem::setPitch(SoundSource& source, float pitch) {
+    Command command;
+    command.type = CommandType::SetPitch;
+    command.source = &source;
+    command.value = pitch;
+    post(command);
+}
+
+void AudioSystem::setVoice(EngineMixer& mixer, EngineMixer::VoiceId voice, float gain, float pitch) {
+    Command command;
+    command.type = CommandType::SetVoice;
+    command.mixer = &mixer;
+    command.voice = voice;
+    command.value = gain;
+    command.value2 = pitch;
+    post(command);
+}
+
+void AudioSystem::startVoice(EngineMixer& mixer, EngineMixer::VoiceId voice, float startPhase) {
+    Command command;
+    command.type = CommandType::StartVoice;
+    command.mixer = &mixer;
+    command.voice = voice;
+    command.value = startPhase;
+    post(command);
+}
+
+void AudioSystem::stopVoice(EngineMixer& mixer, EngineMixer::VoiceId voice) {
+    Command command;
+    command.type = CommandType::StopVoice;
+    command.mixer = &mixer;
+    command.voice = voice;
+    post(command);
+}
+
+void AudioSystem::stopAllVoices(EngineMixer& mixer) {
+    Command command;
+    command.type = CommandType::StopAllVoices;
+    command.mixer = &mixer;
+    post(command);
+}
+
+//=== AUDIO THREAD ===
+
+void AudioSystem::run() {
+    const auto period = chrono::microseconds(1000000 / ControlRate);
+    auto nextTick = chrono::steady_clock::now();
+    while (running.load()) {
+        processBatch();
+
+        // Fixed control rate; after a stall, resume from now instead of catching up in a burst
+        nextTick += period;
+        auto now = chrono::steady_clock::now();
+        if (nextTick < now) {
+            nextTick = now;
+        }
+        this_thread::sleep_until(nextTick);
+    }
+    processBatch();  // Everything posted before shutdown()
+}
+
+// Drain the queue, drop redundant parameter sets, then apply the rest in posting order
+void AudioSystem::processBatch() {
+    batch.clear();
+    Command command;
+    while (batch.size() < QueueCapacity && queue.pop(command)) {
+        batch.push_back(command);
+    }
+    if (batch.empty()) return;
+
+    //=== COALESCING ===
+    // Group parameter commands by (target, voice, type); only the last of each group survives
+    parameterOrder.clear();
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (isParameter(batch[i].type)) {
+            parameterOrder.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    auto keyOf = [this](uint32_t index) {
+        const Command& c = batch[index];
+        return make_tuple(reinterpret_cast<uintptr_t>(getTarget(c)), c.voice, c.type, index);  // Index keeps posting order
+    };
+    sort(parameterOrder.begin(), parameterOrder.end(),
+        [&](uint32_t a, uint32_t b) { return keyOf(a) < keyOf(b); });
+    for (size_t k = 0; k + 1 < parameterOrder.size(); ++k) {
+        const Command& current = batch[parameterOrder[k]];
+        const Command& next = batch[parameterOrder[k + 1]];
+        if (getTarget(current) == getTarget(next) && current.voice == next.voice && current.type == next.type) {
+            batch[parameterOrder[k]].superseded = true;
+        }
+    }
+
+    //=== APPLICATION ===
+    for (const Command& queued : batch) {
+        if (queued.superseded) {
+            coalescedCommands++;
+        } else {
+            apply(queued);
+        }
+    }
+    completedCommands.fetch_add(batch.size(), memory_order_release);
+}
+
+// Issue one command to the backend (audio thread, or the caller while the thread is stopped)
+void AudioSystem::apply(const Command& command) {
+    switch (command.type) {
+    case CommandType::Play:
+        command.source->play();
+        break;
+    case CommandType::Stop:
+        command.source->stop();
+        break;
+    case CommandType::Restart:
+        command.source->stop();
+        command.source->play();
+        break;
+    case CommandType::SetVolume:
+        if (command.source->getVolume() == command.value) {
+            coalescedCommands++;  // Already at this volume (e.g. the per-frame UI volume sync)
+            return;
+        }
+        command.source->setVolume(command.value);
+        break;
+    case CommandType::SetPitch:
+        if (command.source->getPitch() == command.value) {
+            coalescedCommands++;
+            return;
+        }
+        command.source->setPitch(command.value);
+        break;
+    case CommandType::SetVoice:
+        command.mixer->setVoice(command.voice, command.value, command.value2);
+        break;
+    case CommandType::StartVoice:
+        command.mixer->startVoice(command.voice, command.value);
+        break;
+    case CommandType::StopVoice:
+        command.mixer->stopVoice(command.voice);
+        break;
+    case CommandType::StopAllVoices:
+        command.mixer->stopAllVoices();
+        break;
+    }
+    appliedCommands++;
+}
+
+bool AudioSystem::isParameter(CommandType type) {
+    return type == CommandType::SetVolume || type == CommandType::SetPitch || type == CommandType::SetVoice;
+}
+
+const void* AudioSystem::getTarget(const Command& command) {
+    if (command.mixer) return command.mixer;
+    return command.source;
+}
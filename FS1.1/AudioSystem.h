@@ -0,0 +1,110 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "EngineMixer.h"
+#include "SpscQueue.h"
+
+using namespace sf;
+using namespace std;
+
+//=== AUDIO SYSTEM CLASS DECLARATION ===
+// Owns the audio control thread; gameplay code never calls into the audio backend directly
+// - Every play/stop/volume/pitch/voice request is posted as a small command into a
+//   single-producer/single-consumer lock-free queue (the main thread is the only producer)
+// - The audio thread drains the queue at a fixed control rate and applies the batch:
+//   parameter sets superseded later in the same batch, or equal to the current value, are
+//   dropped without touching the backend
+// - Posting never blocks; if the queue is ever full the command is dropped and counted
+// Targets are referenced by address: they must stay alive until flush() returns (or the
+// system is shut down) after the last command that names them
+class AudioSystem {
+public:
+    static constexpr unsigned int ControlRate = 200;   // Command batches applied per second
+
+    AudioSystem() = default;
+    ~AudioSystem();
+
+    AudioSystem(const AudioSystem&) = delete;
+    AudioSystem& operator=(const AudioSystem&) = delete;
+
+    //=== THREAD LIFECYCLE ===
+    // Commands posted before start() or after shutdown() are applied immediately on the caller
+    void start();
+    void shutdown();   // Applies everything still queued, then joins the thread
+
+    // Block until every command posted so far has been applied
+    // Used before a target is destroyed or reconfigured (level unload), never per frame
+    void flush();
+
+    //=== SOURCE COMMANDS (Sound, MusicPlayer, EngineMixer) ===
+    void play(SoundSource& source);
+    void stop(SoundSource& source);
+    void restart(SoundSource& source);                 // Stop, then play from the start
+    void setVolume(SoundSource& source, float volume);  // 0.0f-100.0f
+    void setPitch(SoundSource& source, float pitch);
+
+    //=== ENGINE MIXER VOICE COMMANDS ===
+    void setVoice(EngineMixer& mixer, EngineMixer::VoiceId voice, float gain, float pitch);
+    void startVoice(EngineMixer& mixer, EngineMixer::VoiceId voice, float startPhase = 0.0f);
+    void stopVoice(EngineMixer& mixer, EngineMixer::VoiceId voice);
+    void stopAllVoices(EngineMixer& mixer);
+
+    //=== STATISTICS ===
+    uint64_t getPostedCount() const { return postedCommands; }              // Main thread only
+    size_t getQueuedCount() const { return queue.size(); }
+    size_t getAppliedCount() const { return appliedCommands.load(); }       // Reached the backend
+    size_t getCoalescedCount() const { return coalescedCommands.load(); }   // Dropped as redundant
+    size_t getDroppedCount() const { return droppedCommands.load(); }       // Lost to a full queue
+
+private:
+    //=== COMMAND STRUCTURE ===
+    enum class CommandType : uint8_t {
+        Play, Stop, Restart, SetVolume, SetPitch,
+        SetVoice, StartVoice, StopVoice, StopAllVoices
+    };
+
+    struct Command {
+        CommandType type = CommandType::Play;
+        SoundSource* source = nullptr;  // Play/Stop/Restart/SetVolume/SetPitch
+        EngineMixer* mixer = nullptr;   // Voice commands
+        EngineMixer::VoiceId voice = EngineMixer::InvalidId;
+        float value = 0.0f;             // Volume, pitch, gain or start phase
+        float value2 = 0.0f;            // Voice pitch
+        bool superseded = false;        // Set while coalescing a batch (audio thread)
+    };
+
+    static constexpr size_t QueueCapacity = 8192;   // Several frames of worst-case Level 3 traffic
+
+    SpscQueue<Command, QueueCapacity> queue;
+    thread worker;
+    atomic<bool> running{ false };
+
+    // Sequence numbers for flush(): commands posted (main thread) and applied (audio thread)
+    uint64_t postedCommands = 0;
+    atomic<uint64_t> completedCommands{ 0 };
+
+    // Audio thread scratch, reused every tick
+    vector<Command> batch;
+    vector<uint32_t> parameterOrder;    // Batch indices of parameter commands, grouped by target
+
+    atomic<size_t> appliedCommands{ 0 };
+    atomic<size_t> coalescedCommands{ 0 };
+    atomic<size_t> droppedCommands{ 0 };
+
+    void post(const Command& command);
+
+    // Audio thread body: drain, coalesce and apply at ControlRate until shut down
+    void run();
+    void processBatch();
+    void apply(const Command& command);
+    static bool isParameter(CommandType type);
+    static const void* getTarget(const Command& command);
+};
+
+//=== GLOBAL INSTANCE DECLARATION ===
+// Defined in FS1.1.cpp after navSounds, so the thread stops before the sounds it drives
+// are destroyed
+extern AudioSystem audio;
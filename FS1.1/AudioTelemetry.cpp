@@ -0,0 +1,164 @@
+#include "AudioTelemetry.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include "AudioSystem.h"
+#include "BenchmarkLog.h"
+
+using namespace sf;
+using namespace std;
+
+//=== SOURCES ===
+// Window baselines restart at the attached counters, so a mixer's history before it was
+// attached is never counted as work done in this window
+
+void AudioTelemetry::attachMusic(const MusicPlayer* player) {
+    music = player;
+    windowMusicBusy = music ? music->getBusyNanoseconds() : 0;
+}
+
+void AudioTelemetry::attachUiSounds(const UiSoundMixer* mixer) {
+    uiSounds = mixer;
+    windowUiBusy = uiSounds ? uiSounds->getBusyNanoseconds() : 0;
+    windowTriggers = uiSounds ? uiSounds->getTriggerCount() : 0;
+}
+
+void AudioTelemetry::attachEngine(const EngineMixer* mixer, const EngineVoicePool* pool) {
+    engineMixer = mixer;
+    enginePool = mixer ? pool : nullptr;
+    windowEngineBusy = engineMixer ? engineMixer->getBusyNanoseconds() : 0;
+}
+
+//=== SAMPLING ===
+
+bool AudioTelemetry::sample(float deltaTime) {
+    elapsed += deltaTime;
+    windowTime += deltaTime;
+    windowFrames++;
+
+    //=== PER-FRAME VALUES ===
+    // Posts are counted on this thread, so each frame's count is exact
+    uint64_t posted = audio.getPostedCount();
+    maxCommands = max(maxCommands, static_cast<size_t>(posted - lastPosted));
+    lastPosted = posted;
+    if (music) {
+        minMusicFill = min(minMusicFill, music->getBufferFill());
+    }
+
+    if (windowTime < WindowSeconds) {
+        return false;
+    }
+    closeWindow();
+    return true;
+}
+
+void AudioTelemetry::closeWindow() {
+    AudioStats next;
+    next.time = elapsed;
+    next.windowSeconds = windowTime;
+    next.frames = windowFrames;
+    float frames = static_cast<float>(max<size_t>(windowFrames, 1));
+    float windowNanoseconds = windowTime * 1e9f;
+
+    //=== AUDIO API CALLS ===
+    uint64_t posted = audio.getPostedCount();
+    size_t applied = audio.getAppliedCount();
+    size_t coalesced = audio.getCoalescedCount();
+    next.commandsPerFrame = (posted - windowPosted) / frames;
+    next.maxCommandsPerFrame = maxCommands;
+    next.appliedPerFrame = (applied - windowApplied) / frames;
+    next.coalescedPerFrame = (coalesced - windowCoalesced) / frames;
+    next.droppedCommands = audio.getDroppedCount();
+    windowPosted = posted;
+    windowApplied = applied;
+    windowCoalesced = coalesced;
+
+    //=== MUSIC STREAM ===
+    if (music) {
+        uint64_t busy = music->getBusyNanoseconds();
+        next.musicBufferFill = minMusicFill;
+        next.musicUnderruns = music->getUnderrunCount();
+        next.musicDecks = music->getPlayingDeckCount();
+        next.musicCpu = (busy - windowMusicBusy) / windowNanoseconds * 100.0f;
+        windowMusicBusy = busy;
+    }
+
+    //=== ENGINE MIXER (Level 3 only) ===
+    next.engineLateChunks = stats.engineLateChunks;  // Kept while no level is attached
+    if (engineMixer) {
+        uint64_t busy = engineMixer->getBusyNanoseconds();
+        next.engineLateChunks = engineMixer->getLateChunkCount();
+        next.engineActiveVoices = engineMixer->getPlayingVoiceCount();
+        next.engineVoiceCapacity = engineMixer->getMaxVoices();
+        next.engineVirtualVoices = enginePool ? enginePool->getVirtualCount() : 0;
+        next.engineCpu = (busy - windowEngineBusy) / windowNanoseconds * 100.0f;
+        windowEngineBusy = busy;
+    }
+
+    //=== UI SOUNDS ===
+    if (uiSounds) {
+        uint64_t busy = uiSounds->getBusyNanoseconds();
+        size_t triggers = uiSounds->getTriggerCount();
+        next.uiActiveVoices = uiSounds->getPlayingVoiceCount();
+        next.uiTriggersPerFrame = (triggers - windowTriggers) / frames;
+        next.uiCpu = (busy - windowUiBusy) / windowNanoseconds * 100.0f;
+        next.uiLatencyAverage = uiSounds->getAverageLatencyMicroseconds() / 1000.0f;
+        next.uiLatencyMax = uiSounds->getMaxLatencyMicroseconds() / 1000.0f;
+        windowUiBusy = busy;
+        windowTriggers = triggers;
+    }
+
+    stats = next;
+    windowTime = 0.0f;
+    windowFrames = 0;
+    minMusicFill = 1.0f;
+    maxCommands = 0;
+}
+
+//=== OUTPUT ===
+
+string AudioTelemetry::formatOverlay() const {
+    ostringstream text;
+    text << fixed << setprecision(1);
+    text << "AUDIO (F3)\n";
+    text << "Music  fill " << stats.musicBufferFill * 100.0f << "%  underruns " << stats.musicUnderruns
+         << "  decks " << stats.musicDecks << "  cpu " << stats.musicCpu << "%\n";
+    text << "Engine voices " << stats.engineActiveVoices << "/" << stats.engineVoiceCapacity
+         << "  virtual " << stats.engineVirtualVoices << "  late " << stats.engineLateChunks
+         << "  cpu " << stats.engineCpu << "%\n";
+    text << "UI     voices " << stats.uiActiveVoices << "  triggers/frame " << stats.uiTriggersPerFrame
+         << "  latency " << stats.uiLatencyAverage << " ms (max " << stats.uiLatencyMax << ")"
+         << "  cpu " << stats.uiCpu << "%\n";
+    text << "Calls  " << stats.commandsPerFrame << "/frame (max " << stats.maxCommandsPerFrame
+         << ")  applied " << stats.appliedPerFrame << "  coalesced " << stats.coalescedPerFrame
+         << "  dropped " << stats.droppedCommands;
+    return text.str();
+}
+
+string AudioTelemetry::toJson() const {
+    ostringstream json;
+    json << fixed << setprecision(3);
+    json << "{\"type\":\"audio\",\"time\":" << jsonNumber(stats.time)
+         << ",\"window\":" << jsonNumber(stats.windowSeconds)
+         << ",\"frames\":" << stats.frames
+         << ",\"music\":{\"fill\":" << jsonNumber(stats.musicBufferFill)
+         << ",\"underruns\":" << stats.musicUnderruns
+         << ",\"decks\":" << stats.musicDecks
+         << ",\"cpu\":" << jsonNumber(stats.musicCpu) << "}"
+         << ",\"engine\":{\"active\":" << stats.engineActiveVoices
+         << ",\"virtual\":" << stats.engineVirtualVoices
+         << ",\"capacity\":" << stats.engineVoiceCapacity
+         << ",\"late\":" << stats.engineLateChunks
+         << ",\"cpu\":" << jsonNumber(stats.engineCpu) << "}"
+         << ",\"ui\":{\"active\":" << stats.uiActiveVoices
+         << ",\"triggers_per_frame\":" << jsonNumber(stats.uiTriggersPerFrame)
+         << ",\"latency_ms\":" << jsonNumber(stats.uiLatencyAverage)
+         << ",\"latency_max_ms\":" << jsonNumber(stats.uiLatencyMax)
+         << ",\"cpu\":" << jsonNumber(stats.uiCpu) << "}"
+         << ",\"calls\":{\"per_frame\":" << jsonNumber(stats.commandsPerFrame)
+         << ",\"max_per_frame\":" << stats.maxCommandsPerFrame
+         << ",\"applied_per_frame\":" << jsonNumber(stats.appliedPerFrame)
+         << ",\"coalesced_per_frame\":" << jsonNumber(stats.coalescedPerFrame)
+         << ",\"dropped\":" << stats.droppedCommands << "}}";
+    return json.str();
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "EngineMixer.h"
+#include "EngineVoicePool.h"
+#include "MusicPlayer.h"
+#include "UiSoundMixer.h"
+
+using namespace sf;
+using namespace std;
+
+//=== AUDIO STATISTICS ===
+// One measurement window of audio health, as shown in the overlay and the benchmark log
+// Totals count since startup; rates and loads cover the window only
+struct AudioStats {
+    double time = 0.0;                  // Seconds since the first sample, at the end of the window
+    float windowSeconds = 0.0f;
+    size_t frames = 0;                  // Game frames in the window
+
+    //=== STREAM HEALTH ===
+    float musicBufferFill = 0.0f;       // Lowest music ring fill seen (1.0f = full target)
+    size_t musicUnderruns = 0;          // Total music chunks padded with silence
+    size_t engineLateChunks = 0;        // Total engine chunks mixed slower than real time
+
+    //=== VOICES (end of window) ===
+    size_t musicDecks = 0;              // Tracks being mixed (2 during a crossfade)
+    size_t engineActiveVoices = 0;      // Engine voices the mixer is playing
+    size_t engineVirtualVoices = 0;     // Audible obstacles without a voice
+    size_t engineVoiceCapacity = 0;     // 0 outside Level 3
+    size_t uiActiveVoices = 0;
+
+    //=== AUDIO API CALLS ===
+    float commandsPerFrame = 0.0f;      // Posted by gameplay code
+    size_t maxCommandsPerFrame = 0;
+    float appliedPerFrame = 0.0f;       // Reached the backend
+    float coalescedPerFrame = 0.0f;     // Dropped as redundant
+    size_t droppedCommands = 0;         // Total lost to a full queue
+    float uiTriggersPerFrame = 0.0f;
+
+    //=== MIXER CPU TIME (percent of one core) ===
+    float musicCpu = 0.0f;
+    float engineCpu = 0.0f;
+    float uiCpu = 0.0f;
+
+    //=== UI SOUND LATENCY (milliseconds, trigger to playing offset, since startup) ===
+    float uiLatencyAverage = 0.0f;
+    float uiLatencyMax = 0.0f;
+};
+
+//=== AUDIO TELEMETRY CLASS DECLARATION ===
+// Collects AudioStats from the audio system and every mixer that is attached to it
+// - sample() runs once per game frame on the main thread; it only reads counters the
+//   mixers already keep, so measuring never takes a lock on any audio thread
+// - Every WindowSeconds the window is closed and published through getStats()
+// - Mixers are attached by their owners and must be detached before they are destroyed
+class AudioTelemetry {
+public:
+    static constexpr float WindowSeconds = 0.5f;
+
+    //=== SOURCES (main thread) ===
+    // nullptr detaches
+    void attachMusic(const MusicPlayer* player);
+    void attachUiSounds(const UiSoundMixer* mixer);
+    void attachEngine(const EngineMixer* mixer, const EngineVoicePool* pool);
+
+    //=== SAMPLING ===
+    // Call once per frame after the frame's audio commands were posted
+    // Returns: true when a window was closed and getStats() changed
+    bool sample(float deltaTime);
+    const AudioStats& getStats() const { return stats; }
+
+    //=== OUTPUT ===
+    string formatOverlay() const;       // Multi-line text for the on-screen overlay
+    string toJson() const;              // One benchmark log record (single line)
+
+private:
+    const MusicPlayer* music = nullptr;
+    const UiSoundMixer* uiSounds = nullptr;
+    const EngineMixer* engineMixer = nullptr;
+    const EngineVoicePool* enginePool = nullptr;
+
+    AudioStats stats;                   // Last closed window
+
+    //=== CURRENT WINDOW ===
+    double elapsed = 0.0;
+    float windowTime = 0.0f;
+    size_t windowFrames = 0;
+    float minMusicFill = 1.0f;
+    size_t maxCommands = 0;
+
+    // Counter values at the start of the window (and the previous frame, for posts)
+    uint64_t lastPosted = 0;
+    uint64_t windowPosted = 0;
+    size_t windowApplied = 0;
+    size_t windowCoalesced = 0;
+    size_t windowTriggers = 0;
+    uint64_t windowMusicBusy = 0;
+    uint64_t windowEngineBusy = 0;
+    uint64_t windowUiBusy = 0;
+
+    void closeWindow();
+};
+
+//=== GLOBAL INSTANCE DECLARATION ===
+// Defined in FS1.1.cpp; attached mixers hold no reference back to it
+extern AudioTelemetry audioTelemetry;
@@ -0,0 +1,24 @@
+#include "BenchmarkLog.h"
+#include <cmath>
+
+using namespace std;
+
+bool BenchmarkLog::open(const string& path) {
+    file.open(path, ios::out | ios::trunc);
+    return file.is_open();
+}
+
+void BenchmarkLog::write(const string& record) {
+    if (!file.is_open()) return;
+    file << record << '\n';
+    file.flush();
+}
+
+ostream& operator<<(ostream& out, JsonNumber number) {
+    if (isfinite(number.value)) {
+        out << number.value;
+    } else {
+        out << "null";
+    }
+    return out;
+}
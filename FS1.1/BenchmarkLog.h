@@ -0,0 +1,44 @@
+#pragma once
+#include <fstream>
+#include <ostream>
+#include <string>
+
+using namespace std;
+
+//=== BENCHMARK LOG CLASS DECLARATION ===
+// Machine-readable measurement output, enabled with the --bench command line option
+// - One JSON object per line (JSON Lines), flushed as it is written so a run that is
+//   closed or killed still leaves complete records
+// - Every record carries a "type" field naming the subsystem that wrote it
+// Main thread only
+class BenchmarkLog {
+public:
+    BenchmarkLog() = default;
+
+    BenchmarkLog(const BenchmarkLog&) = delete;
+    BenchmarkLog& operator=(const BenchmarkLog&) = delete;
+
+    // Returns: false if the file cannot be created (logging stays disabled)
+    bool open(const string& path);
+    bool isOpen() const { return file.is_open(); }
+
+    // Append one record; ignored while no log is open
+    void write(const string& record);
+
+private:
+    ofstream file;
+};
+
+//=== JSON NUMBERS ===
+// Writes a measured value into a record with the stream's formatting
+// Infinity and NaN (a rate over an empty window, a ratio against a zero time) are not valid
+// JSON: they are written as null so every line still parses
+struct JsonNumber {
+    double value;
+};
+inline JsonNumber jsonNumber(double value) { return JsonNumber{ value }; }
+ostream& operator<<(ostream& out, JsonNumber number);
+
+//=== GLOBAL INSTANCE DECLARATION ===
+// Defined in: FS1.1.cpp (opened by main() when --bench is given)
+extern BenchmarkLog benchmarkLog;
@@ -0,0 +1,57 @@
+#include "BenchmarkTable.h"
+#include "BenchmarkLog.h"
+#include <iostream>
+
+using namespace std;
+
+//=== CONSTRUCTOR ===
+BenchmarkRow::BenchmarkRow(const string& type) {
+    row.setf(ios::fixed);
+    record << "{\"type\":\"" << type << "\"";
+}
+
+//=== COLUMNS ===
+
+// Columns are separated by three spaces and right-aligned to their header
+void BenchmarkRow::beginColumn(int width, int precision) {
+    if (!firstColumn) row << "   ";
+    firstColumn = false;
+    row.precision(precision);
+    row.width(width);
+}
+
+void BenchmarkRow::column(const char* key, double value, int width, int precision) {
+    beginColumn(width, precision);
+    row << value;
+    field(key, value);
+}
+
+void BenchmarkRow::column(const char* key, size_t value, int width) {
+    beginColumn(width, 0);
+    row << value;
+    field(key, value);
+}
+
+//=== FIELDS ===
+
+void BenchmarkRow::field(const char* key, double value) {
+    record << ",\"" << key << "\":" << jsonNumber(value);
+}
+
+void BenchmarkRow::field(const char* key, size_t value) {
+    record << ",\"" << key << "\":" << value;
+}
+
+void BenchmarkRow::text(const char* key, const string& value) {
+    record << ",\"" << key << "\":\"" << value << "\"";
+}
+
+void BenchmarkRow::flag(const char* key, bool value) {
+    record << ",\"" << key << "\":" << (value ? "true" : "false");
+}
+
+//=== OUTPUT ===
+void BenchmarkRow::write() {
+    cout << row.str() << endl;
+    benchmarkLog.write(record.str() + "}");
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+//=== REPEAT TIMING ===
+// Runs work until at least 0.2 seconds have passed, so short kernels are averaged over
+// thousands of runs and long ones still finish quickly
+// Returns: seconds per run
+template <typename Work>
+double timeRepeated(Work work) {
+    using Clock = chrono::steady_clock;
+    size_t runs = 0;
+    auto start = Clock::now();
+    auto elapsed = Clock::duration::zero();
+    do {
+        work();
+        runs++;
+        elapsed = Clock::now() - start;
+    } while (elapsed < chrono::milliseconds(200));
+    return chrono::duration<double>(elapsed).count() / runs;
+}
+
+//=== BENCHMARK ROW CLASS DECLARATION ===
+// One measurement of a command line micro-benchmark, written twice:
+// - a console table row (fixed-width columns under a header the benchmark prints itself)
+// - a benchmark log record of the given type (non-finite values become null)
+// Columns appear in both; fields only in the record; note() text only in the row
+class BenchmarkRow {
+public:
+    explicit BenchmarkRow(const string& type);
+
+    BenchmarkRow(const BenchmarkRow&) = delete;
+    BenchmarkRow& operator=(const BenchmarkRow&) = delete;
+
+    //=== COLUMNS (table and record) ===
+    // width: characters of the column (the header's), precision: decimals shown in the table
+    void column(const char* key, double value, int width, int precision = 2);
+    void column(const char* key, size_t value, int width);
+
+    //=== FIELDS (record only) ===
+    void field(const char* key, double value);
+    void field(const char* key, size_t value);
+    void text(const char* key, const string& value);
+    void flag(const char* key, bool value);
+
+    //=== NOTES (table only) ===
+    // Free text after the columns (verdicts, mismatch details)
+    ostream& note() { return row; }
+
+    // Print the row and append the record to benchmarkLog
+    void write();
+
+private:
+    ostringstream row;
+    ostringstream record;
+    bool firstColumn = true;
+
+    void beginColumn(int width, int precision);
+};
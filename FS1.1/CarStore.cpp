@@ -0,0 +1,148 @@
+#include "CarStore.h"
+
+using namespace std;
+
+//=== CONSTRUCTOR ===
+// Every array is reserved up front so spawning within the capacity never allocates
+CarStore::CarStore(size_t capacity) {
+    for (vector<float>* component : { &x, &y, &velocityX, &velocityY, &scroll, &halfWidth, &halfHeight,
+                                      &hitMinX, &hitMinY, &hitMaxX, &hitMaxY, &moveX, &moveY, &soundVolume, &pitchVariation }) {
+        component->reserve(capacity);
+    }
+    audioId.reserve(capacity);
+    kind.reserve(capacity);
+    spriteIndex.reserve(capacity);
+    indexSlots.reserve(capacity);
+    slotIndices.reserve(capacity);
+    slotGenerations.reserve(capacity);
+    freeSlots.reserve(capacity);
+}
+
+//=== LIFETIME ===
+
+CarHandle CarStore::spawn(CarKind carKind, float positionX, float positionY) {
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(slotIndices.size());
+        slotIndices.push_back(0);
+        slotGenerations.push_back(0);
+    }
+    slotIndices[slot] = static_cast<uint32_t>(size());
+    indexSlots.push_back(slot);
+
+    x.push_back(positionX);
+    y.push_back(positionY);
+    velocityX.push_back(0.0f);
+    velocityY.push_back(0.0f);
+    scroll.push_back(0.0f);
+    halfWidth.push_back(0.0f);
+    halfHeight.push_back(0.0f);
+    hitMinX.push_back(positionX);
+    hitMinY.push_back(positionY);
+    hitMaxX.push_back(positionX);
+    hitMaxY.push_back(positionY);
+    moveX.push_back(0.0f);
+    moveY.push_back(0.0f);
+    soundVolume.push_back(1.0f);
+    pitchVariation.push_back(1.0f);
+    audioId.push_back(0);
+    kind.push_back(carKind);
+    spriteIndex.push_back(0);
+    return { slot, slotGenerations[slot] };
+}
+
+void CarStore::despawn(CarHandle handle) {
+    if (isAlive(handle)) {
+        despawnAt(indexOf(handle));
+    }
+}
+
+// Swap-and-pop: the last car takes the freed index, so the arrays stay packed
+void CarStore::despawnAt(size_t index) {
+    size_t last = size() - 1;
+    uint32_t slot = indexSlots[index];
+    if (index != last) {
+        x[index] = x[last];
+        y[index] = y[last];
+        velocityX[index] = velocityX[last];
+        velocityY[index] = velocityY[last];
+        scroll[index] = scroll[last];
+        halfWidth[index] = halfWidth[last];
+        halfHeight[index] = halfHeight[last];
+        hitMinX[index] = hitMinX[last];
+        hitMinY[index] = hitMinY[last];
+        hitMaxX[index] = hitMaxX[last];
+        hitMaxY[index] = hitMaxY[last];
+        moveX[index] = moveX[last];
+        moveY[index] = moveY[last];
+        soundVolume[index] = soundVolume[last];
+        pitchVariation[index] = pitchVariation[last];
+        audioId[index] = audioId[last];
+        kind[index] = kind[last];
+        spriteIndex[index] = spriteIndex[last];
+        indexSlots[index] = indexSlots[last];
+        slotIndices[indexSlots[index]] = static_cast<uint32_t>(index);
+    }
+
+    x.pop_back();
+    y.pop_back();
+    velocityX.pop_back();
+    velocityY.pop_back();
+    scroll.pop_back();
+    halfWidth.pop_back();
+    halfHeight.pop_back();
+    hitMinX.pop_back();
+    hitMinY.pop_back();
+    hitMaxX.pop_back();
+    hitMaxY.pop_back();
+    moveX.pop_back();
+    moveY.pop_back();
+    soundVolume.pop_back();
+    pitchVariation.pop_back();
+    audioId.pop_back();
+    kind.pop_back();
+    spriteIndex.pop_back();
+    indexSlots.pop_back();
+
+    slotGenerations[slot]++;  // Outstanding handles to this car stop resolving
+    freeSlots.push_back(slot);
+}
+
+void CarStore::clear() {
+    while (size() > 0) {
+        despawnAt(size() - 1);
+    }
+}
+
+//=== LOOKUP ===
+
+bool CarStore::isAlive(CarHandle handle) const {
+    return handle.slot < slotGenerations.size() && slotGenerations[handle.slot] == handle.generation;
+}
+
+size_t CarStore::indexOf(CarHandle handle) const {
+    return slotIndices[handle.slot];
+}
+
+CarHandle CarStore::handleAt(size_t index) const {
+    uint32_t slot = indexSlots[index];
+    return { slot, slotGenerations[slot] };
+}
+
+size_t CarStore::getFootprint() const {
+    size_t bytes = 0;
+    for (const vector<float>* component : { &x, &y, &velocityX, &velocityY, &scroll, &halfWidth, &halfHeight,
+                                            &hitMinX, &hitMinY, &hitMaxX, &hitMaxY, &moveX, &moveY, &soundVolume, &pitchVariation }) {
+        bytes += component->capacity() * sizeof(float);
+    }
+    bytes += audioId.capacity() * sizeof(uint32_t);
+    bytes += kind.capacity() * sizeof(CarKind);
+    bytes += spriteIndex.capacity() * sizeof(uint8_t);
+    for (const vector<uint32_t>* table : { &indexSlots, &slotIndices, &slotGenerations, &freeSlots }) {
+        bytes += table->capacity() * sizeof(uint32_t);
+    }
+    return bytes;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "HitboxKernel.h"
+
+using namespace std;
+
+//=== CAR KINDS ===
+// Every vehicle in Level 3 lives in the same store; the kind decides which systems use it
+enum class CarKind : uint8_t {
+    Player,         // The car the player drives (or the pedestrian after leaving it)
+    Obstacle,       // Traffic: scrolls with the road, collides, has an engine sound
+    Abandoned       // The player's car after getting out (static, drawn only)
+};
+
+//=== CAR HANDLE ===
+// Stable reference to one car: stays valid while the car lives, even when the store
+// reorders its arrays, and never resolves to a later car that reuses the same slot
+struct CarHandle {
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool isValid() const { return slot != UINT32_MAX; }
+};
+
+//=== CAR STORE CLASS DECLARATION ===
+// Level 3 vehicles as structure-of-arrays components
+// - Each component is one contiguous array indexed 0..size()-1, so the per-frame loops
+//   (movement, audio, collision) stream through packed floats instead of whole objects
+// - Cars are plain data: no per-car Sprite, Sound or shape; rendering uses one shared
+//   sprite per car design
+// - Despawning moves the last car into the hole (a few floats per component), and slots
+//   are recycled through a free list: after the constructor reserved the capacity,
+//   spawning and despawning allocate nothing
+// Dense indices change when cars despawn; keep a CarHandle to follow one car across frames
+class CarStore {
+public:
+    explicit CarStore(size_t capacity);
+
+    CarStore(const CarStore&) = delete;
+    CarStore& operator=(const CarStore&) = delete;
+
+    //=== LIFETIME ===
+    // New car at the end of the arrays with zero velocity and no hitbox
+    CarHandle spawn(CarKind kind, float x, float y);
+    void despawn(CarHandle handle);
+    void despawnAt(size_t index);       // While iterating: walk the arrays backwards
+    void clear();                       // Keeps the capacity
+
+    //=== LOOKUP ===
+    bool isAlive(CarHandle handle) const;
+    size_t indexOf(CarHandle handle) const;     // Dense index (handle must be alive)
+    CarHandle handleAt(size_t index) const;
+    size_t size() const { return x.size(); }
+    size_t capacity() const { return x.capacity(); }
+    size_t getFootprint() const;        // Bytes reserved by every component and slot table
+
+    //=== HITBOX CACHE ===
+    // Recompute the packed box of one car after it moved or its half extents changed
+    void updateHitbox(size_t index) {
+        hitMinX[index] = x[index] - halfWidth[index];
+        hitMinY[index] = y[index] - halfHeight[index];
+        hitMaxX[index] = x[index] + halfWidth[index];
+        hitMaxY[index] = y[index] + halfHeight[index];
+    }
+    HitboxArrays getHitboxes() const { return { hitMinX.data(), hitMinY.data(), hitMaxX.data(), hitMaxY.data(), size() }; }
+
+    //=== COMPONENT ARRAYS ===
+    // Sized by the store: read and write elements, never resize them directly
+    vector<float> x, y;                 // Center position (screen pixels)
+    vector<float> velocityX, velocityY; // Own motion (pixels/second)
+    vector<float> scroll;               // Share of the road speed added to velocityY (1 = traffic)
+    vector<float> halfWidth, halfHeight;// Collision hitbox half extents around the center
+    vector<float> hitMinX, hitMinY;     // Cached hitbox corners (see updateHitbox)
+    vector<float> hitMaxX, hitMaxY;
+    vector<float> moveX, moveY;         // Displacement during the last movement step (swept collision)
+    vector<float> soundVolume;          // Per-car engine volume variation
+    vector<float> pitchVariation;       // Per-car engine base pitch
+    vector<uint32_t> audioId;           // Stable emitter id for the engine voice pool
+    vector<CarKind> kind;
+    vector<uint8_t> spriteIndex;        // Car design in the sprite sheet
+
+private:
+    //=== SLOT TABLES ===
+    vector<uint32_t> indexSlots;        // Dense index -> slot
+    vector<uint32_t> slotIndices;       // Slot -> dense index
+    vector<uint32_t> slotGenerations;   // Bumped when a slot is freed
+    vector<uint32_t> freeSlots;         // Recycled slots, reused last-in first-out
+};
@@ -0,0 +1,311 @@
+#include "DecodeCache.h"
+#include "AssetArchiveFormat.h"
+#include "FastCodec.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace sf;
+using namespace std;
+
+//=== CACHE FILE FORMAT ===
+// CacheHeader, channel map bytes, then the (optionally compressed) payload
+namespace {
+    constexpr uint32_t CacheMagic = 0x43445346u;    // "FSDC" read as little-endian uint32
+    constexpr uint32_t CacheVersion = 2;
+    constexpr uint32_t KindImage = 1;               // RGBA8 pixels
+    constexpr uint32_t KindSound = 2;               // 16-bit interleaved PCM
+
+    // Sanity limits for header values read from disk (a corrupt entry must not allocate wildly)
+    constexpr uint32_t MaxImageSide = 16384;
+    constexpr uint32_t MaxChannels = 32;
+    constexpr uint64_t MaxExpansion = 256;          // FastCodec expands a byte at most ~255 times
+
+    struct CacheHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t kind;
+        uint32_t channelMapSize;    // Bytes of channel map following the header
+        uint64_t sourceHash;        // Hash of the encoded source file
+        uint64_t sourceSize;        // Size of the encoded source file
+        uint64_t sourceStamp;       // Write stamp of the source when the entry was built
+        uint32_t width;             // Image width / sound channel count
+        uint32_t height;            // Image height / sound sample rate
+        uint64_t rawSize;           // Decoded payload size
+        uint64_t storedSize;        // Payload size on disk (== rawSize when stored uncompressed)
+    };
+
+    // 64-bit FNV-1a over the encoded source bytes
+    uint64_t hashBytes(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // Header sizes must agree with the file length and with the asset's own dimensions
+    bool isPlausible(const CacheHeader& header, uint64_t fileSize) {
+        if (header.channelMapSize > MaxChannels ||
+            sizeof(CacheHeader) + header.channelMapSize + header.storedSize != fileSize) {
+            return false;  // Truncated, padded or nonsense sizes
+        }
+        if (header.storedSize == header.rawSize) {
+            // Stored raw
+        } else if (header.storedSize > header.rawSize || header.rawSize / MaxExpansion > header.storedSize) {
+            return false;
+        }
+        if (header.kind == KindImage) {
+            return header.width <= MaxImageSide && header.height <= MaxImageSide &&
+                   header.rawSize == static_cast<uint64_t>(header.width) * header.height * 4;
+        }
+        return header.width > 0 && header.width <= MaxChannels && header.channelMapSize == header.width &&
+               header.rawSize % (sizeof(int16_t) * header.width) == 0;
+    }
+
+    // Process id: temporary names must differ between processes sharing the cache folder
+    unsigned long currentProcessId() {
+#ifdef _WIN32
+        return static_cast<unsigned long>(_getpid());
+#else
+        return static_cast<unsigned long>(getpid());
+#endif
+    }
+}
+
+//=== CONSTRUCTOR ===
+DecodeCache::DecodeCache(const string& directory) : directory(directory) {}
+
+//=== LOADING SYSTEM ===
+
+bool DecodeCache::loadImage(const string& path, Image& image) {
+    Source source;
+    if (!describeSource(path, source)) {
+        return false;
+    }
+
+    //=== CACHE HIT ===
+    // Decompressed pixels go straight into the image (no JPEG/PNG decode)
+    Entry entry;
+    if (readEntry(path, KindImage, source, entry)) {
+        image.resize({ entry.width, entry.height }, entry.payload.data());
+        hits++;
+        return true;
+    }
+
+    //=== CACHE MISS ===
+    // Decode the source once and store the pixels for the next run
+    if (!fetchSource(path, source) || !image.loadFromMemory(source.bytes.data, source.bytes.size)) {
+        return false;
+    }
+    misses++;
+
+    Vector2u size = image.getSize();
+    entry.width = size.x;
+    entry.height = size.y;
+    entry.payload.assign(image.getPixelsPtr(), image.getPixelsPtr() + static_cast<size_t>(size.x) * size.y * 4);
+    writeEntry(path, KindImage, source, entry);
+    return true;
+}
+
+bool DecodeCache::loadSoundBuffer(const string& path, SoundBuffer& buffer) {
+    Source source;
+    if (!describeSource(path, source)) {
+        return false;
+    }
+
+    //=== CACHE HIT ===
+    Entry entry;
+    if (readEntry(path, KindSound, source, entry)) {
+        vector<SoundChannel> channelMap;
+        for (uint8_t channel : entry.channelMap) {
+            channelMap.push_back(static_cast<SoundChannel>(channel));
+        }
+        const int16_t* samples = reinterpret_cast<const int16_t*>(entry.payload.data());
+        if (buffer.loadFromSamples(samples, entry.payload.size() / sizeof(int16_t), entry.width, entry.height, channelMap)) {
+            hits++;
+            return true;
+        }
+    }
+
+    //=== CACHE MISS ===
+    // Vorbis decode once, keep the PCM samples
+    if (!fetchSource(path, source) || !buffer.loadFromMemory(source.bytes.data, source.bytes.size)) {
+        return false;
+    }
+    misses++;
+
+    entry.width = buffer.getChannelCount();
+    entry.height = buffer.getSampleRate();
+    entry.channelMap.clear();
+    for (SoundChannel channel : buffer.getChannelMap()) {
+        entry.channelMap.push_back(static_cast<uint8_t>(channel));
+    }
+    const uint8_t* samples = reinterpret_cast<const uint8_t*>(buffer.getSamples());
+    entry.payload.assign(samples, samples + static_cast<size_t>(buffer.getSampleCount()) * sizeof(int16_t));
+    writeEntry(path, KindSound, source, entry);
+    return true;
+}
+
+//=== SOURCE ACCESS ===
+
+// Size and stamp only: an archived asset is identified by the archive's write time and its
+// position in it, a loose file by its own write time
+bool DecodeCache::describeSource(const string& path, Source& source) {
+    AssetView packed = assetArchive.find(path);
+    if (packed) {
+        source.size = packed.size;
+        source.stamp = assetArchive.getStamp() ^ (assetArchive.getOffset(packed) * 0x9e3779b97f4a7c15ull);
+        source.bytes = packed;  // Mapped: reading it later costs nothing up front
+        return true;
+    }
+
+    error_code ec;
+    uintmax_t size = filesystem::file_size(path, ec);
+    if (ec) {
+        return false;
+    }
+    auto writeTime = filesystem::last_write_time(path, ec);
+    source.size = size;
+    source.stamp = ec ? 0 : static_cast<uint64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+// Makes the encoded bytes available (reads a loose file) and hashes them
+bool DecodeCache::fetchSource(const string& path, Source& source) {
+    if (!source.bytes) {
+        ifstream file(path, ios::binary | ios::ate);
+        if (!file) {
+            return false;
+        }
+        source.storage.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(source.storage.data(), source.storage.size())) {
+            return false;
+        }
+        source.bytes = AssetView{ source.storage.data(), source.storage.size() };
+        source.size = source.storage.size();
+    }
+    source.hash = hashBytes(source.bytes.data, source.bytes.size);
+    return true;
+}
+
+//=== CACHE FILE I/O ===
+
+// "Images/Cars.png" -> "<directory>/images_cars.png.fsc"
+string DecodeCache::entryPath(const string& path) const {
+    string name = AssetArchiveFormat::normalizePath(path);
+    replace(name.begin(), name.end(), '/', '_');
+    return directory + "/" + name + ".fsc";
+}
+
+// Reads an entry if it exists and was built from the same source
+// - Same size and stamp: trusted without touching the source
+// - Stamp changed (file touched, restored, archive rebuilt): the source is hashed, and an
+//   entry with the same hash is still used and rewritten with the new stamp
+bool DecodeCache::readEntry(const string& path, uint32_t kind, Source& source, Entry& entry) {
+    ifstream file(entryPath(path), ios::binary | ios::ate);
+    if (!file) {
+        return false;
+    }
+    uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(0);
+
+    CacheHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != CacheMagic || header.version != CacheVersion || header.kind != kind ||
+        header.sourceSize != source.size || !isPlausible(header, fileSize)) {
+        return false;  // Missing, foreign, corrupt or stale entry
+    }
+
+    bool restamp = header.sourceStamp != source.stamp;
+    if (restamp && (!fetchSource(path, source) || header.sourceHash != source.hash)) {
+        return false;  // The source really changed
+    }
+
+    entry.width = header.width;
+    entry.height = header.height;
+    entry.channelMap.resize(header.channelMapSize);
+    entry.payload.resize(static_cast<size_t>(header.rawSize));
+    if (!file.read(reinterpret_cast<char*>(entry.channelMap.data()), entry.channelMap.size())) {
+        return false;
+    }
+
+    // Uncompressed payloads are read in place
+    if (header.storedSize == header.rawSize) {
+        if (!file.read(reinterpret_cast<char*>(entry.payload.data()), entry.payload.size())) {
+            return false;
+        }
+    } else {
+        vector<uint8_t> stored(static_cast<size_t>(header.storedSize));
+        if (!file.read(reinterpret_cast<char*>(stored.data()), stored.size()) ||
+            !FastCodec::decompress(stored.data(), stored.size(), entry.payload.data(), entry.payload.size())) {
+            return false;
+        }
+    }
+
+    if (restamp) {
+        file.close();
+        writeEntry(path, kind, source, entry);  // Next run hits on the stamp
+    }
+    return true;
+}
+
+// Writes an entry through a temporary file, so a crash never leaves a torn entry behind
+// The temporary name is unique per process and write: concurrent writers (loader threads,
+// a second game instance) never share one, and each rename publishes a complete entry
+// Cache write failures are not fatal: the asset was already decoded successfully
+void DecodeCache::writeEntry(const string& path, uint32_t kind, Source& source, const Entry& entry) {
+    if (source.hash == 0) {
+        fetchSource(path, source);  // Hash of the bytes the entry was decoded from
+    }
+
+    error_code ec;
+    filesystem::create_directories(directory, ec);
+
+    vector<uint8_t> compressed = FastCodec::compress(entry.payload.data(), entry.payload.size());
+    bool storeCompressed = compressed.size() < entry.payload.size();  // Incompressible data is stored raw
+    const vector<uint8_t>& stored = storeCompressed ? compressed : entry.payload;
+
+    CacheHeader header{};
+    header.magic = CacheMagic;
+    header.version = CacheVersion;
+    header.kind = kind;
+    header.channelMapSize = static_cast<uint32_t>(entry.channelMap.size());
+    header.sourceHash = source.hash;
+    header.sourceSize = source.size;
+    header.sourceStamp = source.stamp;
+    header.width = entry.width;
+    header.height = entry.height;
+    header.rawSize = entry.payload.size();
+    header.storedSize = stored.size();
+
+    string finalPath = entryPath(path);
+    string temporaryPath = finalPath + "." + to_string(currentProcessId()) + "-" + to_string(nextTemporary++) + ".tmp";
+    {
+        ofstream file(temporaryPath, ios::binary | ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entry.channelMap.data()), entry.channelMap.size());
+        file.write(reinterpret_cast<const char*>(stored.data()), stored.size());
+        if (!file) {
+            cerr << "Could not write decode cache entry for " << path << endl;
+            file.close();
+            filesystem::remove(temporaryPath, ec);
+            return;
+        }
+    }
+
+    filesystem::rename(temporaryPath, finalPath, ec);
+    if (ec) {
+        filesystem::remove(temporaryPath, ec);
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "AssetArchive.h"
+
+using namespace sf;
+using namespace std;
+
+//=== DECODE CACHE CLASS DECLARATION ===
+// On-disk cache of fully decoded assets, so JPEG/PNG/OGG decoding only happens once
+// - Images are stored as raw RGBA8 pixels, sounds as 16-bit PCM samples
+// - Payloads are compressed with FastCodec (decompression runs at near memcpy speed)
+// - Each entry records the source's size and write stamp, and a hash of its bytes. A hit
+//   only compares size and stamp (the source is not even read); when the stamp changed the
+//   bytes are hashed, and only a changed hash decodes the asset again
+// - Source bytes come from the asset archive when packed, otherwise from loose files
+// Thread-safe for concurrent calls (AssetLoader workers) and for several processes sharing
+// the cache folder: every writer publishes a complete entry through its own temporary file
+class DecodeCache {
+public:
+    explicit DecodeCache(const string& directory);
+
+    DecodeCache(const DecodeCache&) = delete;
+    DecodeCache& operator=(const DecodeCache&) = delete;
+
+    //=== LOADING SYSTEM ===
+    // Fill the image/buffer from the cache, or decode the source and store it in the cache
+    // Returns: false if the source asset is missing or cannot be decoded
+    bool loadImage(const string& path, Image& image);
+    bool loadSoundBuffer(const string& path, SoundBuffer& buffer);
+
+    //=== STATISTICS ===
+    size_t getHitCount() const { return hits.load(); }
+    size_t getMissCount() const { return misses.load(); }
+
+private:
+    //=== CACHE ENTRY ===
+    // Decoded payload plus the metadata needed to rebuild the SFML object
+    struct Entry {
+        uint32_t width = 0;                 // Image width / sound channel count
+        uint32_t height = 0;                // Image height / sound sample rate
+        vector<uint8_t> channelMap;         // Sound channel layout (SoundChannel values)
+        vector<uint8_t> payload;            // Decoded pixels or samples (uncompressed)
+    };
+
+    //=== SOURCE DESCRIPTION ===
+    // The encoded asset an entry is built from; bytes and hash are fetched only when needed
+    struct Source {
+        uint64_t size = 0;
+        uint64_t stamp = 0;                 // Loose file write time, or archive write time and offset
+        AssetView bytes;                    // Empty until fetched
+        vector<char> storage;               // Loose file contents once fetched
+        uint64_t hash = 0;                  // Valid once fetched
+    };
+
+    string directory;                       // Cache folder, created on first write
+    atomic<size_t> hits{ 0 };
+    atomic<size_t> misses{ 0 };
+    atomic<uint32_t> nextTemporary{ 0 };    // Makes temporary file names unique per writer
+
+    string entryPath(const string& path) const;
+    // Returns: false if the source asset does not exist
+    static bool describeSource(const string& path, Source& source);
+    static bool fetchSource(const string& path, Source& source);
+    bool readEntry(const string& path, uint32_t kind, Source& source, Entry& entry);
+    void writeEntry(const string& path, uint32_t kind, Source& source, const Entry& entry);
+};
+
+//=== GLOBAL INSTANCE DECLARATION ===
+// Defined in: FS1.1.cpp
+extern DecodeCache decodeCache;
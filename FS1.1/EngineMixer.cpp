@@ -0,0 +1,239 @@
+#include "EngineMixer.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENGINE_MIXER_SSE 1
+#include <emmintrin.h>
+#endif
+
+using namespace sf;
+using namespace std;
+
+//=== CONSTRUCTOR / DESTRUCTOR ===
+EngineMixer::EngineMixer(size_t maxVoices, unsigned int sampleRate)
+    : voices(maxVoices), mixBuffer(ChunkFrames), outputBuffer(ChunkFrames) {
+    initialize(1, sampleRate, { SoundChannel::Mono });
+}
+
+// The audio thread calls onGetData, so it must be stopped before members are destroyed
+EngineMixer::~EngineMixer() {
+    stop();
+}
+
+//=== SOURCE AND VOICE SETUP ===
+
+EngineMixer::SourceId EngineMixer::addSource(const SoundBuffer& buffer) {
+    unsigned int channels = buffer.getChannelCount();
+    size_t frames = channels > 0 ? static_cast<size_t>(buffer.getSampleCount()) / channels : 0;
+    if (frames == 0) {
+        return InvalidId;
+    }
+
+    //=== DOWNMIX TO MONO FLOAT ===
+    Source source;
+    source.length = frames;
+    source.sampleRate = buffer.getSampleRate();
+    source.samples.resize(frames + 2);
+    const int16_t* pcm = buffer.getSamples();
+    float scale = 1.0f / (32768.0f * channels);
+    for (size_t frame = 0; frame < frames; ++frame) {
+        int sum = 0;
+        for (unsigned int c = 0; c < channels; ++c) {
+            sum += pcm[frame * channels + c];
+        }
+        source.samples[frame] = sum * scale;
+    }
+    // Guard frames: interpolation across the loop point (and float rounding at the run end)
+    source.samples[frames] = source.samples[0];
+    source.samples[frames + 1] = source.samples[min<size_t>(1, frames - 1)];
+
+    sources.push_back(std::move(source));
+    return static_cast<SourceId>(sources.size() - 1);
+}
+
+EngineMixer::VoiceId EngineMixer::addVoice(SourceId source) {
+    if (source < 0 || source >= static_cast<SourceId>(sources.size())) {
+        return InvalidId;
+    }
+    for (size_t i = 0; i < voices.size(); ++i) {
+        if (voices[i].source == InvalidId) {
+            voices[i].reset(source);
+            return static_cast<VoiceId>(i);
+        }
+    }
+    return InvalidId;
+}
+
+void EngineMixer::clear() {
+    assert(getStatus() == Status::Stopped && "EngineMixer::clear() while the stream is playing");
+    for (Voice& voice : voices) {
+        voice.reset(InvalidId);
+    }
+    sources.clear();
+}
+
+void EngineMixer::Voice::reset(SourceId newSource) {
+    source = newSource;
+    playing.store(false);
+    gain.store(0.0f);
+    pitch.store(1.0f);
+    startPhase.store(0.0f);
+    starts.store(0);
+    position = 0.0;
+    startsApplied = 0;
+}
+
+//=== VOICE CONTROL ===
+
+void EngineMixer::setVoice(VoiceId voice, float gain, float pitch) {
+    if (voice < 0 || voice >= static_cast<VoiceId>(voices.size())) return;
+    voices[voice].gain.store(max(0.0f, gain), memory_order_relaxed);
+    voices[voice].pitch.store(max(0.01f, pitch), memory_order_relaxed);
+}
+
+void EngineMixer::startVoice(VoiceId voice, float startPhase) {
+    if (voice < 0 || voice >= static_cast<VoiceId>(voices.size())) return;
+    voices[voice].startPhase.store(startPhase, memory_order_relaxed);
+    voices[voice].starts.fetch_add(1, memory_order_release);  // Publishes startPhase
+    voices[voice].playing.store(true, memory_order_release);
+}
+
+void EngineMixer::stopVoice(VoiceId voice) {
+    if (voice < 0 || voice >= static_cast<VoiceId>(voices.size())) return;
+    voices[voice].playing.store(false, memory_order_release);
+}
+
+void EngineMixer::stopAllVoices() {
+    for (Voice& voice : voices) {
+        voice.playing.store(false, memory_order_release);
+    }
+}
+
+//=== STATISTICS ===
+float EngineMixer::getChunkMicroseconds() const {
+    return ChunkFrames * 1000000.0f / getSampleRate();
+}
+
+//=== MIXING KERNEL ===
+// Linear interpolation between the two source frames around each read position
+// The loop is split into runs that never cross the loop end, so the inner loop has no wrap test
+void EngineMixer::mixVoice(const Source& source, double& position, float gain, float step, float* mix, size_t frames) {
+    const float* samples = source.samples.data();
+    double length = static_cast<double>(source.length);
+
+    size_t i = 0;
+    while (i < frames) {
+        if (position >= length) {
+            position = fmod(position, length);
+        }
+
+        // Positions are relative to an integer base so float lanes keep full precision
+        size_t base = static_cast<size_t>(position);
+        float frac = static_cast<float>(position - static_cast<double>(base));
+        size_t run = min(frames - i, static_cast<size_t>(ceil((length - position) / step)));
+        const float* window = samples + base;
+        float* out = mix + i;
+        size_t k = 0;
+
+#ifdef ENGINE_MIXER_SSE
+        //=== SSE PATH: 4 output frames per iteration ===
+        const __m128 laneOffsets = _mm_add_ps(_mm_set1_ps(frac), _mm_set_ps(3.0f * step, 2.0f * step, step, 0.0f));
+        const __m128 gains = _mm_set1_ps(gain);
+        alignas(16) int32_t index[4];
+        for (; k + 4 <= run; k += 4) {
+            __m128 position = _mm_add_ps(laneOffsets, _mm_set1_ps(k * step));
+            __m128i whole = _mm_cvttps_epi32(position);                         // Positions are >= 0: truncation is floor
+            __m128 t = _mm_sub_ps(position, _mm_cvtepi32_ps(whole));
+            _mm_store_si128(reinterpret_cast<__m128i*>(index), whole);
+
+            __m128 s0 = _mm_set_ps(window[index[3]], window[index[2]], window[index[1]], window[index[0]]);
+            __m128 s1 = _mm_set_ps(window[index[3] + 1], window[index[2] + 1], window[index[1] + 1], window[index[0] + 1]);
+            __m128 sample = _mm_add_ps(s0, _mm_mul_ps(t, _mm_sub_ps(s1, s0)));
+
+            __m128 acc = _mm_loadu_ps(out + k);
+            _mm_storeu_ps(out + k, _mm_add_ps(acc, _mm_mul_ps(sample, gains)));
+        }
+#endif
+
+        //=== SCALAR PATH (tail, or non-SSE builds) ===
+        for (; k < run; ++k) {
+            float offset = frac + k * step;
+            size_t whole = static_cast<size_t>(offset);
+            float t = offset - static_cast<float>(whole);
+            float s0 = window[whole];
+            float s1 = window[whole + 1];
+            out[k] += (s0 + t * (s1 - s0)) * gain;
+        }
+
+        position += run * static_cast<double>(step);
+        i += run;
+    }
+}
+
+//=== SOUNDSTREAM OVERRIDES ===
+
+// Audio thread: produce the next chunk of the endless mix
+bool EngineMixer::onGetData(Chunk& data) {
+    auto mixStart = chrono::steady_clock::now();
+    fill(mixBuffer.begin(), mixBuffer.end(), 0.0f);
+
+    size_t playing = 0;
+    for (Voice& voice : voices) {
+        if (voice.source == InvalidId || !voice.playing.load(memory_order_acquire)) continue;
+        const Source& source = sources[voice.source];
+
+        uint32_t starts = voice.starts.load(memory_order_acquire);
+        if (starts != voice.startsApplied) {
+            float startPhase = voice.startPhase.load(memory_order_relaxed);
+            voice.position = min(max(startPhase, 0.0f), 1.0f) * static_cast<double>(source.length);
+            voice.startsApplied = starts;
+        }
+
+        float gain = voice.gain.load(memory_order_relaxed);
+        float step = voice.pitch.load(memory_order_relaxed) * source.sampleRate / getSampleRate();
+        if (gain > 0.0f) {
+            mixVoice(source, voice.position, gain, step, mixBuffer.data(), ChunkFrames);
+        } else {
+            // Silent voices keep advancing so they resume in phase
+            voice.position = fmod(voice.position + ChunkFrames * static_cast<double>(step), static_cast<double>(source.length));
+        }
+        playing++;
+    }
+
+    //=== FLOAT TO 16-BIT CONVERSION (clipped) ===
+    size_t i = 0;
+#ifdef ENGINE_MIXER_SSE
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    const __m128 low = _mm_set1_ps(-1.0f);
+    const __m128 high = _mm_set1_ps(1.0f);
+    for (; i + 8 <= ChunkFrames; i += 8) {
+        __m128 a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(&mixBuffer[i]), low), high), scale);
+        __m128 b = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(&mixBuffer[i + 4]), low), high), scale);
+        __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&outputBuffer[i]), packed);
+    }
+#endif
+    for (; i < ChunkFrames; ++i) {
+        float sample = min(max(mixBuffer[i], -1.0f), 1.0f);
+        outputBuffer[i] = static_cast<int16_t>(lrintf(sample * 32767.0f));
+    }
+
+    data.samples = outputBuffer.data();
+    data.sampleCount = ChunkFrames;
+
+    //=== COST MEASUREMENT ===
+    float elapsed = chrono::duration<float, micro>(chrono::steady_clock::now() - mixStart).count();
+    mixMicroseconds.store(mixMicroseconds.load() * 0.9f + elapsed * 0.1f);
+    busyNanoseconds.fetch_add(static_cast<uint64_t>(elapsed * 1000.0f));
+    if (elapsed > getChunkMicroseconds()) {
+        lateChunks++;  // The device would have drained the chunk before it was ready
+    }
+    playingVoices.store(playing);
+    return true;  // Endless stream
+}
+
+// The mix has no timeline; seeking is meaningless
+void EngineMixer::onSeek(Time timeOffset) {}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+//=== ENGINE MIXER CLASS DECLARATION ===
+// Software mixer for looping engine sounds, played as a single SoundStream
+// - Sources are immutable mono float copies of decoded loops, shared by any number of voices
+// - Each voice resamples its source at its own pitch (linear interpolation) and applies its gain
+// - All voices are summed with SSE into one buffer on the SFML audio thread, so the driver
+//   only ever sees one source no matter how many cars are audible
+// - Mix cost per chunk is measured and exposed for profiling
+// Threading: sources and voices are set up while the stream is stopped; voice parameters are
+// lock-free atomics written by the audio control thread (see AudioSystem) and read by the mix,
+// so neither thread ever waits on the other
+class EngineMixer : public SoundStream {
+public:
+    using SourceId = int;
+    using VoiceId = int;
+    static constexpr int InvalidId = -1;
+
+    explicit EngineMixer(size_t maxVoices, unsigned int sampleRate = 44100);
+    ~EngineMixer() override;
+
+    EngineMixer(const EngineMixer&) = delete;
+    EngineMixer& operator=(const EngineMixer&) = delete;
+
+    //=== SOURCE AND VOICE SETUP (stream stopped) ===
+    // Copy a decoded loop into the mixer (downmixed to mono)
+    // Returns: InvalidId if the buffer is empty
+    SourceId addSource(const SoundBuffer& buffer);
+
+    // Reserve a voice playing the given source (silent until started)
+    // Returns: InvalidId when all voices are in use
+    VoiceId addVoice(SourceId source);
+
+    // Remove every voice and source
+    // The stream must be stopped first (and any queued stop executed): the mix reads sources
+    // and voice slots without locks. Play it again once new sources and voices are set up
+    void clear();
+
+    //=== VOICE CONTROL (any one thread, normally the AudioSystem thread) ===
+    // gain: linear, 1.0f = source level; pitch: playback rate multiplier
+    void setVoice(VoiceId voice, float gain, float pitch);
+    // startPhase: position in the loop as a fraction 0.0f-1.0f (decorrelates identical loops)
+    void startVoice(VoiceId voice, float startPhase = 0.0f);
+    void stopVoice(VoiceId voice);
+    void stopAllVoices();
+
+    //=== STATISTICS ===
+    size_t getMaxVoices() const { return voices.size(); }
+    size_t getPlayingVoiceCount() const { return playingVoices.load(); }
+    float getMixMicroseconds() const { return mixMicroseconds.load(); }    // Smoothed cost per chunk
+    float getChunkMicroseconds() const;                                     // Real time covered by one chunk
+    uint64_t getBusyNanoseconds() const { return busyNanoseconds.load(); } // Mix work, total
+    size_t getLateChunkCount() const { return lateChunks.load(); }           // Mixed slower than real time
+
+private:
+    //=== SOURCE STRUCTURE ===
+    struct Source {
+        vector<float> samples;          // Mono loop plus two guard frames (copies of the first two)
+        size_t length = 0;              // Loop length in frames, without the guard sample
+        unsigned int sampleRate = 0;
+    };
+
+    //=== VOICE STRUCTURE ===
+    struct Voice {
+        SourceId source = InvalidId;    // InvalidId: slot unused (setup only)
+
+        // Control side
+        atomic<bool> playing{ false };
+        atomic<float> gain{ 0.0f };
+        atomic<float> pitch{ 1.0f };
+        atomic<float> startPhase{ 0.0f };
+        atomic<uint32_t> starts{ 0 };   // Bumped by startVoice after startPhase is written
+
+        // Mix side
+        double position = 0.0;          // Read position in source frames
+        uint32_t startsApplied = 0;     // Last start request moved to startPhase
+
+        void reset(SourceId newSource);
+    };
+
+    static constexpr size_t ChunkFrames = 512;  // ~11.6 ms at 44.1 kHz
+
+    vector<Source> sources;
+    vector<Voice> voices;               // Fixed size, allocated once (atomics never move)
+
+    vector<float> mixBuffer;            // Float accumulator (audio thread)
+    vector<int16_t> outputBuffer;       // Converted chunk handed to SFML (audio thread)
+
+    atomic<size_t> playingVoices{ 0 };
+    atomic<float> mixMicroseconds{ 0.0f };
+    atomic<uint64_t> busyNanoseconds{ 0 };
+    atomic<size_t> lateChunks{ 0 };
+
+    //=== SOUNDSTREAM OVERRIDES ===
+    bool onGetData(Chunk& data) override;
+    void onSeek(Time timeOffset) override;
+
+    // Resample one voice into the accumulator: mix[i] += gain * source(position + i * step)
+    static void mixVoice(const Source& source, double& position, float gain, float step, float* mix, size_t frames);
+};
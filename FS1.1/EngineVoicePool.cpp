@@ -0,0 +1,128 @@
+#include "EngineVoicePool.h"
+#include "AudioSystem.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace sf;
+using namespace std;
+
+namespace {
+    // Emitters that already own a voice rank as if this much louder, so two cars at
+    // nearly the same distance do not steal the voice from each other every frame
+    constexpr float KeepVoiceBonus = 1.25f;
+}
+
+//=== CONSTRUCTOR ===
+EngineVoicePool::EngineVoicePool(size_t maxVoices) : maxVoices(maxVoices) {}
+
+//=== SOURCE BINDING ===
+size_t EngineVoicePool::bind(EngineMixer& target, EngineMixer::SourceId source) {
+    unbind();
+    mixer = &target;
+    for (size_t i = 0; i < maxVoices; ++i) {
+        EngineMixer::VoiceId id = mixer->addVoice(source);
+        if (id == EngineMixer::InvalidId) break;
+        freeVoices.push_back(voices.size());
+        voices.push_back({ id });
+    }
+    voiceOfEmitter.reserve(voices.size());
+    return voices.size();
+}
+
+void EngineVoicePool::unbind() {
+    stopAll();
+    voices.clear();
+    freeVoices.clear();
+    mixer = nullptr;
+}
+
+//=== FRAME INTERFACE ===
+
+void EngineVoicePool::submit(uint32_t id, float volume, float pitch) {
+    float priority = volume;
+    if (voiceOfEmitter.count(id)) {
+        priority *= KeepVoiceBonus;
+    }
+    emitters.push_back({ id, volume, pitch, priority });
+}
+
+void EngineVoicePool::apply() {
+    if (!mixer) {
+        emitters.clear();
+        return;
+    }
+
+    //=== VOICE SELECTION ===
+    // Move the highest priority emitters to the front (only their order among themselves is arbitrary)
+    size_t realCount = min(voices.size(), emitters.size());
+    nth_element(emitters.begin(), emitters.begin() + realCount, emitters.end(),
+        [](const Emitter& a, const Emitter& b) { return a.priority > b.priority; });
+
+    for (size_t i = 0; i < realCount; ++i) {
+        auto found = voiceOfEmitter.find(emitters[i].id);
+        if (found != voiceOfEmitter.end()) voices[found->second].selected = true;
+    }
+
+    //=== VIRTUALIZATION ===
+    // Voices whose emitter dropped out of the selection (or out of range) are freed
+    for (size_t v = 0; v < voices.size(); ++v) {
+        Voice& voice = voices[v];
+        if (voice.assigned && !voice.selected) {
+            audio.stopVoice(*mixer, voice.id);
+            voiceOfEmitter.erase(voice.emitterId);
+            freeVoices.push_back(v);
+            voice.assigned = false;
+        }
+        voice.selected = false;
+    }
+
+    //=== VOICE ASSIGNMENT ===
+    for (size_t i = 0; i < realCount; ++i) {
+        const Emitter& emitter = emitters[i];
+
+        auto found = voiceOfEmitter.find(emitter.id);
+        if (found != voiceOfEmitter.end()) {
+            audio.setVoice(*mixer, voices[found->second].id, emitter.volume / 100.0f, emitter.pitch);
+            continue;
+        }
+
+        // Always available: at most voices.size() emitters are selected
+        size_t index = freeVoices.back();
+        freeVoices.pop_back();
+        Voice& target = voices[index];
+        target.assigned = true;
+        target.emitterId = emitter.id;
+        voiceOfEmitter[emitter.id] = index;
+
+        audio.setVoice(*mixer, target.id, emitter.volume / 100.0f, emitter.pitch);
+
+        // Start each car at a different point of the loop so identical engines do not phase
+        float phase = (emitter.id % 1024) * 0.618034f;  // Golden ratio steps spread evenly
+        audio.startVoice(*mixer, target.id, phase - floor(phase));
+    }
+
+    virtualCount = emitters.size() - realCount;
+    emitters.clear();
+}
+
+void EngineVoicePool::stopAll() {
+    freeVoices.clear();
+    for (size_t v = 0; v < voices.size(); ++v) {
+        Voice& voice = voices[v];
+        if (mixer && voice.assigned) audio.stopVoice(*mixer, voice.id);
+        voice.assigned = false;
+        freeVoices.push_back(v);
+    }
+    voiceOfEmitter.clear();
+    emitters.clear();
+    virtualCount = 0;
+}
+
+//=== STATISTICS ===
+size_t EngineVoicePool::getActiveVoiceCount() const {
+    size_t count = 0;
+    for (const Voice& voice : voices) {
+        if (voice.assigned) count++;
+    }
+    return count;
+}
\ No newline at end of file
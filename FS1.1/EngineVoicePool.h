@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "EngineMixer.h"
+
+using namespace sf;
+using namespace std;
+
+//=== ENGINE VOICE POOL CLASS DECLARATION ===
+// Plays many looping engine emitters through a fixed number of EngineMixer voices
+// - Every voice plays the same shared, immutable mixer source (no per-emitter sample copies)
+// - Each frame the caller submits every audible emitter with its desired volume and pitch;
+//   the loudest emitters get a voice, the rest are virtualized (tracked, not playing)
+// - Emitters that keep their voice are only re-parameterized, so they never restart
+// Audio memory and mixing cost are bounded by the voice count, not by traffic density
+// Emitter -> voice lookups go through a hash map, so a frame costs O(emitters + voices)
+// Voice changes are posted through the AudioSystem command queue
+class EngineVoicePool {
+public:
+    explicit EngineVoicePool(size_t maxVoices);
+
+    EngineVoicePool(const EngineVoicePool&) = delete;
+    EngineVoicePool& operator=(const EngineVoicePool&) = delete;
+
+    //=== SOURCE BINDING ===
+    // Reserve the pool's voices on the mixer, all playing the given source
+    // Returns: number of voices reserved (fewer than requested if the mixer is full)
+    size_t bind(EngineMixer& mixer, EngineMixer::SourceId source);
+
+    // Stop and forget the mixer voices (call before the mixer is cleared)
+    void unbind();
+
+    //=== FRAME INTERFACE ===
+    // Collect this frame's emitters, then assign voices in apply()
+    // id: stable per emitter (used to keep a voice on the same emitter between frames)
+    // volume: 0.0f-100.0f, pitch: playback rate multiplier
+    void submit(uint32_t id, float volume, float pitch);
+    void apply();
+
+    // Stop every voice and forget this frame's emitters (pause, game over, state exit)
+    void stopAll();
+
+    //=== STATISTICS ===
+    size_t getVoiceCount() const { return voices.size(); }  // Bound mixer voices
+    size_t getActiveVoiceCount() const;                     // Voices currently playing
+    size_t getVirtualCount() const { return virtualCount; } // Emitters audible but not playing
+
+private:
+    //=== VOICE STRUCTURE ===
+    struct Voice {
+        EngineMixer::VoiceId id;        // Mixer voice
+        uint32_t emitterId = 0;         // Emitter currently using the voice
+        bool assigned = false;
+        bool selected = false;          // Emitter won a voice this frame (apply() scratch)
+    };
+
+    //=== EMITTER STRUCTURE ===
+    struct Emitter {
+        uint32_t id;
+        float volume;
+        float pitch;
+        float priority;                 // Volume, with a bonus for emitters already playing
+    };
+
+    EngineMixer* mixer = nullptr;       // Bound mixer (nullptr: submissions are ignored)
+    size_t maxVoices;
+    vector<Voice> voices;               // Reserved mixer voices
+    vector<Emitter> emitters;           // Reused every frame (capacity only grows)
+    unordered_map<uint32_t, size_t> voiceOfEmitter;  // Emitter id -> index of its assigned voice
+    vector<size_t> freeVoices;          // Indices of unassigned voices
+    size_t virtualCount = 0;
+};
@@ -6,9 +6,29 @@
 #include "PlayingState3.h"
 #include "PreLevelState.h"
 #include "IntroductionState.h"  // NEW: Include introduction state
+#include "LoadingState.h"
 #include "SettingsState.h"
 #include "GameState.h"
 #include "NavigationSounds.h"
+#include "ResourceManager.h"
+#include "MenuState.h"
+#include "StateMachine.h"
+#include "AssetArchive.h"
+#include "DecodeCache.h"
+#include "AudioSystem.h"
+#include "AudioTelemetry.h"
+#include "BenchmarkLog.h"
+#include "HitboxBenchmark.h"
+#include "ParticleBenchmark.h"
+#include "TrafficBenchmark.h"
+#include "Level3Soak.h"
+#include "TextureAtlas.h"
+#include "MusicPlayer.h"
+#include "Settings.h"
+#include "Random.h"
+#include "Input.h"
+#include <cstdlib>
+#include <cstring>
 
 using namespace sf;
 using namespace std;
@@ -18,11 +38,56 @@ using namespace std;
 // This allows the settings menu to remember which state called it
 GameState previousState = MENU;
 
+//=== GLOBAL SETTINGS STORE ===
+// Current settings snapshot and change subscriptions (see Settings.h)
+// Defined first so it outlives every subscriber
+SettingsStore settings;
+
+//=== GLOBAL RANDOM SERVICE ===
+// Master seed and per-subsystem random streams (see Random.h)
+RandomService randomService;
+
+//=== GLOBAL INPUT SNAPSHOT ===
+// This frame's keyboard and mouse state, fed by the main loop's events (see Input.h)
+InputSnapshot input;
+
+//=== GLOBAL ASSET ARCHIVE ===
+// Memory-mapped pack of all game assets (built by Tools/AssetPacker)
+// Defined before resources so the mapping outlives every asset decoded from it
+AssetArchive assetArchive;
+
+//=== GLOBAL DECODE CACHE ===
+// Decoded pixels and PCM samples from previous runs (see DecodeCache.h)
+DecodeCache decodeCache("Cache");
+
+//=== GLOBAL RESOURCE CACHE ===
+// Shared cache for fonts, textures and sound buffers - definition (not declaration)
+// Defined before navSounds so the buffers are destroyed after the sounds using them
+ResourceManager resources;
+
+//=== GLOBAL TEXTURE ATLAS ===
+// Shared pages for the small and medium game images (see TextureAtlas.h)
+// Defined after resources: its pages are resource manager textures
+TextureAtlas textureAtlas(1024, 2);
+
 //=== GLOBAL AUDIO SYSTEM ===
 // Global navigation sound system - definition (not declaration)
 // Provides consistent UI audio feedback throughout the application
 NavigationSounds navSounds;
 
+//=== GLOBAL AUDIO THREAD ===
+// Applies every queued audio command (see AudioSystem.h)
+// Defined after navSounds and resources so it stops before the sounds it drives are destroyed
+AudioSystem audio;
+
+//=== GLOBAL AUDIO TELEMETRY ===
+// Audio health statistics for the F3 overlay and the benchmark log (see AudioTelemetry.h)
+AudioTelemetry audioTelemetry;
+
+//=== GLOBAL BENCHMARK LOG ===
+// JSON Lines measurement output, opened only with --bench (see BenchmarkLog.h)
+BenchmarkLog benchmarkLog;
+
 //=== NAVIGATION SOUNDS IMPLEMENTATION ===
 // Implementation of NavigationSounds methods for UI audio feedback
 
@@ -30,153 +95,234 @@ NavigationSounds navSounds;
 // Returns true if all sounds loaded successfully, false otherwise
 bool NavigationSounds::loadSounds() {
     bool allLoaded = true;
+    mixer = make_unique<UiSoundMixer>();  // Stopped: sounds can be added
     
     //=== HOVER SOUND LOADING ===
     // Sound played when hovering over menu items or changing selection
-    if (!hoverBuffer.loadFromFile("Sounds/UI_Hover.ogg")) {
+    hoverBuffer = resources.acquireSoundBuffer("Sounds/UI_Hover.ogg");
+    if (!hoverBuffer.isValid()) {
         cerr << "Warning: Could not load hover sound effect" << endl;
         allLoaded = false;
     } else {
-        hoverSound = Sound(hoverBuffer);  // Create sound object from buffer
+        hoverSound = mixer->addSound(resources.get(hoverBuffer), VoicesPerEffect);  // Copy into voice pool
     }
     
     //=== SELECT SOUND LOADING ===
     // Sound played when confirming selections or entering menus
-    if (!selectBuffer.loadFromFile("Sounds/UI_Select.ogg")) {
+    selectBuffer = resources.acquireSoundBuffer("Sounds/UI_Select.ogg");
+    if (!selectBuffer.isValid()) {
         cerr << "Warning: Could not load select sound effect" << endl;
         allLoaded = false;
     } else {
-        selectSound = Sound(selectBuffer);  // Create sound object from buffer
+        selectSound = mixer->addSound(resources.get(selectBuffer), VoicesPerEffect);  // Copy into voice pool
     }
     
     //=== BACK SOUND LOADING ===
     // Sound played when returning to previous menu or canceling actions
-    if (!backBuffer.loadFromFile("Sounds/UI_Back.ogg")) {
+    backBuffer = resources.acquireSoundBuffer("Sounds/UI_Back.ogg");
+    if (!backBuffer.isValid()) {
         cerr << "Warning: Could not load back sound effect" << endl;
         allLoaded = false;
     } else {
-        backSound = Sound(backBuffer);  // Create sound object from buffer
+        backSound = mixer->addSound(resources.get(backBuffer), VoicesPerEffect);  // Copy into voice pool
     }
     
     //=== ERROR SOUND LOADING (COMMENTED OUT) ===
     // Sound for invalid actions or error conditions
     // Currently disabled but can be uncommented if needed
     //// Try to load error sound
-    //if (!errorBuffer.loadFromFile("Sounds/UI_Error.ogg") && 
-    //    !errorBuffer.loadFromFile("Sounds/UI_Error.wav")) {
+    //errorBuffer = resources.acquireSoundBuffer("Sounds/UI_Error.ogg");
+    //if (!errorBuffer.isValid()) {
     //    cerr << "Warning: Could not load error sound effect" << endl;
     //    allLoaded = false;
     //} else {
-    //    errorSound = Sound(errorBuffer);
+    //    errorSound = mixer->addSound(resources.get(errorBuffer), VoicesPerEffect);
     //}
     
+    //=== BUFFER RELEASE ===
+    // The mixer holds its own converted copies
+    resources.release(hoverBuffer);
+    resources.release(selectBuffer);
+    resources.release(backBuffer);
+    resources.release(errorBuffer);
+    
+    //=== MIXER STARTUP ===
+    // Started once and never stopped: the source stays primed for the first trigger
+    updateVolume();           // Apply current volume settings before the first chunk
+    audio.play(*mixer);
+    audioTelemetry.attachUiSounds(mixer.get());
+    
     soundsLoaded = allLoaded;  // Store overall loading success state
-    updateVolume();           // Apply current volume settings
     return allLoaded;         // Return success status
 }
 
 // Updates volume for all navigation sounds based on current settings
 // Called when volume settings change or sounds are first loaded
 void NavigationSounds::updateVolume() {
-    if (hoverSound.has_value()) hoverSound->setVolume(soundVolume);   // Apply volume to hover sound
-    if (selectSound.has_value()) selectSound->setVolume(soundVolume); // Apply volume to select sound
-    if (backSound.has_value()) backSound->setVolume(soundVolume);     // Apply volume to back sound
-    if (errorSound.has_value()) errorSound->setVolume(soundVolume);   // Apply volume to error sound
+    if (mixer) audio.setVolume(*mixer, soundVolume);  // One stream volume for every effect
 }
 
-// Plays hover sound with immediate replacement of any currently playing instance
-// Stops current sound before playing new one for responsive audio feedback
+// Plays hover sound on the next voice of its pool
+// Overlaps a still-playing hover sound instead of cutting it off
 void NavigationSounds::playHover() {
-    if (soundsLoaded && hoverSound.has_value()) {
-        hoverSound->stop(); // Stop any currently playing hover sound
-        hoverSound->play(); // Start the new sound immediately
+    if (mixer && hoverSound != UiSoundMixer::InvalidId) {
+        mixer->trigger(hoverSound); // Scheduled by the mix thread, no audio command round trip
     }
 }
 
-// Plays selection confirmation sound with immediate replacement
+// Plays selection confirmation sound on the next voice of its pool
 // Used for menu selections, button presses, and confirmations
 void NavigationSounds::playSelect() {
-    if (soundsLoaded && selectSound.has_value()) {
-        selectSound->stop(); // Stop any currently playing select sound
-        selectSound->play(); // Start the new sound immediately
+    if (mixer && selectSound != UiSoundMixer::InvalidId) {
+        mixer->trigger(selectSound); // Scheduled by the mix thread, no audio command round trip
     }
 }
 
-// Plays back/return navigation sound with immediate replacement
+// Plays back/return navigation sound on the next voice of its pool
 // Used when returning to previous menus or canceling operations
 void NavigationSounds::playBack() {
-    if (soundsLoaded && backSound.has_value()) {
-        backSound->stop(); // Stop any currently playing back sound
-        backSound->play(); // Start the new sound immediately
+    if (mixer && backSound != UiSoundMixer::InvalidId) {
+        mixer->trigger(backSound); // Scheduled by the mix thread, no audio command round trip
     }
 }
 
-// Plays error sound for invalid actions with immediate replacement
+// Plays error sound for invalid actions on the next voice of its pool
 // Used for boundary conditions, invalid inputs, or failed operations
 void NavigationSounds::playError() {
-    if (soundsLoaded && errorSound.has_value()) {
-        errorSound->stop(); // Stop any currently playing error sound
-        errorSound->play(); // Start the new sound immediately
+    if (mixer && errorSound != UiSoundMixer::InvalidId) {
+        mixer->trigger(errorSound); // Scheduled by the mix thread, no audio command round trip
+    }
+}
+
+// Stamps the voices whose first sample the stream has reached (see UiSoundMixer::updateLatency)
+void NavigationSounds::updateLatency() {
+    if (mixer) mixer->updateLatency();
+}
+
+// Prints the trigger-to-playback latency the mixer measured this session
+// Measured against the stream's playing offset, so queued stream buffers are included
+void NavigationSounds::reportLatency() const {
+    if (!mixer || mixer->getMeasuredCount() == 0) return;
+    cout << "UI sound latency: " << mixer->getMeasuredCount() << " of "
+         << mixer->getTriggerCount() << " triggers measured, average "
+         << mixer->getAverageLatencyMicroseconds() / 1000.0f << " ms, max "
+         << mixer->getMaxLatencyMicroseconds() / 1000.0f << " ms, last "
+         << mixer->getLastLatencyMicroseconds() / 1000.0f << " ms (scheduling chunk "
+         << mixer->getChunkMicroseconds() / 1000.0f << " ms, "
+         << mixer->getStolenVoiceCount() << " voices stolen)" << endl;
+}
+
+//=== BACKGROUND MUSIC SELECTION ===
+// Track for each game state (string literals: the path travels to the music decoder thread)
+static const char* songForState(GameState state) {
+    if (state == INTRODUCTION) {
+        return "Sounds/PiecebyPiece.mp3";      // Introduction music
+    } else if (state == MENU) {
+        return "Sounds/PiecebyPiece.mp3";      // Menu music
+    } else if (state == PLAYING) {
+        return "Sounds/PiecebyPiece2.mp3";     // Level 1 music
+    } else if (state == PLAYING2) {
+        return "Sounds/PiecebyPiece2.mp3";     // Level 2 music
+    } else if (state == PLAYING3) {
+        return "Sounds/PiecebyPiece2.mp3";     // Level 3 music
     }
+    return "Sounds/PiecebyPiece.mp3";          // Fallback music
 }
 
 //=== MAIN APPLICATION ENTRY POINT ===
-// Central game loop handling all states and core application logic
-int main()
+// Central game loop: event processing, music and frame presentation
+// Per-state input, simulation and rendering live in the state objects (see StateMachine.h)
+// Command line: --bench [file] writes measurement records to file (default benchmark.jsonl)
+//               --stress [density] multiplies Level 3 traffic (default 100)
+//               --microbench runs the hitbox, particle and traffic flow micro-benchmarks and exits
+//                            (see HitboxBenchmark.h, ParticleBenchmark.h, TrafficBenchmark.h)
+//               --soak [minutes] drives Level 3 headless for that much simulated time (default 120)
+//                                and exits (see Level3Soak.h; honors --stress)
+//               --seed n sets the master random seed (default: random, or 1234 for --soak)
+int main(int argc, char* argv[])
 {
+    //=== COMMAND LINE ===
+    int trafficDensity = 1;
+    bool microbench = false;
+    float soakMinutes = 0.0f;
+    bool seedGiven = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--bench") == 0) {
+            const char* path = "benchmark.jsonl";
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0) {
+                path = argv[++i];
+            }
+            if (!benchmarkLog.open(path)) {
+                cerr << "Warning: Could not create benchmark log " << path << endl;
+            }
+        } else if (strcmp(argv[i], "--stress") == 0) {
+            trafficDensity = 100;
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0) {
+                trafficDensity = max(1, atoi(argv[++i]));
+            }
+        } else if (strcmp(argv[i], "--microbench") == 0) {
+            microbench = true;
+        } else if (strcmp(argv[i], "--soak") == 0) {
+            soakMinutes = 120.0f;
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0) {
+                soakMinutes = max(1.0f, static_cast<float>(atof(argv[++i])));
+            }
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            randomService.setMasterSeed(strtoull(argv[++i], nullptr, 10));
+            seedGiven = true;
+        }
+    }
+    if (microbench) {
+        int hitboxResult = runHitboxBenchmark();
+        int particleResult = runParticleBenchmark();
+        int trafficResult = runTrafficBenchmark();
+        if (hitboxResult != 0) return hitboxResult;
+        return particleResult != 0 ? particleResult : trafficResult;
+    }
+    if (soakMinutes > 0.0f) {
+        if (!seedGiven) randomService.setMasterSeed(1234);  // Soak runs compare across builds
+        return runLevel3Soak(soakMinutes, trafficDensity);
+    }
+
+    // Printed so a run can be replayed with --seed
+    cout << "Random seed: " << randomService.getMasterSeed() << endl;
+
     //=== WINDOW INITIALIZATION ===
     // Create the main application window in fullscreen mode
     // Uses desktop resolution for optimal display compatibility
     RenderWindow window(VideoMode::getDesktopMode(), "/Settings Puzzles/", Style::Default, State::Fullscreen);
 
-    //=== INPUT STATE TRACKING ===
-    // Static variable to track mouse button state for edge detection
-    static bool mouseLeftPressed = false;
+    //=== AUDIO THREAD STARTUP ===
+    // From here on the game only posts audio commands; the audio thread talks to the backend
+    audio.start();
 
-    //=== FONT SYSTEM INITIALIZATION ===
-    // Load the primary font for all menu text rendering
-    Font font("arial.ttf");
-
-    //=== AUDIO SYSTEM INITIALIZATION ===
-    // Initialize navigation sound system for UI feedback
-    navSounds.loadSounds();
-
-    //=== MAIN MENU CONFIGURATION ===
-    // Define the primary menu options available to the player
-    const vector<string> options = { "Start", "Settings", "Exit" };
-    int selected = 0;           // Index of the currently selected menu option
-    int previousSelected = -1;  // Track previous selection for hover sound logic
-    GameState state = INTRODUCTION;  // NEW: Start with introduction instead of MENU
-    
-    bool running = true;        // Controls the main game loop execution
-
-    //=== MENU TEXT OBJECTS PREPARATION ===
-    // Create and configure text objects for each menu option
-    vector<Text> menuTexts;
-    for (size_t i = 0; i < options.size(); ++i) {
-        Text t(font, options[i], 50);              // Create text with font and size
-        t.setStyle(Text::Italic | Text::Bold);     // Apply styling
-        t.setFillColor(Color::White);              // Set text color
-        
-        // Calculate text bounds for centering
-        auto bounds = t.getLocalBounds();
-        t.setOrigin(Vector2f(bounds.size.x / 2.f, bounds.size.y / 2.f));  // Center origin
-        
-        // Position text in center column with vertical spacing
-        t.setPosition(Vector2f(window.getSize().x / 2.f, window.getSize().y / 2.f + i * 80.f));
-        menuTexts.push_back(t);  // Add to menu text collection
+    //=== ASSET ARCHIVE MAPPING ===
+    // Map the packed archive once; every loader reads from it and falls back to loose files
+    if (!assetArchive.open("assets.pak")) {
+        cout << "No asset archive found, loading loose files" << endl;
     }
 
-    //=== TITLE TEXT CONFIGURATION ===
-    // Create and configure the main application title
-    Text title(font, "/Setting Puzzles/", 100);
-    title.setStyle(Text::Bold | Text::Underlined);  // Bold and underlined styling
-    title.setFillColor(Color::Blue);                // Blue color for distinction
-    
-    // Center title horizontally and position in upper portion of screen
-    auto titleBounds = title.getLocalBounds();
-    title.setOrigin(Vector2f(titleBounds.size.x / 2.f, titleBounds.size.y / 2.f));
-    title.setPosition(Vector2f(window.getSize().x / 2.f, window.getSize().y / 4.f));
+    //=== FONT SYSTEM INITIALIZATION ===
+    // Load the primary font for the persistent UI
+    // The font is cached by the resource manager and shared with every state
+    FontHandle fontHandle = resources.acquireFont("arial.ttf");
+    const Font& font = resources.get(fontHandle);
+
+    //=== STATE REGISTRATION ===
+    // One state object per screen; the state machine loads and unloads them on transitions
+    // Each pre-level screen preloads the level it leads to in the background
+    StateMachine states;
+    states.registerState(LOADING, createLoadingState());
+    states.registerState(INTRODUCTION, createIntroductionState());
+    states.registerState(MENU, createMenuState());
+    states.registerState(PRELEVEL1, createPreLevelState(PLAYING));
+    states.registerState(PLAYING, createPlayingState());
+    states.registerState(PRELEVEL2, createPreLevelState(PLAYING2));
+    states.registerState(PLAYING2, createPlayingState2());
+    states.registerState(PRELEVEL3, createPreLevelState(PLAYING3));
+    states.registerState(PLAYING3, createPlayingState3(trafficDensity));
+    states.registerState(SETTINGS, createSettingsState());
+    states.start(LOADING, window);  // Decode UI sounds, then continue to the introduction
 
     //=== PERSISTENT UI ELEMENTS ===
     // Create permanent F1 settings hint text visible on most screens
@@ -190,251 +336,120 @@ int main()
     settingsHint.setOrigin(Vector2f(hintBounds.size.x, 0)); // Right-aligned origin
     settingsHint.setPosition(Vector2f(window.getSize().x - 20.f, 20.f)); // Top-right with 20px padding
 
-    //=== MENU SELECTION INDICATOR ===
-    // Create a red circle to visually indicate the selected menu option
-    CircleShape selector(20.f);          // 20 pixel radius circle
-    selector.setFillColor(Color::Red);   // Red color for visibility
-
-    //=== INPUT STATE MANAGEMENT ===
-    // Track key press states to handle single key events and prevent key repeat
-    bool wPressed = false, sPressed = false, enterPressed = false, f1Pressed = false;
-
     //=== BACKGROUND MUSIC SYSTEM ===
     // Music variables declared outside loop to maintain state across frames
-    Music music;            // SFML Music object for background music
-    string currentSong;     // Track currently loaded song to prevent redundant loading
-
-    //=== EXTERNAL SETTINGS ACCESS ===
-    // Access the music volume setting from SettingsState for dynamic volume control
-    extern float musicVolume;
+    // Tracks are opened, decoded and crossfaded on the player's own decoder thread
+    MusicPlayer music;      // Streams silence until the first track fades in
+    string currentSong;     // Track currently requested song to prevent redundant requests
+    string prefetchedSong;  // Track last requested ahead of time
+    audio.play(music);
+    audioTelemetry.attachMusic(&music);
+
+    //=== AUDIO VOLUME SUBSCRIPTION ===
+    // Runs now and then only when the volume setting changes
+    // Sound effects use 80% of the music volume to maintain audio balance
+    SettingsSubscription volumeSubscription = settings.subscribe(SETTING_MUSIC_VOLUME,
+        [&music](const SettingsSnapshot& current, uint32_t) {
+            navSounds.soundVolume = current.musicVolume * 0.8f;  // Calculate sound effect volume
+            navSounds.updateVolume();                            // Apply volume changes
+            audio.setVolume(music, current.musicVolume);
+        });
+
+    //=== AUDIO TELEMETRY OVERLAY ===
+    // F3 toggles live audio statistics in the bottom-left corner
+    Text audioOverlay(font, "", 16);
+    audioOverlay.setFillColor(Color::White);
+    audioOverlay.setOutlineColor(Color::Black);
+    audioOverlay.setOutlineThickness(2.f);
+    bool audioOverlayVisible = false;
+
+    //=== FRAME TIMING ===
+    // One clock for every state: deltaTime is the time since the previous update
+    Clock frameClock;
 
     //=== MAIN APPLICATION LOOP ===
     // Primary game loop - continues until window is closed
     while (window.isOpen())
     {
         //=== EVENT PROCESSING SYSTEM ===
-        // Process all pending window events each frame
+        // Process all pending window events each frame; keyboard and mouse events build the
+        // input snapshot every state reads this frame
+        input.beginFrame();
         optional<Event> event;
         while ((event = window.pollEvent()))
         {
             if (event->is<Event::Closed>())
                 window.close(); // Close window if user requests exit
+            input.handleEvent(*event);
         }
 
-        //=== DYNAMIC AUDIO VOLUME MANAGEMENT ===
-        // Update sound effects volume based on current music volume setting
-        // Uses 80% of music volume for sound effects to maintain audio balance
-        extern float musicVolume;
-        navSounds.soundVolume = musicVolume * 0.8f; // Calculate sound effect volume
-        navSounds.updateVolume();                   // Apply volume changes
-
-        //=== MAIN MENU INPUT AND NAVIGATION ===
-        // Handle all menu interactions when in main menu state
-        if (state == MENU) {
-
-            //=== MOUSE POSITION TRACKING ===
-            // Get mouse position for hover detection and menu selection
-            Vector2i mousePosition = Mouse::getPosition(window);
-            Vector2f mousePos = window.mapPixelToCoords(mousePosition);
-
-            //=== MOUSE HOVER DETECTION SYSTEM ===
-            // Check if mouse is hovering over any menu item and play sound on change
-            for (size_t i = 0; i < menuTexts.size(); ++i) {
-                if (menuTexts[i].getGlobalBounds().contains(mousePos)) {
-                    if (selected != static_cast<int>(i)) {
-                        navSounds.playHover(); // Play hover sound when selection changes
-                    }
-                    selected = static_cast<int>(i);  // Update selected menu item
-                    break;  // Exit loop once hover target found
-                }
-            }
-
-            //=== MOUSE CLICK HANDLING SYSTEM ===
-            // Process left mouse button clicks for menu selection
-            bool isMouseLeftButtonPressed = Mouse::isButtonPressed(Mouse::Button::Left);
-            if (isMouseLeftButtonPressed && !mouseLeftPressed) {
-                mouseLeftPressed = true;        // Mark button as pressed
-                navSounds.playSelect();         // Play selection sound
-                
-                // Execute action based on selected menu item
-                switch (selected) {
-                case 0: state = PRELEVEL1; break;   // Start game (go to pre-level screen)
-                case 1: 
-                    previousState = MENU;           // Store current state
-                    state = SETTINGS;               // Open settings menu
-                    break;
-                case 2: state = EXIT; window.close(); break; // Exit application
-                }
-            }
-            else if (!isMouseLeftButtonPressed) {
-                mouseLeftPressed = false;  // Reset when button released
-            }
-
-            //=== KEYBOARD NAVIGATION SYSTEM ===
-            // Handle W key (up navigation) with sound feedback
-            if (Keyboard::isKeyPressed(Keyboard::Key::W)) {
-                if (!wPressed) {  // Edge detection to prevent key repeat
-                    // Move selection up with wraparound
-                    selected = (selected - 1 + static_cast<int>(options.size())) % static_cast<int>(options.size());
-                    navSounds.playHover(); // Play hover sound for keyboard navigation
-                    wPressed = true;       // Mark key as pressed
-                }
-            }
-            else {
-                wPressed = false;  // Reset when key released
-            }
-            
-            // Handle S key (down navigation) with sound feedback
-            if (Keyboard::isKeyPressed(Keyboard::Key::S)) {
-                if (!sPressed) {  // Edge detection to prevent key repeat
-                    // Move selection down with wraparound
-                    selected = (selected + 1) % static_cast<int>(options.size());
-                    navSounds.playHover(); // Play hover sound for keyboard navigation
-                    sPressed = true;       // Mark key as pressed
-                }
-            }
-            else {
-                sPressed = false;  // Reset when key released
-            }
-
-            //=== KEYBOARD SELECTION SYSTEM ===
-            // Handle ENTER key for menu item activation
-            if (Keyboard::isKeyPressed(Keyboard::Key::Enter)) {
-                if (!enterPressed) {  // Edge detection to prevent key repeat
-                    navSounds.playSelect(); // Play select sound
-                    
-                    // Execute action based on selected menu item
-                    switch (selected) {
-                    case 0: state = PRELEVEL1; break;   // Start game (go to pre-level screen)
-                    case 1: 
-                        previousState = MENU;           // Store current state
-                        state = SETTINGS;               // Open settings menu
-                        break;
-                    case 2: state = EXIT; window.close(); break; // Exit application
-                    }
-                    enterPressed = true;  // Mark key as pressed
-                }
-            }
-            else {
-                enterPressed = false;  // Reset when key released
-            }
-
-            //=== SETTINGS SHORTCUT SYSTEM ===
-            // Handle F1 key for direct settings access
-            if (Keyboard::isKeyPressed(Keyboard::Key::F1)) {
-                if (!f1Pressed) {  // Edge detection to prevent key repeat
-                    navSounds.playSelect();  // Play selection sound
-                    previousState = MENU;    // Store current state
-                    state = SETTINGS;        // Open settings menu
-                    f1Pressed = true;        // Mark key as pressed
-                }
-            }
-            else {
-                f1Pressed = false;  // Reset when key released
-            }
+        //=== STATE UPDATE ===
+        // Input and simulation of the active state, including any transition it requests
+        float deltaTime = frameClock.restart().asSeconds();
+        GameState updatedState = states.getCurrent();
+        states.update(window, deltaTime);
+        if (states.getCurrent() != updatedState) {
+            frameClock.restart();  // Load/enter time of the new state does not count as a frame
         }
+        if (!window.isOpen()) {
+            break;                 // Exit was chosen from the menu
+        }
+        GameState state = states.getCurrent();
 
         //=== DYNAMIC BACKGROUND MUSIC SYSTEM ===
         // Handle music changes based on current game state for immersive experience
-        string desiredSong;
-
-        // Select appropriate background music for each game state
-        if (state == INTRODUCTION) {
-            desiredSong = "Sounds/PiecebyPiece.mp3";      // Introduction music
-        } else if (state == MENU) {
-            desiredSong = "Sounds/PiecebyPiece.mp3";      // Menu music
-        } else if (state == PLAYING) {
-            desiredSong = "Sounds/PiecebyPiece2.mp3";     // Level 1 music
-        } else if (state == PLAYING2) {
-            desiredSong = "Sounds/PiecebyPiece2.mp3";     // Level 2 music
-        } else if (state == PLAYING3) {
-            desiredSong = "Sounds/PiecebyPiece2.mp3";     // Level 3 music
-        } else {
-            desiredSong = "Sounds/PiecebyPiece.mp3";      // Fallback music
+        const char* desiredSong = songForState(state);
+
+        // Open and pre-buffer the next state's track as soon as it is known (pre-level
+        // screens lead to a level; while loading, the introduction track is fetched)
+        optional<GameState> upcoming = states.getUpcoming();
+        const char* upcomingSong = upcoming ? songForState(*upcoming) : desiredSong;
+        if (upcomingSong != prefetchedSong) {
+            music.prefetch(upcomingSong);
+            prefetchedSong = upcomingSong;
         }
 
         // Change music only when transitioning to different song
-        if (desiredSong != currentSong) {
-            // Stop currently playing music
-            if (music.getStatus() == Music::Status::Playing)
-                music.stop();
-                
-            // Attempt to load and play new music
-            if (music.openFromFile(desiredSong)) {
-                music.setLooping(true);           // Enable continuous looping
-                music.setVolume(musicVolume);     // Apply current volume setting
-                music.play();                     // Start playback
-                currentSong = desiredSong;        // Update current song tracking
-            } else {
-                std::cerr << "Failed to load " << desiredSong << std::endl;
-                currentSong.clear();              // Clear on failure
-            }
+        // (the loading screen stays silent; the fetched track fades in with the introduction)
+        if (state != LOADING && desiredSong != currentSong) {
+            music.crossfadeTo(desiredSong);       // Gapless: fades from whatever is playing
+            currentSong = desiredSong;            // Update current song tracking
         }
 
-        // Update volume if music is playing (handles real-time volume changes)
-        if (music.getStatus() == Music::Status::Playing) {
-            music.setVolume(musicVolume);
+        //=== AUDIO TELEMETRY ===
+        // Sampled after the frame's audio commands were posted; every closed window goes to
+        // the overlay and, with --bench, to the benchmark log
+        if (input.wasPressed(Keyboard::Key::F3)) {
+            audioOverlayVisible = !audioOverlayVisible;
+        }
+        navSounds.updateLatency();
+        if (audioTelemetry.sample(deltaTime)) {
+            audioOverlay.setString(audioTelemetry.formatOverlay());
+            audioOverlay.setPosition(Vector2f(20.f, window.getSize().y - audioOverlay.getLocalBounds().size.y - 30.f));
+            benchmarkLog.write(audioTelemetry.toJson());
         }
 
-        //=== FRAME RENDERING PREPARATION ===
+        //=== STATE RENDERING ===
         window.clear(); // Clear the window for new frame rendering
-
-        //=== STATE-BASED RENDERING SYSTEM ===
-        // Render appropriate content based on current game state
-        if (state == INTRODUCTION) {
-            // NEW: Show introduction screen explaining the game's purpose
-            handleIntroductionState(window, running, state);
-        }
-        else if (state == MENU) {
-            //=== MAIN MENU RENDERING ===
-            // Draw title and all menu options
-            window.draw(title);                    // Application title
-            for (size_t i = 0; i < menuTexts.size(); ++i) {
-                window.draw(menuTexts[i]);         // Individual menu items
-            }
-            
-            // Draw selection indicator next to selected option
-            Vector2f pos = menuTexts[selected].getPosition();
-            selector.setPosition(Vector2f(pos.x - 200.f, pos.y - 8.f));  // Position left of text
-            window.draw(selector);             // Red circle indicator
-        }
-        else if (state == PRELEVEL1) {
-            // Show pre-level screen for level 1
-            handlePreLevelState(window, running, state, PLAYING);
-        }
-        else if (state == PLAYING) {
-            // Delegate to the scrolling text state handler
-            handlePlayingState(window, running, state);
-        }
-        else if (state == PRELEVEL2) {
-            // Show pre-level screen for level 2
-            handlePreLevelState(window, running, state, PLAYING2);
-        }
-        else if (state == PLAYING2) {
-            // Delegate to the maze game state handler
-            handlePlayingState2(window, running, state);
-        }
-        else if (state == PRELEVEL3) {
-            // Show pre-level screen for level 3
-            handlePreLevelState(window, running, state, PLAYING3);
-        }
-        else if (state == PLAYING3) {
-            // Delegate to the driving game state handler
-            handlePlayingState3(window, running, state);
-        }
-        else if (state == SETTINGS) {
-            // Delegate to the settings state handler
-            handleSettingsState(window, running, state);
-        }
+        states.draw(window);
 
         //=== PERSISTENT UI OVERLAY ===
-        // Draw the permanent settings hint on all states except settings menu and introduction
-        if (state != SETTINGS && state != INTRODUCTION) {
+        // Draw the permanent settings hint on all states except settings menu, loading and introduction
+        if (state != SETTINGS && state != INTRODUCTION && state != LOADING) {
             window.draw(settingsHint);  // F1 - Settings hint
         }
+        if (audioOverlayVisible) {
+            window.draw(audioOverlay);
+        }
 
         //=== FRAME PRESENTATION ===
         window.display(); // Present completed frame to screen
     }
+
+    //=== AUDIO SHUTDOWN ===
+    // Apply the last commands and stop the audio thread while the music and states still exist
+    audio.shutdown();
+    audioTelemetry.attachMusic(nullptr);  // The player is destroyed with this scope
+    navSounds.reportLatency();
     return 0;  // Successful application termination
 }
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include "FastCodec.h"
+#include <cstring>
+
+using namespace std;
+
+namespace {
+    constexpr size_t MinMatch = 4;            // Shortest back-reference worth encoding
+    constexpr size_t MaxOffset = 65535;       // Limited by the 2-byte offset field
+    constexpr size_t HashBits = 16;           // 64K-entry position table
+    constexpr size_t LastLiterals = 5;        // Tail always stored as literals (keeps reads in bounds)
+
+    uint32_t read32(const uint8_t* p) {
+        uint32_t value;
+        memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    uint32_t hashSequence(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - HashBits);  // Knuth multiplicative hash
+    }
+
+    // Appends a length using the 255-byte continuation scheme
+    void writeExtraLength(vector<uint8_t>& out, size_t length) {
+        while (length >= 255) {
+            out.push_back(255);
+            length -= 255;
+        }
+        out.push_back(static_cast<uint8_t>(length));
+    }
+
+    void writeSequence(vector<uint8_t>& out, const uint8_t* literals, size_t literalCount,
+                       size_t offset, size_t matchLength) {
+        size_t matchCode = matchLength >= MinMatch ? matchLength - MinMatch : 0;
+        uint8_t token = static_cast<uint8_t>((min<size_t>(literalCount, 15) << 4) | min<size_t>(matchCode, 15));
+        out.push_back(token);
+        if (literalCount >= 15) {
+            writeExtraLength(out, literalCount - 15);
+        }
+        out.insert(out.end(), literals, literals + literalCount);
+
+        if (matchLength == 0) {
+            return;  // Last sequence: literals only
+        }
+        out.push_back(static_cast<uint8_t>(offset & 0xFF));
+        out.push_back(static_cast<uint8_t>(offset >> 8));
+        if (matchCode >= 15) {
+            writeExtraLength(out, matchCode - 15);
+        }
+    }
+
+    // Reads a 255-continued length; returns false on truncated input
+    bool readExtraLength(const uint8_t*& in, const uint8_t* end, size_t& length) {
+        uint8_t byte;
+        do {
+            if (in >= end) {
+                return false;
+            }
+            byte = *in++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+}
+
+//=== COMPRESSION ===
+vector<uint8_t> FastCodec::compress(const uint8_t* source, size_t sourceSize) {
+    vector<uint8_t> out;
+    out.reserve(sourceSize / 2 + 16);
+
+    vector<uint32_t> table(size_t(1) << HashBits, 0);   // Position + 1 of the last occurrence (0 = empty)
+    size_t anchor = 0;                                  // Start of pending literals
+    size_t position = 0;
+    size_t matchLimit = sourceSize > LastLiterals + MinMatch ? sourceSize - LastLiterals : 0;
+
+    while (position + MinMatch <= matchLimit) {
+        uint32_t sequence = read32(source + position);
+        uint32_t& slot = table[hashSequence(sequence)];
+        size_t candidate = slot;
+        slot = static_cast<uint32_t>(position + 1);
+
+        // Need a real earlier match within offset range
+        if (candidate == 0 || position - (candidate - 1) > MaxOffset ||
+            read32(source + candidate - 1) != sequence) {
+            position++;
+            continue;
+        }
+        candidate--;
+
+        //=== MATCH EXTENSION ===
+        size_t length = MinMatch;
+        while (position + length < matchLimit && source[candidate + length] == source[position + length]) {
+            length++;
+        }
+
+        writeSequence(out, source + anchor, position - anchor, position - candidate, length);
+        position += length;
+        anchor = position;
+    }
+
+    writeSequence(out, source + anchor, sourceSize - anchor, 0, 0);
+    return out;
+}
+
+//=== DECOMPRESSION ===
+bool FastCodec::decompress(const uint8_t* source, size_t sourceSize, uint8_t* destination, size_t destinationSize) {
+    const uint8_t* in = source;
+    const uint8_t* inEnd = source + sourceSize;
+    uint8_t* out = destination;
+    uint8_t* outEnd = destination + destinationSize;
+
+    while (in < inEnd) {
+        uint8_t token = *in++;
+
+        //=== LITERAL RUN ===
+        size_t literalCount = token >> 4;
+        if (literalCount == 15 && !readExtraLength(in, inEnd, literalCount)) {
+            return false;
+        }
+        if (literalCount > static_cast<size_t>(inEnd - in) || literalCount > static_cast<size_t>(outEnd - out)) {
+            return false;
+        }
+        memcpy(out, in, literalCount);
+        in += literalCount;
+        out += literalCount;
+
+        if (in == inEnd) {
+            break;  // Last sequence has no match part
+        }
+
+        //=== BACK-REFERENCE ===
+        if (inEnd - in < 2) {
+            return false;
+        }
+        size_t offset = static_cast<size_t>(in[0]) | (static_cast<size_t>(in[1]) << 8);
+        in += 2;
+
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !readExtraLength(in, inEnd, matchLength)) {
+            return false;
+        }
+        matchLength += MinMatch;
+
+        if (offset == 0 || offset > static_cast<size_t>(out - destination) ||
+            matchLength > static_cast<size_t>(outEnd - out)) {
+            return false;
+        }
+
+        // Overlapping copies (offset < length) repeat the pattern, so copy forwards bytewise;
+        // non-overlapping matches take the memcpy path
+        const uint8_t* match = out - offset;
+        if (offset >= matchLength) {
+            memcpy(out, match, matchLength);
+            out += matchLength;
+        } else {
+            for (size_t i = 0; i < matchLength; ++i) {
+                *out++ = match[i];
+            }
+        }
+    }
+
+    return out == outEnd;
+}
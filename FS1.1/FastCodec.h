@@ -0,0 +1,28 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+//=== FAST BLOCK CODEC ===
+// Byte-oriented LZ77 codec in the style of LZ4, used for the decoded-asset cache
+// - Compression is greedy with a single hash probe per position (fast, modest ratio)
+// - Decompression is a tight copy loop: literal runs and back-references only,
+//   so it runs close to memcpy speed
+//
+// Block layout: a series of sequences, each
+//   token            - high nibble: literal count, low nibble: match length - MinMatch
+//   [extra lengths]  - 255-byte continuation bytes when a nibble is 15
+//   literals         - raw bytes
+//   offset           - 2 bytes little-endian back-reference distance (absent in the last sequence)
+//   [extra lengths]  - continuation bytes for the match length
+// The final sequence carries only literals
+namespace FastCodec {
+    // Compress a buffer into a new block
+    vector<uint8_t> compress(const uint8_t* source, size_t sourceSize);
+
+    // Decompress a block into a buffer of exactly destinationSize bytes
+    // Returns: false if the block is malformed or does not produce destinationSize bytes
+    bool decompress(const uint8_t* source, size_t sourceSize, uint8_t* destination, size_t destinationSize);
+}
@@ -6,6 +6,13 @@
 // States are used to control game flow, rendering, input handling, and transitions
 
 enum GameState {
+    //=== LOADING STATE ===
+    // Startup progress screen shown while the UI sounds are decoded on worker threads
+    // Features: Progress bar, asset counter
+    // Purpose: Keep the window responsive while the navigation sounds are preloaded
+    // Transition: To INTRODUCTION (automatically, once the sounds are resident)
+    LOADING,
+
     //=== INTRODUCTION STATE ===
     // Initial game introduction screen explaining the purpose and concept
     // Features: Game overview, narrative setup, continue prompt
@@ -80,11 +87,12 @@ enum GameState {
 //=== STATE MACHINE NOTES ===
 // 
 // State Flow Overview:
-// INTRODUCTION ? MENU ? PRELEVEL1 ? PLAYING ? PRELEVEL2 ? PLAYING2 ? PRELEVEL3 ? PLAYING3 ? MENU
+// LOADING ? INTRODUCTION ? MENU ? PRELEVEL1 ? PLAYING ? PRELEVEL2 ? PLAYING2 ? PRELEVEL3 ? PLAYING3 ? MENU
 //     ?            ?                                                                           ?
 // SETTINGS ???????????????????????????????????????????????????????????????????????????????????
 //
 // Key Design Principles:
+// - LOADING preloads the UI sounds; each PRELEVEL screen preloads its level in the background
 // - INTRODUCTION provides initial context and game overview for new players
 // - Each state is self-contained with specific responsibilities
 // - PRELEVEL states provide smooth transitions and player preparation
@@ -99,12 +107,15 @@ enum GameState {
 // - ESC key in PLAYING3 returns to PRELEVEL3 (allows level restart/instruction review)
 // - This provides players with easy access to instructions without losing progress
 //
-// State Persistence:
-// - Static variables in each state handler maintain state between frames
-// - Game data (scores, progress) is preserved during state transitions
+// State Lifecycle (see GameStateHandler.h and StateMachine.h):
+// - Each state is an object: load/unload manage its assets, enter/exit bracket each visit
+// - Only the active state (plus the level its pre-level screen leads to) stays loaded
+// - SETTINGS is an overlay: the calling state stays loaded and resumes where it left off
 // - Settings changes are applied globally and persist across state changes
 //
 // Thread Safety:
-// - Single-threaded design with frame-based state processing
+// - Frame-based state processing on the main thread
+// - Only asset decoding (LOADING, PRELEVEL preloads) runs on worker threads; results are
+//   registered on the main thread
 // - State changes occur at frame boundaries for consistency
 // - No concurrent state access or modification
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <optional>
+#include "GameState.h"
+#include "AssetLoader.h"
+
+using namespace sf;
+using namespace std;
+
+//=== GAME STATE HANDLER INTERFACE ===
+// Base class for every screen of the game (one object per GameState value)
+// The StateMachine drives the hooks in this order:
+//
+//   queueAssets -> load -> enter -> (update, draw)* -> exit -> unload
+//
+// - queueAssets/load/unload manage resources: a state only holds textures, sound
+//   buffers and music while it is loaded, so resident memory follows the active state
+// - enter/exit bracket each visit: enter resets per-visit values (timers, run state),
+//   exit stops anything still playing
+// - update reads the frame's input snapshot (see Input.h), runs the simulation and requests
+//   a transition by writing to state; draw only renders (the main loop clears and presents
+//   the frame)
+class GameStateHandler {
+public:
+    virtual ~GameStateHandler() = default;
+
+    //=== RESOURCE LIFECYCLE ===
+    // Queue textures and sound buffers for background decoding (see getPreloadTarget)
+    virtual void queueAssets(AssetLoader& loader) {}
+
+    // Acquire every resource the state uses (cache hits when the assets were preloaded)
+    virtual void load(RenderWindow& window) {}
+
+    // Release all resources acquired in load()
+    virtual void unload() {}
+
+    //=== ACTIVATION LIFECYCLE ===
+    virtual void enter(RenderWindow& window) {}
+    virtual void exit() {}
+
+    //=== FRAME HOOKS ===
+    // deltaTime: seconds since the previous frame
+    virtual void update(RenderWindow& window, float deltaTime, GameState& state) = 0;
+    virtual void draw(RenderWindow& window) = 0;
+
+    //=== PRELOAD HINT ===
+    // State whose assets should decode in the background while this state is shown
+    // (pre-level screens return their level, so starting it needs no loading frame)
+    virtual optional<GameState> getPreloadTarget() const { return nullopt; }
+};
@@ -0,0 +1,114 @@
+#include "HitboxBenchmark.h"
+#include "HitboxKernel.h"
+#include "BenchmarkTable.h"
+#include "Random.h"
+#include <SFML/Graphics.hpp>
+#include <iostream>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+//=== LEGACY HITBOX FUNCTIONS ===
+// Reproduced from the former Level 3 helpers to serve as the baseline
+
+// Hitbox reduced to sizeMultiplier of the shape's bounds, centered within them
+static FloatRect getHitboxBounds(const RectangleShape& shape, float sizeMultiplier) {
+    FloatRect shapeBounds = shape.getGlobalBounds();
+    float reducedWidth = shapeBounds.size.x * sizeMultiplier;
+    float reducedHeight = shapeBounds.size.y * sizeMultiplier;
+    float offsetX = (shapeBounds.size.x - reducedWidth) / 2.0f;
+    float offsetY = (shapeBounds.size.y - reducedHeight) / 2.0f;
+    return FloatRect(
+        Vector2f(shapeBounds.position.x + offsetX, shapeBounds.position.y + offsetY),
+        Vector2f(reducedWidth, reducedHeight)
+    );
+}
+
+static bool checkCollision(const RectangleShape& rect1, const RectangleShape& rect2, float sizeMultiplier1, float sizeMultiplier2) {
+    FloatRect bounds1 = getHitboxBounds(rect1, sizeMultiplier1);
+    FloatRect bounds2 = getHitboxBounds(rect2, sizeMultiplier2);
+    return bounds1.findIntersection(bounds2).has_value();
+}
+
+//=== TIMING ===
+
+// Nanoseconds per box of one test (repeated for 0.2 seconds)
+// hits receives the hit count of one run
+template <typename Test>
+static double timePerBox(size_t count, size_t& hits, Test test) {
+    return timeRepeated([&]() { hits = test(); }) * 1.0e9 / count;
+}
+
+//=== BENCHMARK ===
+
+int runHitboxBenchmark() {
+    const float PLAYER_HITBOX_SIZE = 1.0f;      // Level 3 tuning
+    const float OBSTACLE_HITBOX_SIZE = 0.7f;
+    const size_t sizes[] = { 16, 256, 4096 };
+    Pcg32 gen(1234);  // Fixed layout: runs are comparable
+    bool agreed = true;
+
+    cout << "Hitbox overlap micro-benchmark (vector path: " << overlapBatchPath() << ")" << endl;
+    cout << "  boxes   legacy ns/box   scalar ns/box   batch ns/box   hits" << endl;
+
+    for (size_t count : sizes) {
+        // Traffic scattered over a 1920x1080 road around the player; denser with more cars
+        uniform_real_distribution<float> xDist(0.0f, 1920.0f);
+        uniform_real_distribution<float> yDist(0.0f, 1080.0f);
+        RectangleShape player(Vector2f(30, 50));
+        player.setOrigin(Vector2f(15, 25));
+        player.setPosition(Vector2f(960.0f, 540.0f));
+
+        vector<RectangleShape> shapes(count, RectangleShape(Vector2f(40, 40)));
+        vector<float> minX(count), minY(count), maxX(count), maxY(count);
+        for (size_t i = 0; i < count; ++i) {
+            shapes[i].setOrigin(Vector2f(20, 20));
+            shapes[i].setPosition(Vector2f(xDist(gen), yDist(gen)));
+            FloatRect box = getHitboxBounds(shapes[i], OBSTACLE_HITBOX_SIZE);
+            minX[i] = box.position.x;
+            minY[i] = box.position.y;
+            maxX[i] = box.position.x + box.size.x;
+            maxY[i] = box.position.y + box.size.y;
+        }
+        FloatRect playerBox = getHitboxBounds(player, PLAYER_HITBOX_SIZE);
+        float playerMinX = playerBox.position.x;
+        float playerMinY = playerBox.position.y;
+        float playerMaxX = playerBox.position.x + playerBox.size.x;
+        float playerMaxY = playerBox.position.y + playerBox.size.y;
+        HitboxArrays boxes = { minX.data(), minY.data(), maxX.data(), maxY.data(), count };
+        vector<uint32_t> mask(hitMaskWords(count));
+
+        size_t legacyHits = 0, scalarHits = 0, batchHits = 0;
+        double legacy = timePerBox(count, legacyHits, [&]() {
+            size_t hits = 0;
+            for (const RectangleShape& shape : shapes) {
+                hits += checkCollision(player, shape, PLAYER_HITBOX_SIZE, OBSTACLE_HITBOX_SIZE) ? 1 : 0;
+            }
+            return hits;
+        });
+        double scalar = timePerBox(count, scalarHits, [&]() {
+            return overlapBatchScalar(playerMinX, playerMinY, playerMaxX, playerMaxY, boxes, mask.data());
+        });
+        double batch = timePerBox(count, batchHits, [&]() {
+            return overlapBatch(playerMinX, playerMinY, playerMaxX, playerMaxY, boxes, mask.data());
+        });
+        bool match = legacyHits == scalarHits && scalarHits == batchHits;
+        agreed = agreed && match;
+
+        BenchmarkRow row("hitbox");
+        row.column("boxes", count, 7);
+        row.text("path", overlapBatchPath());
+        row.column("legacy_ns_per_box", legacy, 13);
+        row.column("scalar_ns_per_box", scalar, 13);
+        row.column("batch_ns_per_box", batch, 12);
+        row.column("hits", batchHits, 4);
+        row.flag("match", match);
+        if (!match) {
+            row.note() << " (MISMATCH: legacy " << legacyHits << ", scalar " << scalarHits << ")";
+        }
+        row.write();
+    }
+
+    return agreed ? 0 : 1;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+using namespace std;
+
+//=== HITBOX MICRO-BENCHMARK ===
+// Times the Level 3 player-versus-traffic overlap test three ways for several traffic sizes:
+// - "legacy": per-pair hitbox bounds from the shapes' transforms plus FloatRect intersection
+//   (how Level 3 tested collisions before the car store)
+// - "scalar": overlapBatchScalar over cached min/max arrays
+// - "batch": overlapBatch (the vector path compiled into this build)
+// Prints a table to the console and writes one "hitbox" record per size to the benchmark log
+// Run with --microbench; no window or audio is created
+// Returns: process exit code (non-zero if the paths disagree on a hit count)
+int runHitboxBenchmark();
@@ -0,0 +1,134 @@
+#include "HitboxKernel.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#if defined(__AVX__)
+#define HITBOX_KERNEL_AVX 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HITBOX_KERNEL_SSE 1
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+//=== SCALAR KERNEL ===
+
+// Set bits in a lane mask (at most 8)
+static size_t countBits(uint32_t bits) {
+    size_t count = 0;
+    for (; bits; bits &= bits - 1) {
+        count++;
+    }
+    return count;
+}
+
+// Boxes [first, count) one at a time
+static size_t overlapRange(float minX, float minY, float maxX, float maxY, const HitboxArrays& boxes, size_t first, uint32_t* mask) {
+    size_t hits = 0;
+    for (size_t i = first; i < boxes.count; ++i) {
+        bool hit = boxes.minX[i] < maxX && boxes.maxX[i] > minX && boxes.minY[i] < maxY && boxes.maxY[i] > minY;
+        if (hit) {
+            mask[i / 32] |= 1u << (i % 32);
+            hits++;
+        }
+    }
+    return hits;
+}
+
+size_t overlapBatchScalar(float minX, float minY, float maxX, float maxY, const HitboxArrays& boxes, uint32_t* mask) {
+    memset(mask, 0, hitMaskWords(boxes.count) * sizeof(uint32_t));
+    return overlapRange(minX, minY, maxX, maxY, boxes, 0, mask);
+}
+
+//=== VECTOR KERNEL ===
+// Four comparisons per lane, ANDed; movemask turns the lanes into mask bits
+// (a step never straddles a mask word: 32 is a multiple of both widths)
+
+size_t overlapBatch(float minX, float minY, float maxX, float maxY, const HitboxArrays& boxes, uint32_t* mask) {
+    memset(mask, 0, hitMaskWords(boxes.count) * sizeof(uint32_t));
+    size_t i = 0;
+    size_t hits = 0;
+
+#if defined(HITBOX_KERNEL_AVX)
+    const __m256 queryMinX = _mm256_set1_ps(minX);
+    const __m256 queryMinY = _mm256_set1_ps(minY);
+    const __m256 queryMaxX = _mm256_set1_ps(maxX);
+    const __m256 queryMaxY = _mm256_set1_ps(maxY);
+    for (; i + 8 <= boxes.count; i += 8) {
+        __m256 overlap = _mm256_and_ps(
+            _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(boxes.minX + i), queryMaxX, _CMP_LT_OQ),
+                          _mm256_cmp_ps(_mm256_loadu_ps(boxes.maxX + i), queryMinX, _CMP_GT_OQ)),
+            _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(boxes.minY + i), queryMaxY, _CMP_LT_OQ),
+                          _mm256_cmp_ps(_mm256_loadu_ps(boxes.maxY + i), queryMinY, _CMP_GT_OQ)));
+        uint32_t bits = static_cast<uint32_t>(_mm256_movemask_ps(overlap));
+        if (bits) {
+            mask[i / 32] |= bits << (i % 32);
+            hits += countBits(bits);
+        }
+    }
+#elif defined(HITBOX_KERNEL_SSE)
+    const __m128 queryMinX = _mm_set1_ps(minX);
+    const __m128 queryMinY = _mm_set1_ps(minY);
+    const __m128 queryMaxX = _mm_set1_ps(maxX);
+    const __m128 queryMaxY = _mm_set1_ps(maxY);
+    for (; i + 4 <= boxes.count; i += 4) {
+        __m128 overlap = _mm_and_ps(
+            _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(boxes.minX + i), queryMaxX),
+                       _mm_cmpgt_ps(_mm_loadu_ps(boxes.maxX + i), queryMinX)),
+            _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(boxes.minY + i), queryMaxY),
+                       _mm_cmpgt_ps(_mm_loadu_ps(boxes.maxY + i), queryMinY)));
+        uint32_t bits = static_cast<uint32_t>(_mm_movemask_ps(overlap));
+        if (bits) {
+            mask[i / 32] |= bits << (i % 32);
+            hits += countBits(bits);
+        }
+    }
+#endif
+
+    return hits + overlapRange(minX, minY, maxX, maxY, boxes, i, mask);
+}
+
+//=== SWEPT TEST ===
+
+// Times at which b's interval is inside a's along one axis (open intervals, like overlapBatch)
+// Returns: false if they never overlap on this axis
+static bool sweepAxis(float aMin, float aMax, float bMin, float bMax, float move, float& entry, float& exit) {
+    // Offsets of b that overlap a: aMin - bMax < offset < aMax - bMin
+    float low = aMin - bMax;
+    float high = aMax - bMin;
+    if (move == 0.0f) {
+        entry = -numeric_limits<float>::infinity();
+        exit = numeric_limits<float>::infinity();
+        return low < 0.0f && 0.0f < high;  // Static on this axis: overlapping all step or never
+    }
+    entry = min(low / move, high / move);
+    exit = max(low / move, high / move);
+    return true;
+}
+
+bool sweptOverlap(float aMinX, float aMinY, float aMaxX, float aMaxY,
+                  float bMinX, float bMinY, float bMaxX, float bMaxY,
+                  float moveX, float moveY, float& time) {
+    float entryX, exitX, entryY, exitY;
+    if (!sweepAxis(aMinX, aMaxX, bMinX, bMaxX, moveX, entryX, exitX)) return false;
+    if (!sweepAxis(aMinY, aMaxY, bMinY, bMaxY, moveY, entryY, exitY)) return false;
+
+    // Boxes overlap while both axes do
+    float entry = max(entryX, entryY);
+    float exit = min(exitX, exitY);
+    if (entry >= exit || entry > 1.0f || exit <= 0.0f) return false;
+    time = max(entry, 0.0f);
+    return true;
+}
+
+const char* overlapBatchPath() {
+#if defined(HITBOX_KERNEL_AVX)
+    return "AVX";
+#elif defined(HITBOX_KERNEL_SSE)
+    return "SSE";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+//=== HITBOX ARRAYS ===
+// Axis-aligned boxes as four packed float arrays (structure-of-arrays), e.g. CarStore's cached hitboxes
+struct HitboxArrays {
+    const float* minX;
+    const float* minY;
+    const float* maxX;
+    const float* maxY;
+    size_t count;
+};
+
+//=== BATCH OVERLAP KERNEL ===
+// Tests one box against every box of an array and writes a hit mask:
+// bit (i % 32) of mask[i / 32] is set when box i overlaps (open intervals, touching edges miss)
+// - mask must hold hitMaskWords(boxes.count) words; bits past count are cleared
+// - Vectorized with AVX (8 boxes per step) when the build enables it, SSE (4 per step) on
+//   every x86/x64 build, scalar elsewhere and for the tail
+// Returns: number of overlapping boxes
+size_t overlapBatch(float minX, float minY, float maxX, float maxY, const HitboxArrays& boxes, uint32_t* mask);
+
+// Same result without vector instructions (reference and fallback)
+size_t overlapBatchScalar(float minX, float minY, float maxX, float maxY, const HitboxArrays& boxes, uint32_t* mask);
+
+// Continuous (swept) test of two boxes over one step, both given at the start of the step:
+// box b moves by (moveX, moveY) relative to box a (b's displacement minus a's)
+// Catches boxes that pass through each other between the start and end positions
+// Returns: true if they overlap at some time in [0, 1]; time receives the first such time
+//          (0 when they already overlap at the start)
+bool sweptOverlap(float aMinX, float aMinY, float aMaxX, float aMaxY,
+                  float bMinX, float bMinY, float bMaxX, float bMaxY,
+                  float moveX, float moveY, float& time);
+
+// Mask words needed for count boxes
+inline size_t hitMaskWords(size_t count) { return (count + 31) / 32; }
+
+// Name of the vector path compiled into overlapBatch ("AVX", "SSE" or "scalar")
+const char* overlapBatchPath();
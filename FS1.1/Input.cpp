@@ -0,0 +1,63 @@
+#include "Input.h"
+
+using namespace sf;
+using namespace std;
+
+//=== FRAME UPDATE ===
+
+void InputSnapshot::beginFrame() {
+    keysPressed.reset();
+    keysReleased.reset();
+    buttonsPressed.reset();
+    buttonsReleased.reset();
+}
+
+void InputSnapshot::handleEvent(const Event& event) {
+    if (const auto* key = event.getIf<Event::KeyPressed>()) {
+        press(key->code);
+    } else if (const auto* key = event.getIf<Event::KeyReleased>()) {
+        release(key->code);
+    } else if (const auto* mouse = event.getIf<Event::MouseButtonPressed>()) {
+        size_t index = static_cast<size_t>(mouse->button);
+        if (index < Mouse::ButtonCount && !buttonsDown[index]) {
+            buttonsDown[index] = true;
+            buttonsPressed[index] = true;
+        }
+        mousePosition = mouse->position;
+    } else if (const auto* mouse = event.getIf<Event::MouseButtonReleased>()) {
+        size_t index = static_cast<size_t>(mouse->button);
+        if (index < Mouse::ButtonCount && buttonsDown[index]) {
+            buttonsDown[index] = false;
+            buttonsReleased[index] = true;
+        }
+        mousePosition = mouse->position;
+    } else if (const auto* mouse = event.getIf<Event::MouseMoved>()) {
+        mousePosition = mouse->position;
+    } else if (event.is<Event::FocusLost>()) {
+        releaseAll();
+    }
+}
+
+//=== EDGES ===
+
+// Repeats of a held key arrive as more KeyPressed events: only the first one presses
+void InputSnapshot::press(Keyboard::Key key) {
+    size_t index = static_cast<size_t>(key);
+    if (index >= Keyboard::KeyCount || keysDown[index]) return;
+    keysDown[index] = true;
+    keysPressed[index] = true;
+}
+
+void InputSnapshot::release(Keyboard::Key key) {
+    size_t index = static_cast<size_t>(key);
+    if (index >= Keyboard::KeyCount || !keysDown[index]) return;
+    keysDown[index] = false;
+    keysReleased[index] = true;
+}
+
+void InputSnapshot::releaseAll() {
+    keysReleased |= keysDown;
+    keysDown.reset();
+    buttonsReleased |= buttonsDown;
+    buttonsDown.reset();
+}
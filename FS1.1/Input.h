@@ -0,0 +1,64 @@
+#pragma once
+#include <SFML/Window.hpp>
+#include <bitset>
+#include <cstddef>
+
+using namespace sf;
+using namespace std;
+
+//=== INPUT SNAPSHOT CLASS DECLARATION ===
+// Keyboard and mouse state for the current frame, built from window events instead of polling
+// - main() calls beginFrame() and then handleEvent() for every event; states only read
+// - isDown: held now. wasPressed / wasReleased: the edge happened since the previous frame,
+//   so a tap shorter than one frame still counts (pressed and released both set)
+// - Key repeat events are ignored: a held key presses once, and a key already held when a
+//   state is entered does not press in that state
+// - Losing focus releases everything (the window gets no release events while unfocused)
+// One bitset per edge: a frame costs a few word clears however many keys are read
+// Main thread only
+class InputSnapshot {
+public:
+    InputSnapshot() = default;
+
+    InputSnapshot(const InputSnapshot&) = delete;
+    InputSnapshot& operator=(const InputSnapshot&) = delete;
+
+    //=== FRAME UPDATE (main loop) ===
+    // Clear the previous frame's edges (held keys stay held)
+    void beginFrame();
+    void handleEvent(const Event& event);
+
+    //=== KEYBOARD ===
+    bool isDown(Keyboard::Key key) const { return test(keysDown, key); }
+    bool wasPressed(Keyboard::Key key) const { return test(keysPressed, key); }
+    bool wasReleased(Keyboard::Key key) const { return test(keysReleased, key); }
+
+    //=== MOUSE ===
+    bool isDown(Mouse::Button button) const { return buttonsDown[static_cast<size_t>(button)]; }
+    bool wasPressed(Mouse::Button button) const { return buttonsPressed[static_cast<size_t>(button)]; }
+    bool wasReleased(Mouse::Button button) const { return buttonsReleased[static_cast<size_t>(button)]; }
+    Vector2i getMousePosition() const { return mousePosition; }    // Window pixels
+
+private:
+    bitset<Keyboard::KeyCount> keysDown;
+    bitset<Keyboard::KeyCount> keysPressed;
+    bitset<Keyboard::KeyCount> keysReleased;
+    bitset<Mouse::ButtonCount> buttonsDown;
+    bitset<Mouse::ButtonCount> buttonsPressed;
+    bitset<Mouse::ButtonCount> buttonsReleased;
+    Vector2i mousePosition;             // Last reported by a mouse event
+
+    // Key::Unknown (-1) and keys beyond KeyCount are never set
+    static bool test(const bitset<Keyboard::KeyCount>& bits, Keyboard::Key key) {
+        size_t index = static_cast<size_t>(key);
+        return index < Keyboard::KeyCount && bits[index];
+    }
+
+    void press(Keyboard::Key key);
+    void release(Keyboard::Key key);
+    void releaseAll();
+};
+
+//=== GLOBAL INSTANCE DECLARATION ===
+// Defined in: FS1.1.cpp (fed by the main loop's event processing)
+extern InputSnapshot input;
@@ -1,43 +1,67 @@
 #include "IntroductionState.h"
 #include "NavigationSounds.h"
+#include "ResourceManager.h"
+#include "Input.h"
 
-//=== INTRODUCTION STATE HANDLER ===
+extern GameState previousState;  // Return target for the settings menu
+
+//=== INTRODUCTION STATE CLASS ===
 // Displays the initial game introduction screen explaining the purpose and concept
 // Provides context for the game's theme and prepares players for the experience
-void handleIntroductionState(RenderWindow& window, bool& running, GameState& state)
+class IntroductionState : public GameStateHandler {
+public:
+    //=== RESOURCE LIFECYCLE ===
+    void load(RenderWindow& window) override {
+        fontHandle = resources.acquireFont("arial.ttf");  // Cache hit - already opened by main
+    }
+
+    void unload() override {
+        resources.release(fontHandle);
+    }
+
+    //=== ACTIVATION LIFECYCLE ===
+    // Restart the fade-in (keys still held from the previous state do not press again)
+    void enter(RenderWindow& window) override {
+        animationClock.restart();       // Start animation timer
+    }
+
+    //=== FRAME HOOKS ===
+    void update(RenderWindow& window, float deltaTime, GameState& state) override;
+    void draw(RenderWindow& window) override;
+
+private:
+    FontHandle fontHandle;              // Shared text rendering font
+    Clock animationClock;               // Animation timing control
+};
+
+//=== INTRODUCTION INPUT HANDLER ===
+// Process user input for state transitions
+void IntroductionState::update(RenderWindow& window, float deltaTime, GameState& state)
 {
-    //=== PERSISTENT STATE VARIABLES ===
-    // Static variables maintain state between function calls
-    static Font font;                   // Text rendering font
-    static bool fontLoaded = false;     // Font loading status flag
-    static Clock animationClock;        // Animation timing control
-    static bool initialized = false;    // Initialization flag
-    
-    // Input state tracking to prevent key repeat issues
-    static bool enterPressed = false;   // ENTER/SPACE key state
-    static bool escPressed = false;     // ESC key state
-    static bool f1Pressed = false;      // F1 key (settings) state
+    // Continue to main menu (ENTER or SPACE)
+    if (input.wasPressed(Keyboard::Key::Enter) || input.wasPressed(Keyboard::Key::Space)) {
+        navSounds.playSelect();         // Play selection sound effect
+        state = MENU;                   // Transition to main menu
+    }
     
-    //=== INITIALIZATION ===
-    // One-time setup when entering the state
-    if (!initialized) {
-        animationClock.restart();       // Start animation timer
-        
-        // Reset input states to prevent carried-over key presses
-        enterPressed = Keyboard::isKeyPressed(Keyboard::Key::Enter) || 
-                      Keyboard::isKeyPressed(Keyboard::Key::Space);
-        escPressed = Keyboard::isKeyPressed(Keyboard::Key::Escape);
-        f1Pressed = Keyboard::isKeyPressed(Keyboard::Key::F1);
-        
-        initialized = true;
+    // Skip to main menu (ESC)
+    if (input.wasPressed(Keyboard::Key::Escape)) {
+        navSounds.playBack();           // Play back sound effect
+        state = MENU;                   // Skip directly to main menu
     }
     
-    //=== FONT LOADING ===
-    // Load font for text rendering
-    if (!fontLoaded) {
-        font.openFromFile("arial.ttf");
-        fontLoaded = true;
+    // Settings access (F1)
+    if (input.wasPressed(Keyboard::Key::F1)) {
+        navSounds.playSelect();         // Play selection sound effect
+        previousState = INTRODUCTION;   // Store current state for return
+        state = SETTINGS;               // Open settings menu
     }
+}
+
+//=== INTRODUCTION RENDERING ===
+void IntroductionState::draw(RenderWindow& window)
+{
+    const Font& font = resources.get(fontHandle);
     
     //=== ANIMATION TIMING ===
     // Get elapsed time for animation effects
@@ -136,47 +160,9 @@ void handleIntroductionState(RenderWindow& window, bool& running, GameState& sta
         escHint.setPosition(Vector2f(window.getSize().x / 2.f, window.getSize().y * 0.90f));
         window.draw(escHint);
     }
-    
-    //=== INPUT HANDLING SYSTEM ===
-    // Process user input for state transitions
-    
-    // Continue to main menu (ENTER or SPACE)
-    if (Keyboard::isKeyPressed(Keyboard::Key::Enter) || Keyboard::isKeyPressed(Keyboard::Key::Space)) {
-        if (!enterPressed) {  // Edge detection to prevent key repeat
-            navSounds.playSelect();     // Play selection sound effect
-            state = MENU;               // Transition to main menu
-            initialized = false;        // Reset for potential re-entry
-            enterPressed = true;        // Mark key as pressed
-        }
-    }
-    else {
-        enterPressed = false;  // Reset when key released
-    }
-    
-    // Skip to main menu (ESC)
-    if (Keyboard::isKeyPressed(Keyboard::Key::Escape)) {
-        if (!escPressed) {  // Edge detection to prevent key repeat
-            navSounds.playBack();       // Play back sound effect
-            state = MENU;               // Skip directly to main menu
-            initialized = false;        // Reset for potential re-entry
-            escPressed = true;          // Mark key as pressed
-        }
-    }
-    else {
-        escPressed = false;  // Reset when key released
-    }
-    
-    // Settings access (F1)
-    if (Keyboard::isKeyPressed(Keyboard::Key::F1)) {
-        if (!f1Pressed) {  // Edge detection to prevent key repeat
-            navSounds.playSelect();        // Play selection sound effect
-            extern GameState previousState;
-            previousState = INTRODUCTION;  // Store current state for return
-            state = SETTINGS;              // Open settings menu
-            f1Pressed = true;              // Mark key as pressed
-        }
-    }
-    else {
-        f1Pressed = false;  // Reset when key released
-    }
+}
+
+//=== FACTORY ===
+unique_ptr<GameStateHandler> createIntroductionState() {
+    return make_unique<IntroductionState>();
 }
\ No newline at end of file
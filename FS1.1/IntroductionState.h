@@ -1,11 +1,13 @@
 #pragma once
 #include <SFML/Graphics.hpp>
-#include "GameState.h"
+#include <memory>
+#include "GameStateHandler.h"
 
 using namespace sf;
+using namespace std;
 
-//=== INTRODUCTION STATE HANDLER DECLARATION ===
-// Handles the initial game introduction screen that explains the game's purpose
+//=== INTRODUCTION STATE FACTORY ===
+// Creates the initial game introduction screen that explains the game's purpose
 // Shows game overview, narrative context, and provides smooth entry to main menu
 // Features: Animated text presentation, thematic background, continue prompt
-void handleIntroductionState(RenderWindow& window, bool& running, GameState& state);
\ No newline at end of file
+unique_ptr<GameStateHandler> createIntroductionState();
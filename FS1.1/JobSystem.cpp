@@ -0,0 +1,76 @@
+#include "JobSystem.h"
+
+using namespace std;
+
+//=== DESTRUCTOR ===
+
+JobSystem::~JobSystem() {
+    stopWorkers();
+}
+
+//=== WORKERS ===
+
+void JobSystem::setWorkerCount(unsigned workerCount) {
+    if (workerCount == workers.size()) return;
+    stopWorkers();
+    stopping = false;
+    for (unsigned i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&JobSystem::workerLoop, this, workGeneration);
+    }
+}
+
+void JobSystem::stopWorkers() {
+    {
+        lock_guard<mutex> lock(workMutex);
+        stopping = true;
+    }
+    workReady.notify_all();
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+void JobSystem::workerLoop(uint64_t seenGeneration) {
+    for (;;) {
+        {
+            unique_lock<mutex> lock(workMutex);
+            workReady.wait(lock, [&]() { return stopping || workGeneration != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = workGeneration;
+        }
+        drain();
+        {
+            lock_guard<mutex> lock(workMutex);
+            if (--pendingWorkers == 0) workDone.notify_one();
+        }
+    }
+}
+
+//=== DISPATCH ===
+
+// Publish the run, take jobs alongside the workers and wait until every worker left it
+// (a worker still inside could otherwise take a job of the next run with this run's job)
+void JobSystem::dispatch(size_t count, Invoke runInvoke, const void* runContext) {
+    {
+        lock_guard<mutex> lock(workMutex);
+        invoke = runInvoke;
+        context = runContext;
+        jobCount = count;
+        nextJob.store(0, memory_order_relaxed);
+        pendingWorkers = workers.size();
+        workGeneration++;
+    }
+    workReady.notify_all();
+    drain();
+    {
+        unique_lock<mutex> lock(workMutex);
+        workDone.wait(lock, [this]() { return pendingWorkers == 0; });
+    }
+}
+
+void JobSystem::drain() {
+    for (size_t i = nextJob.fetch_add(1, memory_order_relaxed); i < jobCount; i = nextJob.fetch_add(1, memory_order_relaxed)) {
+        invoke(context, i);
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+//=== JOB SYSTEM CLASS DECLARATION ===
+// Small fork-join pool for per-frame data-parallel work (particles, traffic flow)
+// - run(count, job) calls job(index) once for every index in [0, count) and returns when all
+//   of them finished; the calling thread takes jobs too, so 0 workers simply runs them inline
+// - Threads pull the next index from a shared counter: uneven jobs (lanes of different
+//   lengths) balance themselves, and the number of jobs may exceed the number of threads
+// - Jobs must not touch the same data unless it is read only for the whole run()
+// - The job is called through a plain function pointer: dispatching allocates nothing
+// One owner thread calls run() (the workers are internal to it)
+class JobSystem {
+public:
+    JobSystem() = default;
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Threads helping run() besides the calling thread (0 = calling thread only)
+    void setWorkerCount(unsigned count);
+    unsigned getWorkerCount() const { return static_cast<unsigned>(workers.size()); }
+    unsigned getThreadCount() const { return getWorkerCount() + 1; }
+
+    template <typename Job>
+    void run(size_t count, const Job& job) {
+        if (workers.empty() || count <= 1) {
+            for (size_t i = 0; i < count; ++i) {
+                job(i);
+            }
+            return;
+        }
+        dispatch(count, [](const void* context, size_t index) { (*static_cast<const Job*>(context))(index); }, &job);
+    }
+
+private:
+    using Invoke = void (*)(const void* context, size_t index);
+
+    vector<thread> workers;
+    mutex workMutex;
+    condition_variable workReady;       // A run was published (or the workers must stop)
+    condition_variable workDone;        // The last worker left the run
+    uint64_t workGeneration = 0;        // Bumped for every published run
+    size_t pendingWorkers = 0;          // Workers still inside the current run
+    bool stopping = false;
+
+    // The published run (written under workMutex before the generation is bumped)
+    Invoke invoke = nullptr;
+    const void* context = nullptr;
+    size_t jobCount = 0;
+    atomic<size_t> nextJob{ 0 };
+
+    void dispatch(size_t count, Invoke invoke, const void* context);
+    // Take jobs of the published run until none are left
+    void drain();
+    // Worker thread body: wait for a run newer than seenGeneration, drain it, report, repeat
+    void workerLoop(uint64_t seenGeneration);
+    void stopWorkers();
+};
@@ -0,0 +1,81 @@
+#include "Level3Autopilot.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+//=== CONSTRUCTOR ===
+Level3Autopilot::Level3Autopilot(uint32_t seed) : gen(seed) {}
+
+//=== DRIVING ===
+
+Level3Input Level3Autopilot::drive(const Level3Simulation& simulation, float deltaTime) {
+    Level3Input input;
+    clock += deltaTime;
+    input.musicOff = fmod(clock, MUTE_PERIOD) < MUTE_SECONDS;
+    if (clock >= nextSpeedChange) {
+        uniform_real_distribution<float> speedDist(Level3Simulation::MIN_SPEED + 100.0f, Level3Simulation::MAX_SPEED);
+        targetSpeed = speedDist(gen);
+        nextSpeedChange = clock + SPEED_PERIOD;
+    }
+    if (simulation.isGameOver() || simulation.isPlayerOutOfCar()) return input;
+
+    const CarStore& cars = simulation.getCars();
+    size_t player = simulation.getPlayerIndex();
+    float playerX = cars.x[player];
+    float playerY = cars.y[player];
+    float halfWidth = cars.halfWidth[player];
+    float halfHeight = cars.halfHeight[player];
+
+    //--- Candidate Targets ---
+    // Evenly across the road at the player's height (inside the clamp margin)
+    float trackLeft, trackRight;
+    simulation.getRoad().boundsAt(playerY, trackLeft, trackRight);
+    trackLeft += 20.0f;
+    trackRight -= 20.0f;
+    float targets[TARGETS];
+    float costs[TARGETS];
+    float pathBlocked[TARGETS] = {};
+    for (int t = 0; t < TARGETS; ++t) {
+        targets[t] = trackLeft + (trackRight - trackLeft) * t / (TARGETS - 1);
+        costs[t] = fabs(targets[t] - playerX) * 0.00001f;  // Prefer staying put (less than any car ahead)
+    }
+
+    //--- Traffic Ahead ---
+    // Obstacles close in at the road speed plus their own; nearer ones weigh more. A target is
+    // as bad as the nearest car blocking it or the way over to it
+    float lookahead = (simulation.getGameSpeed() + Level3Simulation::OBSTACLE_SPEED) * LOOKAHEAD_SECONDS + 100.0f;
+    float ownLaneDanger = 0.0f;
+    simulation.getGrid().forEachNear(trackLeft - 40.0f, playerY - lookahead, trackRight + 40.0f, playerY + halfHeight, [&](size_t i) {
+        float ahead = playerY - cars.y[i] - cars.halfHeight[i] - halfHeight;
+        if (ahead > lookahead) return true;
+        float weight = 1.0f / (max(ahead, 0.0f) + 50.0f);
+        float clearance = cars.halfWidth[i] + halfWidth + 4.0f;
+        for (int t = 0; t < TARGETS; ++t) {
+            // Blocks the target, or the way over to it
+            if (cars.x[i] > min(playerX, targets[t]) - clearance && cars.x[i] < max(playerX, targets[t]) + clearance) {
+                pathBlocked[t] = max(pathBlocked[t], weight);
+            }
+        }
+        if (fabs(cars.x[i] - playerX) < clearance) ownLaneDanger = max(ownLaneDanger, weight);
+        return true;
+    });
+
+    //--- Controls ---
+    for (int t = 0; t < TARGETS; ++t) {
+        costs[t] += pathBlocked[t];
+    }
+    int best = 0;
+    for (int t = 1; t < TARGETS; ++t) {
+        if (costs[t] < costs[best]) best = t;
+    }
+    input.steering = max(-1.0f, min(1.0f, (targets[best] - playerX) / 30.0f));
+
+    bool blocked = ownLaneDanger > 1.0f / 250.0f;  // A car within ~200px in this lane
+    if (blocked || simulation.getGameSpeed() > targetSpeed + 10.0f) {
+        input.throttle = -1.0f;
+    } else if (simulation.getGameSpeed() < targetSpeed - 10.0f) {
+        input.throttle = 1.0f;
+    }
+    return input;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include "Level3Simulation.h"
+#include "Random.h"
+
+using namespace std;
+
+//=== LEVEL 3 AUTOPILOT CLASS DECLARATION ===
+// Scripted driver for headless Level 3 runs (soak tests): produces the input a player would
+// - Steering: scores a row of target positions across the road by the traffic ahead (closer
+//   cars weigh more, moving far costs a little) and steers toward the clearest
+// - Speed: a new random target speed every SPEED_PERIOD seconds; brakes while its own lane is
+//   blocked close ahead
+// - Music: muted for MUTE_SECONDS out of every MUTE_PERIOD, so the secret text timeline runs too
+// Never gets out of the car (that would end the level)
+class Level3Autopilot {
+public:
+    explicit Level3Autopilot(uint32_t seed);
+
+    Level3Input drive(const Level3Simulation& simulation, float deltaTime);
+
+private:
+    static constexpr float SPEED_PERIOD = 45.0f;        // Seconds between target speeds
+    static constexpr float MUTE_PERIOD = 600.0f;        // Seconds between mutes
+    static constexpr float MUTE_SECONDS = 120.0f;       // Long enough for the whole text sequence
+    static constexpr float LOOKAHEAD_SECONDS = 1.2f;    // Traffic considered: this far ahead in time
+    static constexpr int TARGETS = 9;                   // Candidate positions across the road
+
+    Pcg32 gen;
+    double clock = 0.0;                 // Simulated seconds driven (double: soak runs last hours)
+    double nextSpeedChange = 0.0;
+    float targetSpeed = 300.0f;
+};
@@ -0,0 +1,416 @@
+#include "Level3Simulation.h"
+#include "HitboxKernel.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+using namespace sf;
+using namespace std;
+
+//=== NARRATIVE TEXT CONTENT ===
+// Shown one after another once the music has been off for 10 seconds
+static const vector<string> secretTexts = {
+	"Blah blah blah...",
+
+    /*"That's better.",
+    "That moment where everything goes quiet.",
+    "Isn't it soothing.",
+    "All the noise washed away.",
+    "Nothing to distract you anymore.",
+    "Nothing but the sound of the engine and the endless road ahead.",
+    "It does get boring after a while though.",
+    "Maybe you should turn the music back on.",
+    "Or perhaps not...",
+    "The choice is yours.",
+    "You can also keep driving in silence.",
+    "Or you can go the next level.",
+    "If there is one...",
+    "I'm sure you'll figure it out.",
+    "I'll be here if you need me."*/
+};
+
+//=== CONSTRUCTOR ===
+Level3Simulation::Level3Simulation(int trafficDensity, uint32_t seed)
+    : trafficDensity(max(1, trafficDensity)), gen(seed) {
+    // Collision scratch at the high-water mark: a long run never grows it
+    collisionMinX.reserve(CAR_CAPACITY);
+    collisionMinY.reserve(CAR_CAPACITY);
+    collisionMaxX.reserve(CAR_CAPACITY);
+    collisionMaxY.reserve(CAR_CAPACITY);
+    collisionCandidates.reserve(CAR_CAPACITY);
+    collisionMask.reserve(hitMaskWords(CAR_CAPACITY));
+}
+
+//=== SETUP ===
+
+void Level3Simulation::configure(Vector2f screen, Vector2f player, Vector2f obstacle) {
+    screenSize = screen;
+    playerSize = player;
+    obstacleSize = obstacle;
+}
+
+void Level3Simulation::reset() {
+    gameOver = false;
+    cars.clear();                 // Slots are recycled; nothing is freed
+    score = 0;
+    totalDistance = 0.0;
+    gameSpeed = 200.0f;
+    playerOutOfCar = false;
+    abandonedCar = CarHandle();
+
+    // Position player at bottom-center of screen
+    playerCar = cars.spawn(CarKind::Player, screenSize.x / 2.0f, screenSize.y * 0.8f);
+    size_t player = cars.indexOf(playerCar);
+    cars.halfWidth[player] = playerSize.x * PLAYER_HITBOX_SIZE / 2.0f;
+    cars.halfHeight[player] = playerSize.y * PLAYER_HITBOX_SIZE / 2.0f;
+    cars.updateHitbox(player);
+
+    // Broadphase cells: 80px lanes across the window (the road curves across it) and 80px
+    // bands from the spawn rows above the screen to below it
+    trafficGrid.configure(0.0f, screenSize.x, 80.0f, -500.0f, screenSize.y + 100.0f, 80.0f);
+    trafficGrid.rebuild(cars);
+    stressCollisions = 0;
+
+    // New road: straight under the player, curves begin ahead
+    road.reset(screenSize.x, trackWidth, screenSize.y + 100.0f);
+    road.stream(ROAD_AHEAD, screenSize.y + 100.0f, gen);
+
+    // New traffic above the window: the road ahead starts clear. Normal traffic drives in lanes
+    // on the road; stress traffic fills the whole width with lanes, spaced closer by the density
+    bool stress = trafficDensity > 1;
+    TrafficFlowSetup setup;
+    setup.lanes = stress ? max(1, static_cast<int>((screenSize.x - 60.0f) / STRESS_LANE_WIDTH)) : TRAFFIC_LANES;
+    setup.start = TRAFFIC_TOP - 50.0f;
+    setup.top = TRAFFIC_TOP - TRAFFIC_STRETCH;
+    setup.exit = screenSize.y + 100.0f;
+    setup.spacing = stress ? max(STRESS_MIN_SPACING, TRAFFIC_SPACING / trafficDensity) : TRAFFIC_SPACING;
+    setup.vehicleLength = obstacleSize.y;
+    setup.desiredSpeed = OBSTACLE_SPEED;
+    traffic.reset(setup, gen);
+    trafficCars.reserve(traffic.capacity());
+    trafficCars.assign(traffic.size(), CarHandle());
+}
+
+void Level3Simulation::resetTimeline(bool musicOff) {
+    musicOffTime = 0.0f;
+    textTime = 0.0f;
+    musicWasOff = musicOff;
+    textSequenceStarted = false;
+    currentTextIndex = -1;
+    textSequenceCompleted = false;
+}
+
+size_t Level3Simulation::getTextCount() {
+    return secretTexts.size();
+}
+
+const string& Level3Simulation::getText(size_t index) {
+    return secretTexts[index];
+}
+
+size_t Level3Simulation::getFootprint() const {
+    size_t bytes = cars.getFootprint() + traffic.getFootprint();
+    bytes += trafficCars.capacity() * sizeof(CarHandle);
+    bytes += (collisionMinX.capacity() + collisionMinY.capacity() + collisionMaxX.capacity() + collisionMaxY.capacity()) * sizeof(float);
+    bytes += collisionCandidates.capacity() * sizeof(size_t);
+    bytes += collisionMask.capacity() * sizeof(uint32_t);
+    return bytes;
+}
+
+//=== STEP ===
+
+void Level3Simulation::step(float deltaTime, const Level3Input& input, Level3Events& events) {
+    events = Level3Events();
+    stepTimeline(deltaTime, input.musicOff);
+
+    // Vehicle exit: only once stopped, after the text sequence
+    if (input.exitCar && textSequenceCompleted && isStopped() && !playerOutOfCar) {
+        playerOutOfCar = true;
+
+        // Leave the car behind where it stopped (drawn with the player's design)
+        size_t player = cars.indexOf(playerCar);
+        abandonedCar = cars.spawn(CarKind::Abandoned, cars.x[player], cars.y[player]);
+
+        // Reconfigure player as pedestrian
+        player = cars.indexOf(playerCar);
+        cars.velocityX[player] = 0.0f;
+        events.leftCar = true;
+    }
+
+    if (playerOutOfCar) {
+        stepPedestrian(deltaTime, input, events);
+    } else if (!gameOver) {
+        stepDriving(deltaTime, input, events);
+    }
+}
+
+//=== TEXT SEQUENCE CONTROLLER ===
+// Starts after 10 seconds of silence; each message shows for 9 seconds with a 1 second gap
+void Level3Simulation::stepTimeline(float deltaTime, bool musicOff) {
+    if (musicOff) {
+        if (!musicWasOff) {
+            musicOffTime = 0.0f;  // Begin timing silence period
+        }
+        musicOffTime += deltaTime;
+        // Trigger narrative after 10 seconds of silence
+        if (!textSequenceStarted && musicOffTime >= 10.0f) {
+            textSequenceStarted = true;
+            textTime = 0.0f;
+            currentTextIndex = 0;
+        }
+    } else {
+        // Reset narrative if music returns
+        if (musicWasOff) {
+            textSequenceStarted = false;
+            currentTextIndex = -1;
+            textSequenceCompleted = false;
+        }
+    }
+    musicWasOff = musicOff;  // Store state for next step
+
+    if (textSequenceStarted && !textSequenceCompleted) {
+        textTime += deltaTime;
+        int cycleIndex = static_cast<int>(textTime / 10.0f);  // 10-second cycles
+        float cycleTime = textTime - (cycleIndex * 10.0f);    // Position within cycle
+
+        if (cycleIndex < static_cast<int>(secretTexts.size())) {
+            currentTextIndex = cycleTime < 9.0f ? cycleIndex : -1;  // Message, then gap
+        } else {
+            textSequenceCompleted = true;
+            currentTextIndex = static_cast<int>(secretTexts.size()) - 1;  // Final message
+        }
+    }
+}
+
+//=== PEDESTRIAN MOVEMENT SYSTEM ===
+void Level3Simulation::stepPedestrian(float deltaTime, const Level3Input& input, Level3Events& events) {
+    size_t player = cars.indexOf(playerCar);
+    float& playerX = cars.x[player];
+    float& playerY = cars.y[player];
+    playerX += input.walk.x * WALK_SPEED * deltaTime;
+    playerY += input.walk.y * WALK_SPEED * deltaTime;
+
+    // Boundary constraints (allow slight off-screen movement)
+    playerX = max(0.0f - 20.0f, min(screenSize.x + 20.0f, playerX));
+    playerY = max(0.0f, min(screenSize.y - 30.0f, playerY));
+    cars.updateHitbox(player);
+
+    // Level exit condition
+    events.walkedAway = playerX < -15 || playerX > screenSize.x + 15;
+}
+
+//=== DRIVING MECHANICS ===
+void Level3Simulation::stepDriving(float deltaTime, const Level3Input& input, Level3Events& events) {
+    events.drove = true;
+
+    //--- Steering and Speed ---
+    cars.velocityX[cars.indexOf(playerCar)] = max(-1.0f, min(1.0f, input.steering)) * PLAYER_SPEED;
+    if (input.throttle > 0.0f) {
+        gameSpeed = min(gameSpeed + 100.0f * deltaTime, MAX_SPEED);  // Accelerate
+    } else if (input.throttle < 0.0f) {
+        gameSpeed = max(gameSpeed - 100.0f * deltaTime, MIN_SPEED);  // Decelerate
+    }
+
+    //--- Score Calculation ---
+    totalDistance += gameSpeed * deltaTime;           // Accumulate distance
+    score = static_cast<int>(totalDistance / 10.0);   // Convert to score units
+
+    //--- Track Streaming ---
+    // Scroll the road down, drop what left the screen and generate ahead of the spawn rows
+    float roadScroll = gameSpeed * deltaTime;
+    road.scroll(roadScroll);
+    road.stream(ROAD_AHEAD, screenSize.y + 100.0f, gen);
+
+    //=== CAR MOVEMENT SYSTEM ===
+    // One pass over the packed position and velocity arrays for every car the traffic flow does not
+    // move: the player only steers (scroll = 0). The step's displacement is kept for the swept
+    // collision test
+    float* carX = cars.x.data();
+    float* carY = cars.y.data();
+    float* moveX = cars.moveX.data();
+    float* moveY = cars.moveY.data();
+    const float* velocityX = cars.velocityX.data();
+    const float* velocityY = cars.velocityY.data();
+    const float* scroll = cars.scroll.data();
+    float maxMoveX = 0.0f;                  // Largest displacement of any car this step
+    float maxMoveY = 0.0f;
+    for (size_t i = 0; i < cars.size(); ++i) {
+        if (cars.kind[i] == CarKind::Obstacle) continue;  // Placed by syncTraffic below
+        moveX[i] = velocityX[i] * deltaTime;
+        moveY[i] = (gameSpeed * scroll[i] + velocityY[i]) * deltaTime;
+        if (scroll[i] > 0.0f) {
+            // Keep the same place across the road: the road under the car already scrolled
+            moveX[i] += road.centerAt(carY[i] + moveY[i]) - road.centerAt(carY[i] + roadScroll * scroll[i]);
+        }
+        carX[i] += moveX[i];
+        carY[i] += moveY[i];
+        maxMoveX = max(maxMoveX, fabs(moveX[i]));
+        maxMoveY = max(maxMoveY, fabs(moveY[i]));
+        cars.updateHitbox(i);
+    }
+
+    // Track boundary enforcement at the car's height (the clamped distance was not travelled)
+    size_t player = cars.indexOf(playerCar);
+    float trackLeft, trackRight;
+    road.boundsAt(cars.y[player], trackLeft, trackRight);
+    float clampedX = max(trackLeft + 15, min(trackRight - 15, cars.x[player]));
+    if (clampedX != cars.x[player]) {
+        // Scraping the wall: contact at the wheels on that side
+        float wallSide = clampedX > cars.x[player] ? -1.0f : 1.0f;
+        events.scrapedWall = true;
+        events.wallContact = Vector2f(clampedX + wallSide * cars.halfWidth[player], cars.y[player] + cars.halfHeight[player] * 0.5f);
+    }
+    cars.moveX[player] += clampedX - cars.x[player];
+    cars.x[player] = clampedX;
+    cars.updateHitbox(player);
+
+    //=== TRAFFIC FLOW ===
+    // Car following and lane changes along the whole stretch (parallel with workers), then the
+    // window's vehicles become the obstacles the rest of the step collides with
+    auto trafficStart = chrono::steady_clock::now();
+    traffic.step(deltaTime, gameSpeed, gen);
+    events.trafficTime = chrono::duration<double, micro>(chrono::steady_clock::now() - trafficStart).count();
+    syncTraffic(maxMoveX, maxMoveY);
+
+    //=== BROADPHASE GRID ===
+    // Re-file every obstacle at its new position (despawning changed dense indices)
+    auto broadphaseStart = chrono::steady_clock::now();
+    trafficGrid.rebuild(cars);
+
+    //=== ENHANCED COLLISION DETECTION SYSTEM ===
+    // Continuous over the whole step, so fast traffic cannot pass through the player between
+    // frames at any frame rate:
+    // 1. Gather the obstacles filed in the cells the player can reach during the step
+    // 2. Batch-test their swept boxes (start and end box together) against the player's
+    // 3. Find the exact time of impact only for the boxes that passed (see HitboxKernel.h)
+    player = cars.indexOf(playerCar);
+    float playerX = cars.x[player];
+    float playerY = cars.y[player];
+    float playerMoveX = cars.moveX[player];
+    float playerMoveY = cars.moveY[player];
+    float reachX = cars.halfWidth[player] + trafficGrid.getMaxHalfWidth() + maxMoveX + fabs(playerMoveX);
+    float reachY = cars.halfHeight[player] + trafficGrid.getMaxHalfHeight() + maxMoveY + fabs(playerMoveY);
+    collisionMinX.clear();
+    collisionMinY.clear();
+    collisionMaxX.clear();
+    collisionMaxY.clear();
+    collisionCandidates.clear();
+    trafficGrid.forEachNear(playerX - reachX, playerY - reachY, playerX + reachX, playerY + reachY, [&](size_t i) {
+        collisionMinX.push_back(cars.hitMinX[i] - max(cars.moveX[i], 0.0f));
+        collisionMinY.push_back(cars.hitMinY[i] - max(cars.moveY[i], 0.0f));
+        collisionMaxX.push_back(cars.hitMaxX[i] - min(cars.moveX[i], 0.0f));
+        collisionMaxY.push_back(cars.hitMaxY[i] - min(cars.moveY[i], 0.0f));
+        collisionCandidates.push_back(i);
+        return true;
+    });
+    events.candidates += collisionCandidates.size();
+    HitboxArrays nearby = { collisionMinX.data(), collisionMinY.data(), collisionMaxX.data(), collisionMaxY.data(), collisionCandidates.size() };
+    collisionMask.resize(hitMaskWords(nearby.count));
+    bool collision = false;
+    size_t collidedCar = 0;
+    if (overlapBatch(cars.hitMinX[player] - max(playerMoveX, 0.0f), cars.hitMinY[player] - max(playerMoveY, 0.0f),
+                     cars.hitMaxX[player] - min(playerMoveX, 0.0f), cars.hitMaxY[player] - min(playerMoveY, 0.0f),
+                     nearby, collisionMask.data()) > 0) {
+        for (size_t k = 0; k < nearby.count && !collision; ++k) {
+            if (!(collisionMask[k / 32] & (1u << (k % 32)))) continue;
+            size_t i = collisionCandidates[k];
+            float impactTime;
+            collision = sweptOverlap(cars.hitMinX[player] - playerMoveX, cars.hitMinY[player] - playerMoveY,
+                                     cars.hitMaxX[player] - playerMoveX, cars.hitMaxY[player] - playerMoveY,
+                                     cars.hitMinX[i] - cars.moveX[i], cars.hitMinY[i] - cars.moveY[i],
+                                     cars.hitMaxX[i] - cars.moveX[i], cars.hitMaxY[i] - cars.moveY[i],
+                                     cars.moveX[i] - playerMoveX, cars.moveY[i] - playerMoveY, impactTime);
+            collidedCar = i;
+        }
+    }
+    if (collision) {
+        events.collided = true;
+        events.impact = Vector2f((playerX + cars.x[collidedCar]) / 2.0f, (playerY + cars.y[collidedCar]) / 2.0f);
+        if (trafficDensity > 1) {
+            stressCollisions++;  // Stress mode keeps driving to keep the traffic measurable
+        } else {
+            gameOver = true;
+        }
+    }
+    events.broadphaseTime = chrono::duration<double, micro>(chrono::steady_clock::now() - broadphaseStart).count();
+}
+
+//=== TRAFFIC WINDOW ===
+
+// Screen x of a lane position at height y: lanes split the road (the whole window in stress mode)
+float Level3Simulation::laneX(float y, float lanePosition) const {
+    float left = 30.0f;
+    float right = screenSize.x - 30.0f;
+    if (trafficDensity <= 1) {
+        road.boundsAt(y, left, right);
+    }
+    return left + (lanePosition + 0.5f) * (right - left) / traffic.getLaneCount();
+}
+
+// A vehicle is an obstacle from TRAFFIC_TOP until the step it passes the despawn line (it may
+// have passed the player on the way), like the spawned traffic before it
+void Level3Simulation::syncTraffic(float& maxMoveX, float& maxMoveY) {
+    // Vehicles that left through the exit this step re-entered far ahead
+    for (uint32_t vehicle : traffic.getRecycled()) {
+        if (cars.isAlive(trafficCars[vehicle])) cars.despawn(trafficCars[vehicle]);
+        trafficCars[vehicle] = CarHandle();
+    }
+
+    float despawnY = screenSize.y + 50;
+    traffic.forEachBetween(TRAFFIC_TOP, traffic.getSetup().exit, [&](size_t vehicle) {
+        float y = traffic.y[vehicle];
+        float moveY = traffic.moveY[vehicle];
+        CarHandle& handle = trafficCars[vehicle];
+        bool alive = cars.isAlive(handle);
+        if (y - moveY > despawnY) {
+            if (alive) cars.despawn(handle);
+            handle = CarHandle();
+            return;
+        }
+
+        float x = laneX(y, traffic.lanePosition[vehicle]);
+        if (!alive) {
+            handle = spawnObstacle(x, y);
+        }
+        size_t car = cars.indexOf(handle);
+        cars.moveX[car] = alive ? x - cars.x[car] : 0.0f;
+        cars.moveY[car] = moveY;
+        cars.x[car] = x;
+        cars.y[car] = y;
+        cars.velocityY[car] = traffic.speed[vehicle];
+        cars.updateHitbox(car);
+        maxMoveX = max(maxMoveX, fabs(cars.moveX[car]));
+        maxMoveY = max(maxMoveY, fabs(moveY));
+    });
+}
+
+//=== OBSTACLE SPAWNING ===
+// Traffic cars are plain component values; the sprite is chosen by index when drawing
+CarHandle Level3Simulation::spawnObstacle(float x, float y) {
+    CarHandle handle = cars.spawn(CarKind::Obstacle, x, y);
+    size_t car = cars.indexOf(handle);
+    cars.scroll[car] = 1.0f;                        // Travels with the road (moved by the traffic flow)
+    cars.spriteIndex[car] = static_cast<uint8_t>(uniform_int_distribution<int>(0, CAR_DESIGNS - 1)(gen));
+    cars.audioId[car] = nextObstacleAudioId++;
+
+    // Random pitch and volume variation for audio diversity
+    uniform_real_distribution<float> variationDist(0.0f, 0.4f);
+    cars.pitchVariation[car] = 0.9f + variationDist(gen);
+    cars.soundVolume[car] = 0.8f + variationDist(gen);
+
+    // Hitbox from the drawn size (every design shares the sprite dimensions)
+    cars.halfWidth[car] = obstacleSize.x * OBSTACLE_HITBOX_SIZE / 2.0f;
+    cars.halfHeight[car] = obstacleSize.y * OBSTACLE_HITBOX_SIZE / 2.0f;
+    cars.updateHitbox(car);
+    return handle;
+}
+
+//=== STRESS MODE THREAD BUDGET ===
+Level3WorkerBudget getStressWorkerBudget() {
+    unsigned spare = max(2u, thread::hardware_concurrency()) - 1;
+    Level3WorkerBudget budget;
+    budget.particles = min(3u, spare / 3);
+    budget.traffic = spare - budget.particles;
+    return budget;
+}
@@ -0,0 +1,188 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CarStore.h"
+#include "TrafficGrid.h"
+#include "RoadTrack.h"
+#include "TrafficFlow.h"
+#include "Random.h"
+
+using namespace sf;
+using namespace std;
+
+//=== LEVEL 3 INPUT ===
+// One step's controls, from the keyboard (PlayingState3) or a script (Level3Autopilot)
+struct Level3Input {
+    float steering = 0.0f;              // -1 (full left) to 1 (full right)
+    float throttle = 0.0f;              // 1 accelerates, -1 brakes, 0 holds the speed
+    Vector2f walk;                      // Pedestrian direction, each axis -1 to 1
+    bool exitCar = false;               // Get out (honored once stopped, after the text sequence)
+    bool musicOff = false;              // The music is muted: drives the secret text timeline
+};
+
+//=== LEVEL 3 EVENTS ===
+// What happened during one step, for the presentation (effects, audio, state changes)
+struct Level3Events {
+    bool drove = false;                 // A driving step ran (the traffic figures below are set)
+    bool collided = false;              // The player hit traffic (ends the run outside stress mode)
+    Vector2f impact;                    // Midpoint between the two cars
+    bool scrapedWall = false;           // The player was pushed back onto the road
+    Vector2f wallContact;               // Wheels on the wall side
+    bool leftCar = false;               // The player got out this step
+    bool walkedAway = false;            // The pedestrian left the screen (the level is done)
+    size_t candidates = 0;              // Obstacles visited by grid queries
+    double trafficTime = 0.0;           // Microseconds: traffic flow step (car following, lane changes)
+    double broadphaseTime = 0.0;        // Microseconds: grid rebuild and collision
+};
+
+//=== LEVEL 3 SIMULATION CLASS DECLARATION ===
+// Level 3's rules without rendering, audio or wall-clock time: speed, distance and score, the
+// streamed road, traffic, swept collisions, getting out of the car and the secret text timeline
+// - Traffic is a TrafficFlow (car following and lane changes, see TrafficFlow.h) over
+//   TRAFFIC_STRETCH pixels of road ahead of the screen; only the vehicles inside the window
+//   are cars in the CarStore (drawn, heard, collided with)
+// - step() advances by exactly the time it is given, so the same core runs the level at frame
+//   rate and fast-forwards headless soak tests (see Level3Soak.h)
+// - Traffic density > 1 is the stress mode: denser lanes across the whole width, collisions
+//   counted instead of ending the run
+// - The random stream is owned and seeded here: a seed reproduces a run for the same inputs
+// Nothing allocates while stepping once the CarStore capacity covers the traffic
+class Level3Simulation {
+public:
+    //=== TUNING ===
+    static constexpr size_t CAR_CAPACITY = 4096;            // Cars stored without allocating (stress mode included)
+    static constexpr float PLAYER_SPEED = 400.0f;           // Steering speed in pixels/second
+    static constexpr float WALK_SPEED = 150.0f;             // Pedestrian speed in pixels/second
+    static constexpr float OBSTACLE_SPEED = 200.0f;         // Average traffic speed on top of the road
+    static constexpr float PLAYER_HITBOX_SIZE = 1.0f;       // Hitbox share of the visual size
+    static constexpr float OBSTACLE_HITBOX_SIZE = 0.7f;
+    static constexpr float MIN_SPEED = 50.0f;               // Road speed range (pixels/second)
+    static constexpr float MAX_SPEED = 1000.0f;
+    static constexpr float STOPPED_SPEED = 55.0f;           // Slow enough to get out
+    static constexpr int CAR_DESIGNS = 5;                   // Designs in the sprite sheet
+    static constexpr float ROAD_AHEAD = -600.0f;            // Top of the streamed road (screen y)
+    static constexpr float TRAFFIC_TOP = -450.0f;           // Vehicles below this line are cars (screen y)
+    static constexpr float TRAFFIC_STRETCH = 24000.0f;      // Road simulated above the window (pixels)
+    static constexpr int TRAFFIC_LANES = 4;                 // Lanes across the road
+    static constexpr float TRAFFIC_SPACING = 1200.0f;       // Average gap per lane (divided by the density)
+    static constexpr float STRESS_LANE_WIDTH = 60.0f;       // Stress lanes fill the window at this width
+    static constexpr float STRESS_MIN_SPACING = 150.0f;     // Densest stress traffic (still flowing)
+
+    Level3Simulation(int trafficDensity, uint32_t seed);
+
+    Level3Simulation(const Level3Simulation&) = delete;
+    Level3Simulation& operator=(const Level3Simulation&) = delete;
+
+    //=== SETUP ===
+    // Screen the level plays on and the cars' drawn sizes (hitboxes are a share of them)
+    // Takes effect at the next reset()
+    void configure(Vector2f screenSize, Vector2f playerSize, Vector2f obstacleSize);
+    // New run: empty road, player at the bottom center, speed and score back to the start
+    // (the secret text timeline carries on: it follows the music, not the run)
+    void reset();
+    // Restart the secret text timeline (entering the level)
+    void resetTimeline(bool musicOff);
+
+    //=== STEP ===
+    void step(float deltaTime, const Level3Input& input, Level3Events& events);
+
+    // Threads helping the traffic flow step (0 = calling thread only)
+    void setWorkerCount(unsigned count) { traffic.setWorkerCount(count); }
+    unsigned getWorkerCount() const { return traffic.getWorkerCount(); }
+
+    //=== STATE ===
+    const CarStore& getCars() const { return cars; }
+    const TrafficGrid& getGrid() const { return trafficGrid; }
+    const TrafficFlow& getTraffic() const { return traffic; }
+    const RoadTrack& getRoad() const { return road; }
+    size_t getPlayerIndex() const { return cars.indexOf(playerCar); }
+    bool hasAbandonedCar() const { return abandonedCar.isValid(); }
+    size_t getAbandonedIndex() const { return cars.indexOf(abandonedCar); }
+    Vector2f getScreenSize() const { return screenSize; }
+    int getTrafficDensity() const { return trafficDensity; }
+
+    float getGameSpeed() const { return gameSpeed; }
+    double getTotalDistance() const { return totalDistance; }
+    int getScore() const { return score; }
+    bool isGameOver() const { return gameOver; }
+    bool isPlayerOutOfCar() const { return playerOutOfCar; }
+    bool isStopped() const { return gameSpeed <= STOPPED_SPEED; }
+    size_t getStressCollisions() const { return stressCollisions; }
+
+    // Secret text timeline: index of the message shown (-1 = none)
+    bool isTextSequenceStarted() const { return textSequenceStarted; }
+    bool isTextSequenceCompleted() const { return textSequenceCompleted; }
+    int getCurrentTextIndex() const { return currentTextIndex; }
+    static size_t getTextCount();
+    static const string& getText(size_t index);
+
+    // Bytes reserved by the simulation's containers (grows only if something leaks or resizes)
+    size_t getFootprint() const;
+
+private:
+    int trafficDensity;
+    Vector2f screenSize{ 1920.0f, 1080.0f };
+    Vector2f playerSize{ 30.0f, 50.0f };
+    Vector2f obstacleSize{ 40.0f, 40.0f };
+
+    // Cars and broadphase
+    CarStore cars{ CAR_CAPACITY };          // Player, traffic and abandoned car (see CarStore.h)
+    CarHandle playerCar;                    // The player's car, or the pedestrian after leaving it
+    CarHandle abandonedCar;                 // Where the car was left (invalid while driving)
+    TrafficGrid trafficGrid{ CAR_CAPACITY }; // Broadphase for collision (and the autopilot)
+    vector<float> collisionMinX, collisionMinY; // Nearby obstacle hitboxes for the batch test (reused)
+    vector<float> collisionMaxX, collisionMaxY;
+    vector<size_t> collisionCandidates;     // Dense index of each gathered hitbox
+    vector<uint32_t> collisionMask;
+    size_t stressCollisions = 0;            // Collisions counted instead of ending the run
+    uint32_t nextObstacleAudioId = 1;       // Emitter ids handed out at spawn
+
+    // Traffic: the whole stretch is simulated, the window's vehicles are mirrored as obstacles
+    TrafficFlow traffic;
+    vector<CarHandle> trafficCars;          // Per vehicle: its obstacle while in the window
+
+    // Core game metrics
+    float gameSpeed = 200.0f;               // Current scrolling speed
+    float trackWidth = 400.0f;              // Average road width (the road varies around it)
+    int score = 0;                          // Player score (based on distance)
+    bool gameOver = false;
+    bool playerOutOfCar = false;
+    double totalDistance = 0.0;             // Cumulative distance traveled (double: hours of driving)
+
+    // Procedural road, streamed from above the spawn rows to below the screen
+    static constexpr size_t ROAD_SAMPLES = 512;     // Ring capacity (windows up to ~9000px tall)
+    RoadTrack road{ ROAD_SAMPLES };
+
+    // Secret text timeline (simulated seconds)
+    float musicOffTime = 0.0f;              // Time the music has been off
+    float textTime = 0.0f;                  // Time since the sequence started
+    bool musicWasOff = false;
+    bool textSequenceStarted = false;
+    bool textSequenceCompleted = false;
+    int currentTextIndex = -1;
+
+    Pcg32 gen;
+
+    void stepTimeline(float deltaTime, bool musicOff);
+    void stepPedestrian(float deltaTime, const Level3Input& input, Level3Events& events);
+    void stepDriving(float deltaTime, const Level3Input& input, Level3Events& events);
+    // Copy the window's vehicles into the car store (spawning and despawning obstacles)
+    // Returns: the largest obstacle displacement of the step through maxMoveX / maxMoveY
+    void syncTraffic(float& maxMoveX, float& maxMoveY);
+    float laneX(float y, float lanePosition) const;
+    CarHandle spawnObstacle(float x, float y);
+};
+
+//=== STRESS MODE THREAD BUDGET ===
+// The spare hardware threads (all but the main thread), split once between the traffic flow
+// and the particle system so their worker pools together never outnumber the cores
+// - Particles get up to a third of them (at most 3: their step is short), traffic the rest
+// - Below three spare threads every one goes to traffic and particles stay on the main thread
+struct Level3WorkerBudget {
+    unsigned traffic = 0;
+    unsigned particles = 0;
+};
+Level3WorkerBudget getStressWorkerBudget();
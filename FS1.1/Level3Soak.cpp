@@ -0,0 +1,140 @@
+#include "Level3Soak.h"
+#include "Level3Simulation.h"
+#include "Level3Autopilot.h"
+#include "BenchmarkLog.h"
+#include "Random.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+using namespace sf;
+using namespace std;
+
+//=== SOAK TEST ===
+
+int runLevel3Soak(float minutes, int trafficDensity) {
+    using Clock = chrono::steady_clock;
+    const float STEP = 1.0f / 60.0f;
+    const long long STEPS_PER_WINDOW = 60LL * 60 * 10;  // 10 simulated minutes
+    const long long totalSteps = max(1LL, static_cast<long long>(minutes * 60.0f * 60.0f));
+
+    Level3Simulation simulation(trafficDensity, randomService.stream(RandomStream::Level3)());
+    simulation.configure(Vector2f(1920.0f, 1080.0f), Vector2f(30.0f, 50.0f), Vector2f(40.0f, 40.0f));
+    simulation.reset();
+    simulation.resetTimeline(false);
+    simulation.setWorkerCount(getStressWorkerBudget().traffic);  // As in stress mode
+    Level3Autopilot autopilot(randomService.stream(RandomStream::Autopilot)());
+    Level3Input input;
+    Level3Events events;
+
+    cout << "Level 3 soak test: " << minutes << " simulated minutes, traffic density " << trafficDensity
+         << ", " << simulation.getTraffic().size() << " vehicles, " << simulation.getWorkerCount() << " workers, seed "
+         << randomService.getMasterSeed() << endl;
+    cout << "  minute   wall s   speedup   steps/s   avg us   max us   cars   distance   footprint   runs   crashes   texts" << endl;
+
+    size_t runs = 1;
+    size_t crashes = 0;
+    size_t textsCompleted = 0;
+    bool textWasCompleted = false;
+    size_t firstFootprint = 0;
+    size_t lastFootprint = 0;
+    double firstWindowStepUs = 0.0;
+    double lastWindowStepUs = 0.0;
+    auto start = Clock::now();
+
+    for (long long done = 0; done < totalSteps;) {
+        long long windowSteps = min(STEPS_PER_WINDOW, totalSteps - done);
+        auto windowStart = Clock::now();
+        double worstStepUs = 0.0;
+
+        for (long long s = 0; s < windowSteps; ++s) {
+            input = autopilot.drive(simulation, STEP);
+            auto stepStart = Clock::now();
+            simulation.step(STEP, input, events);
+            worstStepUs = max(worstStepUs, chrono::duration<double, micro>(Clock::now() - stepStart).count());
+
+            if (simulation.isTextSequenceCompleted() && !textWasCompleted) textsCompleted++;
+            textWasCompleted = simulation.isTextSequenceCompleted();
+            if (simulation.isGameOver()) {
+                crashes++;
+                runs++;
+                simulation.reset();
+            }
+        }
+        done += windowSteps;
+
+        //--- Window Report ---
+        double windowSeconds = chrono::duration<double>(Clock::now() - windowStart).count();
+        double wallSeconds = chrono::duration<double>(Clock::now() - start).count();
+        double simulatedSeconds = done * STEP;
+        double averageStepUs = windowSeconds * 1.0e6 / windowSteps;
+        size_t footprint = simulation.getFootprint();
+        if (firstFootprint == 0) {
+            firstFootprint = footprint;
+            firstWindowStepUs = averageStepUs;
+        }
+        lastFootprint = footprint;
+        lastWindowStepUs = averageStepUs;
+
+        ostringstream row;
+        row.setf(ios::fixed);
+        row.precision(1);
+        row.width(8);
+        row << simulatedSeconds / 60.0 << "   ";
+        row.width(6);
+        row << wallSeconds << "   ";
+        row.width(7);
+        row << simulatedSeconds / wallSeconds << "   ";
+        row.precision(0);
+        row.width(7);
+        row << windowSteps / windowSeconds << "   ";
+        row.precision(2);
+        row.width(6);
+        row << averageStepUs << "   ";
+        row.width(6);
+        row << worstStepUs << "   ";
+        row.width(4);
+        row << simulation.getCars().size() << "   ";
+        row.precision(0);
+        row.width(8);
+        row << simulation.getTotalDistance() << "   ";
+        row.width(9);
+        row << footprint << "   ";
+        row.width(4);
+        row << runs << "   ";
+        row.width(7);
+        row << crashes << "   ";
+        row.width(5);
+        row << textsCompleted;
+        cout << row.str() << endl;
+
+        ostringstream record;
+        record << "{\"type\":\"soak\",\"simulated_minutes\":" << jsonNumber(simulatedSeconds / 60.0)
+               << ",\"wall_seconds\":" << jsonNumber(wallSeconds)
+               << ",\"speedup\":" << jsonNumber(simulatedSeconds / wallSeconds)
+               << ",\"steps_per_second\":" << jsonNumber(windowSteps / windowSeconds)
+               << ",\"avg_step_us\":" << jsonNumber(averageStepUs)
+               << ",\"max_step_us\":" << jsonNumber(worstStepUs)
+               << ",\"seed\":" << randomService.getMasterSeed()
+               << ",\"traffic_density\":" << trafficDensity
+               << ",\"cars\":" << simulation.getCars().size()
+               << ",\"vehicles\":" << simulation.getTraffic().size()
+               << ",\"workers\":" << simulation.getWorkerCount()
+               << ",\"distance\":" << jsonNumber(simulation.getTotalDistance())
+               << ",\"footprint_bytes\":" << footprint
+               << ",\"runs\":" << runs
+               << ",\"crashes\":" << crashes
+               << ",\"texts_completed\":" << textsCompleted << "}";
+        benchmarkLog.write(record.str());
+    }
+
+    //--- Summary ---
+    // Step cost drift compares the last window with the first (the first includes warm-up)
+    bool grew = lastFootprint > firstFootprint;
+    double drift = firstWindowStepUs > 0.0 ? (lastWindowStepUs / firstWindowStepUs - 1.0) * 100.0 : 0.0;
+    cout << "Footprint: " << firstFootprint << " -> " << lastFootprint << " bytes"
+         << (grew ? " (GREW)" : " (stable)") << endl;
+    cout << "Step cost drift: " << drift << "% (last window vs first)" << endl;
+    return grew ? 1 : 0;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+using namespace std;
+
+//=== LEVEL 3 SOAK TEST ===
+// Drives Level 3 headless for hours of simulated time to expose leaks and drift:
+// - Level3Simulation stepped at a fixed 60 Hz by Level3Autopilot, both seeded from the master
+//   seed (fixed unless --seed is given: reproducible),
+//   as fast as the machine allows; a crash starts a new run, like pressing R. The traffic flow
+//   gets the workers stress mode gives it (getStressWorkerBudget)
+// - Every 10 simulated minutes: wall time, speedup over real time, step cost (average and worst),
+//   traffic, distance, memory footprint and secret text sequences completed
+// Prints a report to the console and writes one "soak" record per window to the benchmark log
+// Run with --soak [minutes]; no window or audio is created
+// Returns: process exit code (non-zero if the simulation's footprint grew after the first window)
+int runLevel3Soak(float minutes, int trafficDensity);
@@ -0,0 +1,94 @@
+#include "LoadingState.h"
+#include "NavigationSounds.h"
+#include "ResourceManager.h"
+
+//=== LOADING STATE CLASS ===
+// Shows asset loading progress while worker threads decode the startup assets
+// Keeps the window responsive during startup instead of blocking on serial loads
+class LoadingState : public GameStateHandler {
+public:
+    //=== RESOURCE LIFECYCLE ===
+    // Launch decoding immediately so the progress screen appears on the first frame
+    void load(RenderWindow& window) override {
+        fontHandle = resources.acquireFont("arial.ttf");
+
+        loader = make_unique<AssetLoader>();
+        loader->addSoundBuffer("Sounds/UI_Hover.ogg");
+        loader->addSoundBuffer("Sounds/UI_Select.ogg");
+        loader->addSoundBuffer("Sounds/UI_Back.ogg");
+        loader->start();
+    }
+
+    // The navigation sounds hold their own references, so the loader can go
+    void unload() override {
+        loader.reset();
+        resources.release(fontHandle);
+    }
+
+    //=== FRAME HOOKS ===
+    void update(RenderWindow& window, float deltaTime, GameState& state) override {
+        // Register everything the workers finished since the last frame
+        loader->update();
+
+        // All assets resident - UI sounds now resolve from the cache without decoding
+        if (loader->isFinished()) {
+            navSounds.loadSounds();
+            state = INTRODUCTION;
+        }
+    }
+
+    void draw(RenderWindow& window) override;
+
+private:
+    FontHandle fontHandle;              // Shared text rendering font
+    unique_ptr<AssetLoader> loader;     // Startup decode jobs
+};
+
+//=== LOADING SCREEN RENDERING ===
+void LoadingState::draw(RenderWindow& window)
+{
+    const Font& font = resources.get(fontHandle);
+
+    //=== RENDERING SETUP ===
+    window.clear(Color(20, 20, 40));  // Same dark blue as the introduction screen
+
+    //=== LOADING TITLE ===
+    Text title(font, "Loading...", 60);
+    title.setStyle(Text::Bold);
+    title.setFillColor(Color::Cyan);
+    auto titleBounds = title.getLocalBounds();
+    title.setOrigin(Vector2f(titleBounds.size.x / 2.f, titleBounds.size.y / 2.f));
+    title.setPosition(Vector2f(window.getSize().x / 2.f, window.getSize().y / 2.f - 80.f));
+    window.draw(title);
+
+    //=== PROGRESS BAR ===
+    // Outline frame with a fill proportional to the completed job count
+    const float barWidth = window.getSize().x * 0.5f;
+    const float barHeight = 30.f;
+    Vector2f barPosition(window.getSize().x / 2.f - barWidth / 2.f, window.getSize().y / 2.f);
+
+    RectangleShape barFrame(Vector2f(barWidth, barHeight));
+    barFrame.setPosition(barPosition);
+    barFrame.setFillColor(Color::Transparent);
+    barFrame.setOutlineColor(Color::White);
+    barFrame.setOutlineThickness(2.f);
+    window.draw(barFrame);
+
+    RectangleShape barFill(Vector2f(barWidth * loader->getProgress(), barHeight));
+    barFill.setPosition(barPosition);
+    barFill.setFillColor(Color(100, 255, 100));
+    window.draw(barFill);
+
+    //=== PROGRESS COUNTER ===
+    Text counter(font, to_string(loader->getCompletedCount()) + " / " + to_string(loader->getJobCount()) + " assets", 24);
+    counter.setFillColor(Color(200, 200, 255));
+    auto counterBounds = counter.getLocalBounds();
+    counter.setOrigin(Vector2f(counterBounds.size.x / 2.f, 0));
+    counter.setPosition(Vector2f(window.getSize().x / 2.f, barPosition.y + barHeight + 20.f));
+    window.draw(counter);
+}
+
+//=== FACTORY ===
+unique_ptr<GameStateHandler> createLoadingState() {
+    return make_unique<LoadingState>();
+}
\ No newline at end of file
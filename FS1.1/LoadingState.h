@@ -0,0 +1,15 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include "GameStateHandler.h"
+
+using namespace sf;
+using namespace std;
+
+//=== LOADING STATE FACTORY ===
+// Startup progress screen while the UI sounds decode in the background
+// Each frame uploads finished assets (main thread only) and draws a progress bar
+// Transitions to INTRODUCTION once every queued asset has been registered
+// Level assets are not loaded here: each pre-level screen preloads its own level (atlas
+// pages included, see TextureAtlas.h)
+unique_ptr<GameStateHandler> createLoadingState();
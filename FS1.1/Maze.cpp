@@ -1,4 +1,5 @@
 #include "Maze.h"
+#include "Random.h"
 
 using namespace sf;
 using namespace std;
@@ -10,6 +11,14 @@ Maze::Maze(int screenWidth, int screenHeight, int cs) {
     initialize(screenWidth, screenHeight, cs);
 }
 
+//=== MAZE DESTRUCTOR ===
+// Drops this maze's references to the shared textures
+Maze::~Maze() {
+    backgroundSprite.reset();  // Sprite must not outlive its texture
+    resources.release(backgroundTexture);
+    resources.release(wallTexture);
+}
+
 //=== MAZE INITIALIZATION SYSTEM ===
 // Common initialization logic used by constructor and resize
 void Maze::initialize(int screenWidth, int screenHeight, int cs) {
@@ -45,7 +54,7 @@ void Maze::initialize(int screenWidth, int screenHeight, int cs) {
     playerSpeed = 4.0f * static_cast<float>(cellSize); // 4 cells per second, scaled to pixels
 
     //=== TEXTURE LOADING ===
-    // Always reload textures to ensure they're valid after resize
+    // Acquire textures on first use; resize keeps the already decoded textures
     loadTextures();
 }
 
@@ -55,9 +64,7 @@ void Maze::resize(int screenWidth, int screenHeight, int cs) {
     // Clear existing grid to prevent any potential access issues
     grid.clear();
     
-    // Reset texture state to force reload
-    texturesLoaded = false;
-    backgroundSprite.reset(); // Clear the optional sprite
+    // Textures are kept: they do not depend on maze dimensions
     
     // Reinitialize with new dimensions
     initialize(screenWidth, screenHeight, cs);
@@ -71,33 +78,34 @@ void Maze::resize(int screenWidth, int screenHeight, int cs) {
 bool Maze::loadTextures() {
     bool allLoaded = true;
     
-    // Reset texture state
-    texturesLoaded = false;
-    backgroundSprite.reset();
-    
-    // Try to load background texture
-    if (!backgroundTexture.loadFromFile("Images/maze_background.jpg")) {
+    // Try to acquire background texture (decoded only on the first request)
+    if (!backgroundTexture.isValid()) {
+        backgroundTexture = resources.acquireTexture("Images/maze_background.jpg");
+        if (backgroundTexture.isValid()) {
+            // Set texture to repeat for tiling
+            resources.get(backgroundTexture).setRepeated(true);
+            cout << "Loaded maze background texture successfully." << endl;
+        }
+    }
+    if (!backgroundTexture.isValid()) {
         cerr << "Warning: Could not load maze background texture. Using default background." << endl;
         allLoaded = false;
-    } else {
-        // Set texture to repeat for tiling
-        backgroundTexture.setRepeated(true);
-        // Create sprite with the loaded texture
-        backgroundSprite = Sprite(backgroundTexture);
-        cout << "Loaded maze background texture successfully." << endl;
+    } else if (!backgroundSprite.has_value()) {
+        // Create sprite with the shared texture
+        backgroundSprite = Sprite(resources.get(backgroundTexture));
     }
     
-    // Try to load wall texture
-    if (!wallTexture.loadFromFile("Images/maze_wall.jpg")) {
+    // Try to acquire wall texture (packed in the texture atlas, standalone otherwise)
+    if (!wallRegion.texture && textureAtlas.acquire("Images/maze_wall.jpg", wallRegion, wallTexture)) {
+        cout << "Loaded wall texture successfully." << endl;
+    }
+    if (!wallRegion.texture) {
         cerr << "Warning: Could not load wall texture. Using default walls." << endl;
         allLoaded = false;
-    } else {
-        // Set texture to repeat for tiling
-        wallTexture.setRepeated(true);
-        cout << "Loaded wall texture successfully." << endl;
     }
     
     texturesLoaded = allLoaded;
+    wallVerticesDirty = true;  // Texture coordinates follow the wall region
     return allLoaded;
 }
 
@@ -105,6 +113,8 @@ bool Maze::loadTextures() {
 // Generates a new random maze using recursive backtracking algorithm
 // Creates a perfect maze with exactly one path between any two points
 void Maze::generate() {
+    wallVerticesDirty = true;
+    
     // Validate maze dimensions before generation
     if (width < 1 || height < 1) {
         cerr << "Error: Invalid maze dimensions for generation: " << width << "x" << height << endl;
@@ -138,8 +148,7 @@ void Maze::generate() {
     stack.push({ x, y });         // Add starting position to stack
 
     //=== RANDOM NUMBER GENERATION SETUP ===
-    random_device rd;             // Hardware random number generator
-    mt19937 g(rd());             // Mersenne Twister generator with random seed
+    Pcg32& g = randomService.stream(RandomStream::Maze);  // Continues across mazes (see Random.h)
 
     //=== MAIN GENERATION LOOP ===
     // Continue until all reachable cells have been visited
@@ -420,14 +429,15 @@ void Maze::draw(RenderWindow& window) {
         return;
     }
     
-    //=== EXTERNAL SETTINGS ACCESS ===
-    extern float gamma; // Access gamma setting from SettingsState
+    // Resolve shared textures once per frame
+    const Texture& bgTexture = resources.get(backgroundTexture);
+    const Texture* wallTex = texturesLoaded ? wallRegion.texture : nullptr;
 
     //=== BACKGROUND RENDERING ===
     // Only render background if textures are valid and loaded
     if (texturesLoaded && backgroundSprite.has_value()) {
         // Additional validation that the texture is valid
-        if (backgroundTexture.getSize().x > 0 && backgroundTexture.getSize().y > 0) {
+        if (bgTexture.getSize().x > 0 && bgTexture.getSize().y > 0) {
             // Calculate how many times to tile the background texture
             int mazePixelWidth = width * cellSize;
             int mazePixelHeight = height * cellSize;
@@ -441,89 +451,24 @@ void Maze::draw(RenderWindow& window) {
 
     //=== WALL RENDERING CONFIGURATION ===
     // Check if walls should be visible (gamma > 0)
-    bool wallsVisible = (gamma > 0.0f);
+    bool wallsVisible = (wallGamma > 0.0f);
     
     if (wallsVisible) {
         float thickness = 2.0f;  // Wall thickness in pixels
         
         // Calculate wall color based on gamma setting (0.0f = invisible, 2.0f = white)
-        int brightness = static_cast<int>((gamma / 2.0f) * 255.0f);
+        int brightness = static_cast<int>((wallGamma / 2.0f) * 255.0f);
         brightness = std::max(0, std::min(255, brightness));          // Clamp to valid RGB range
         Color wallColor(brightness, brightness, brightness); // Grayscale color - use int values directly
 
-        //=== WALL RENDERING LOOP ===
-        // Draw walls for each cell in the maze grid
-        for (int y = 0; y < height; ++y) {
-            for (int x = 0; x < width; ++x) {
-                // Additional bounds check
-                if (y >= static_cast<int>(grid.size()) || x >= static_cast<int>(grid[y].size())) {
-                    continue;
-                }
-                
-                float px = static_cast<float>(x * cellSize);  // Pixel X coordinate of cell
-                float py = static_cast<float>(y * cellSize);  // Pixel Y coordinate of cell
-                
-                //=== INDIVIDUAL WALL RENDERING ===
-                // Draw each wall if it exists in the current cell
-                
-                if (grid[y][x].walls[0]) { // Top wall
-                    RectangleShape wall(Vector2f(static_cast<float>(cellSize), thickness));
-                    wall.setPosition(Vector2f(px, py));
-                    
-                    // Only use texture if textures are loaded and wall texture is valid
-                    if (texturesLoaded && wallTexture.getSize().x > 0 && wallTexture.getSize().y > 0) {
-                        // Use texture for wall
-                        wall.setTexture(&wallTexture);
-                        wall.setTextureRect(IntRect({0, 0}, {cellSize, static_cast<int>(thickness)}));
-                        // Apply gamma as a color overlay
-                        wall.setFillColor(Color(brightness, brightness, brightness, 255));
-                    } else {
-                        // Use solid color for wall
-                        wall.setFillColor(wallColor);
-                    }
-                    window.draw(wall);
-                }
-                if (grid[y][x].walls[1]) { // Right wall
-                    RectangleShape wall(Vector2f(thickness, static_cast<float>(cellSize)));
-                    wall.setPosition(Vector2f(px + static_cast<float>(cellSize) - thickness, py));
-                    
-                    if (texturesLoaded && wallTexture.getSize().x > 0 && wallTexture.getSize().y > 0) {
-                        wall.setTexture(&wallTexture);
-                        wall.setTextureRect(IntRect({0, 0}, {static_cast<int>(thickness), cellSize}));
-                        wall.setFillColor(Color(brightness, brightness, brightness, 255));
-                    } else {
-                        wall.setFillColor(wallColor);
-                    }
-                    window.draw(wall);
-                }
-                if (grid[y][x].walls[2]) { // Bottom wall
-                    RectangleShape wall(Vector2f(static_cast<float>(cellSize), thickness));
-                    wall.setPosition(Vector2f(px, py + static_cast<float>(cellSize) - thickness));
-                    
-                    if (texturesLoaded && wallTexture.getSize().x > 0 && wallTexture.getSize().y > 0) {
-                        wall.setTexture(&wallTexture);
-                        wall.setTextureRect(IntRect({0, 0}, {cellSize, static_cast<int>(thickness)}));
-                        wall.setFillColor(Color(brightness, brightness, brightness, 255));
-                    } else {
-                        wall.setFillColor(wallColor);
-                    }
-                    window.draw(wall);
-                }
-                if (grid[y][x].walls[3]) { // Left wall
-                    RectangleShape wall(Vector2f(thickness, static_cast<float>(cellSize)));
-                    wall.setPosition(Vector2f(px, py));
-                    
-                    if (texturesLoaded && wallTexture.getSize().x > 0 && wallTexture.getSize().y > 0) {
-                        wall.setTexture(&wallTexture);
-                        wall.setTextureRect(IntRect({0, 0}, {static_cast<int>(thickness), cellSize}));
-                        wall.setFillColor(Color(brightness, brightness, brightness, 255));
-                    } else {
-                        wall.setFillColor(wallColor);
-                    }
-                    window.draw(wall);
-                }
-            }
+        //=== WALL RENDERING ===
+        // Every wall is one batch of textured quads, drawn with a single call
+        if (wallVerticesDirty || wallVerticesColor != wallColor) {
+            buildWallVertices(thickness, wallColor);
         }
+        RenderStates states;
+        states.texture = wallTex;
+        window.draw(wallVertices, states);
     }
 
     //=== EXIT MARKER RENDERING ===
@@ -534,6 +479,54 @@ void Maze::draw(RenderWindow& window) {
     window.draw(exit);
 }
 
+//=== WALL GEOMETRY ===
+// Rebuilds the wall quads (after generation, a texture change or a brightness change)
+// Walls longer than the wall image are split into image-sized tiles: atlas regions cannot
+// repeat, so each tile maps the image from its top-left corner instead of stretching it
+void Maze::buildWallVertices(float thickness, Color color) {
+    wallVertices.clear();
+    float length = static_cast<float>(cellSize);
+    Vector2f tile(length, length);  // Untextured walls: one quad each
+    if (wallRegion.texture && wallRegion.rect.size.x > 0 && wallRegion.rect.size.y > 0) {
+        tile = Vector2f(wallRegion.rect.size);
+    }
+
+    auto addWall = [&](float left, float top, float wallWidth, float wallHeight) {
+        for (float y = 0.0f; y < wallHeight; y += tile.y) {
+            for (float x = 0.0f; x < wallWidth; x += tile.x) {
+                Vector2f size(min(tile.x, wallWidth - x), min(tile.y, wallHeight - y));
+                addWallQuad(Vector2f(left + x, top + y), size, color);
+            }
+        }
+    };
+
+    for (int y = 0; y < height && y < static_cast<int>(grid.size()); ++y) {
+        for (int x = 0; x < width && x < static_cast<int>(grid[y].size()); ++x) {
+            float px = static_cast<float>(x * cellSize);  // Pixel X coordinate of cell
+            float py = static_cast<float>(y * cellSize);  // Pixel Y coordinate of cell
+            const Cell& cell = grid[y][x];
+            if (cell.walls[0]) addWall(px, py, length, thickness);                        // Top
+            if (cell.walls[1]) addWall(px + length - thickness, py, thickness, length);   // Right
+            if (cell.walls[2]) addWall(px, py + length - thickness, length, thickness);   // Bottom
+            if (cell.walls[3]) addWall(px, py, thickness, length);                        // Left
+        }
+    }
+
+    wallVerticesColor = color;
+    wallVerticesDirty = false;
+}
+
+// Two triangles; texture coordinates start at the wall image's top-left corner
+void Maze::addWallQuad(Vector2f position, Vector2f size, Color color) {
+    Vector2f uv(wallRegion.rect.position);
+    Vector2f corners[4] = { position, position + Vector2f(size.x, 0.0f), position + size, position + Vector2f(0.0f, size.y) };
+    Vector2f texCoords[4] = { uv, uv + Vector2f(size.x, 0.0f), uv + size, uv + Vector2f(0.0f, size.y) };
+    const int order[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int corner : order) {
+        wallVertices.append(Vertex{ corners[corner], color, texCoords[corner] });
+    }
+}
+
 //=== PLAYER RENDERING SYSTEM ===
 // Draws the player at their current smooth pixel position
 // Updates position and renders the player circle
@@ -7,6 +7,8 @@
 #include <iostream>
 #include <optional>
 #include <algorithm>
+#include "ResourceManager.h"
+#include "TextureAtlas.h"
 
 using namespace sf;
 using namespace std;
@@ -27,6 +29,14 @@ public:
     //   cellSize - Size of each maze cell in pixels (determines maze complexity)
     Maze(int screenWidth, int screenHeight, int cellSize);
 
+    //=== DESTRUCTOR ===
+    // Releases the shared maze textures back to the resource manager
+    ~Maze();
+
+    // Texture handles are reference counted - copying would double-release them
+    Maze(const Maze&) = delete;
+    Maze& operator=(const Maze&) = delete;
+
     //=== MAZE GENERATION SYSTEM ===
     // Generate a new random maze layout using recursive backtracking algorithm
     // Creates a perfect maze (no loops, single path between any two points)
@@ -42,15 +52,19 @@ public:
     void resize(int screenWidth, int screenHeight, int cellSize);
 
     //=== TEXTURE LOADING SYSTEM ===
-    // Load background and wall textures from files
+    // Acquire background and wall textures from the shared resource cache
+    // Textures are decoded only once; later calls (initialize/resize) reuse the handles
     // Returns: true if all textures loaded successfully, false otherwise
     bool loadTextures();
 
     //=== RENDERING SYSTEM ===
     // Draw the complete maze structure including background, walls and exit marker
-    // Uses gamma setting from SettingsState for dynamic wall visibility
+    // Uses the wall gamma set by setWallGamma for dynamic wall visibility
     void draw(RenderWindow& window);
 
+    // Wall brightness from the gamma setting (0.0f = invisible, 2.0f = white)
+    void setWallGamma(float gamma) { wallGamma = gamma; }
+
     // Draw the player at their current smooth pixel position
     // Renders player as a red circle with appropriate scaling
     void drawPlayer(RenderWindow& window);
@@ -96,10 +110,17 @@ private:
     float playerSpeed = 200.0f;            // Player movement speed in pixels per second
 
     //=== TEXTURE SYSTEM ===
-    Texture backgroundTexture;             // Background texture for maze floor
-    Texture wallTexture;                   // Texture for maze walls
+    TextureHandle backgroundTexture;       // Shared background texture for maze floor
+    TextureHandle wallTexture;             // Atlas page or standalone texture holding the wall image
+    AtlasRegion wallRegion;                // Wall image (atlas page or the standalone texture)
     optional<Sprite> backgroundSprite;     // Optional sprite for background rendering (avoids default constructor issues)
     bool texturesLoaded = false;           // Flag indicating if textures are successfully loaded
+    float wallGamma = 0.0f;                // Wall brightness setting (pushed by the owning state)
+
+    //=== WALL BATCH ===
+    VertexArray wallVertices{ PrimitiveType::Triangles };  // Every wall tile, one draw call
+    Color wallVerticesColor;               // Brightness the batch was built with
+    bool wallVerticesDirty = true;         // Layout or wall texture changed since the last build
 
     //=== INITIALIZATION SYSTEM ===
     // Common initialization logic used by constructor and resize
@@ -121,6 +142,11 @@ private:
     //   - Boundary checking to prevent movement outside maze
     bool canMoveTo(float x, float y);
 
+    //=== WALL GEOMETRY ===
+    // Fill wallVertices with every wall of the grid, tiled by the wall image
+    void buildWallVertices(float thickness, Color color);
+    void addWallQuad(Vector2f position, Vector2f size, Color color);
+
     //=== MAZE GENERATION HELPER FUNCTIONS ===
     
     // Remove the wall between two adjacent cells during maze generation
@@ -0,0 +1,159 @@
+#include "MenuState.h"
+#include "NavigationSounds.h"
+#include "ResourceManager.h"
+#include "Input.h"
+
+extern GameState previousState;  // Return target for the settings menu
+
+//=== MAIN MENU STATE CLASS ===
+// Primary application entry point and navigation hub
+class MenuState : public GameStateHandler {
+public:
+    //=== RESOURCE LIFECYCLE ===
+    // Builds the title and menu texts once per load (they reference the shared font)
+    void load(RenderWindow& window) override;
+
+    void unload() override {
+        menuTexts.clear();     // Texts must not outlive their font
+        title.reset();
+        resources.release(fontHandle);
+    }
+
+    //=== FRAME HOOKS ===
+    void update(RenderWindow& window, float deltaTime, GameState& state) override;
+    void draw(RenderWindow& window) override;
+
+private:
+    //=== MAIN MENU CONFIGURATION ===
+    // Define the primary menu options available to the player
+    const vector<string> options = { "Start", "Settings", "Exit" };
+    int selected = 0;                   // Index of the currently selected menu option
+
+    FontHandle fontHandle;              // Shared text rendering font
+    vector<Text> menuTexts;             // One text per option
+    optional<Text> title;               // Application title
+
+    // Execute the action of the selected menu item
+    void activateSelection(RenderWindow& window, GameState& state);
+};
+
+//=== MENU TEXT OBJECTS PREPARATION ===
+void MenuState::load(RenderWindow& window) {
+    fontHandle = resources.acquireFont("arial.ttf");  // Cache hit - already opened by main
+    const Font& font = resources.get(fontHandle);
+
+    // Create and configure text objects for each menu option
+    for (size_t i = 0; i < options.size(); ++i) {
+        Text t(font, options[i], 50);              // Create text with font and size
+        t.setStyle(Text::Italic | Text::Bold);     // Apply styling
+        t.setFillColor(Color::White);              // Set text color
+        
+        // Calculate text bounds for centering
+        auto bounds = t.getLocalBounds();
+        t.setOrigin(Vector2f(bounds.size.x / 2.f, bounds.size.y / 2.f));  // Center origin
+        
+        // Position text in center column with vertical spacing
+        t.setPosition(Vector2f(window.getSize().x / 2.f, window.getSize().y / 2.f + i * 80.f));
+        menuTexts.push_back(t);  // Add to menu text collection
+    }
+
+    //=== TITLE TEXT CONFIGURATION ===
+    // Create and configure the main application title
+    title.emplace(font, "/Setting Puzzles/", 100);
+    title->setStyle(Text::Bold | Text::Underlined);  // Bold and underlined styling
+    title->setFillColor(Color::Blue);                // Blue color for distinction
+    
+    // Center title horizontally and position in upper portion of screen
+    auto titleBounds = title->getLocalBounds();
+    title->setOrigin(Vector2f(titleBounds.size.x / 2.f, titleBounds.size.y / 2.f));
+    title->setPosition(Vector2f(window.getSize().x / 2.f, window.getSize().y / 4.f));
+}
+
+//=== MAIN MENU INPUT AND NAVIGATION ===
+void MenuState::update(RenderWindow& window, float deltaTime, GameState& state) {
+    //=== MOUSE POSITION TRACKING ===
+    // Get mouse position for hover detection and menu selection
+    Vector2f mousePos = window.mapPixelToCoords(input.getMousePosition());
+
+    //=== MOUSE HOVER DETECTION SYSTEM ===
+    // Check if mouse is hovering over any menu item and play sound on change
+    for (size_t i = 0; i < menuTexts.size(); ++i) {
+        if (menuTexts[i].getGlobalBounds().contains(mousePos)) {
+            if (selected != static_cast<int>(i)) {
+                navSounds.playHover(); // Play hover sound when selection changes
+            }
+            selected = static_cast<int>(i);  // Update selected menu item
+            break;  // Exit loop once hover target found
+        }
+    }
+
+    //=== MOUSE CLICK HANDLING SYSTEM ===
+    // Process left mouse button clicks for menu selection
+    if (input.wasPressed(Mouse::Button::Left)) {
+        navSounds.playSelect();         // Play selection sound
+        activateSelection(window, state);
+    }
+
+    //=== KEYBOARD NAVIGATION SYSTEM ===
+    // Handle W key (up navigation) with sound feedback
+    if (input.wasPressed(Keyboard::Key::W)) {
+        // Move selection up with wraparound
+        selected = (selected - 1 + static_cast<int>(options.size())) % static_cast<int>(options.size());
+        navSounds.playHover(); // Play hover sound for keyboard navigation
+    }
+    
+    // Handle S key (down navigation) with sound feedback
+    if (input.wasPressed(Keyboard::Key::S)) {
+        // Move selection down with wraparound
+        selected = (selected + 1) % static_cast<int>(options.size());
+        navSounds.playHover(); // Play hover sound for keyboard navigation
+    }
+
+    //=== KEYBOARD SELECTION SYSTEM ===
+    // Handle ENTER key for menu item activation
+    if (input.wasPressed(Keyboard::Key::Enter)) {
+        navSounds.playSelect(); // Play select sound
+        activateSelection(window, state);
+    }
+
+    //=== SETTINGS SHORTCUT SYSTEM ===
+    // Handle F1 key for direct settings access
+    if (input.wasPressed(Keyboard::Key::F1)) {
+        navSounds.playSelect();  // Play selection sound
+        previousState = MENU;    // Store current state
+        state = SETTINGS;        // Open settings menu
+    }
+}
+
+void MenuState::activateSelection(RenderWindow& window, GameState& state) {
+    switch (selected) {
+    case 0: state = PRELEVEL1; break;   // Start game (go to pre-level screen)
+    case 1: 
+        previousState = MENU;           // Store current state
+        state = SETTINGS;               // Open settings menu
+        break;
+    case 2: state = EXIT; window.close(); break; // Exit application
+    }
+}
+
+//=== MAIN MENU RENDERING ===
+// Draw title and all menu options
+void MenuState::draw(RenderWindow& window) {
+    window.draw(*title);                   // Application title
+    for (size_t i = 0; i < menuTexts.size(); ++i) {
+        window.draw(menuTexts[i]);         // Individual menu items
+    }
+    
+    //=== MENU SELECTION INDICATOR ===
+    // Red circle next to the selected option
+    CircleShape selector(20.f);          // 20 pixel radius circle
+    selector.setFillColor(Color::Red);   // Red color for visibility
+    Vector2f pos = menuTexts[selected].getPosition();
+    selector.setPosition(Vector2f(pos.x - 200.f, pos.y - 8.f));  // Position left of text
+    window.draw(selector);               // Red circle indicator
+}
+
+//=== FACTORY ===
+unique_ptr<GameStateHandler> createMenuState() {
+    return make_unique<MenuState>();
+}
\ No newline at end of file
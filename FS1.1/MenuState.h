@@ -0,0 +1,12 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include "GameStateHandler.h"
+
+using namespace sf;
+using namespace std;
+
+//=== MAIN MENU STATE FACTORY ===
+// Creates the primary navigation hub: Start, Settings, Exit
+// Supports mouse hover/click and W/S + ENTER keyboard navigation with sound feedback
+unique_ptr<GameStateHandler> createMenuState();
@@ -0,0 +1,270 @@
+#include "MusicPlayer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include "ResourceManager.h"
+
+using namespace sf;
+using namespace std;
+
+//=== CONSTRUCTOR / DESTRUCTOR ===
+MusicPlayer::MusicPlayer(unsigned int sampleRate)
+    : rawSamples(4096 * 2), mixBlock(BlockFrames * 2), mixSamples(BlockFrames * 2), chunkSamples(ChunkFrames * 2) {
+    initialize(2, sampleRate, { SoundChannel::FrontLeft, SoundChannel::FrontRight });
+    decoder = thread(&MusicPlayer::run, this);
+}
+
+// Both worker threads read the decks and the ring: stop them before members are destroyed
+MusicPlayer::~MusicPlayer() {
+    stop();
+    running.store(false);
+    wake.notify_all();
+    decoder.join();
+}
+
+//=== TRACK CONTROL ===
+
+void MusicPlayer::prefetch(const char* path) {
+    Request request;
+    request.path = path;
+    if (requests.push(request)) {
+        wake.notify_one();
+    }
+}
+
+void MusicPlayer::crossfadeTo(const char* path, float fadeSeconds) {
+    Request request;
+    request.path = path;
+    request.fadeSeconds = fadeSeconds;
+    request.crossfade = true;
+    if (requests.push(request)) {
+        wake.notify_one();
+    }
+}
+
+//=== DECODER THREAD ===
+
+void MusicPlayer::run() {
+    while (running.load()) {
+        auto workStart = chrono::steady_clock::now();
+        Request request;
+        while (requests.pop(request)) {
+            handle(request);
+        }
+
+        // Keep the mix a fixed distance ahead of playback
+        while (output.size() + BlockFrames * 2 <= BufferedFrames * 2) {
+            mixNextBlock();
+        }
+        busyNanoseconds.fetch_add(static_cast<uint64_t>(
+            chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - workStart).count()));
+
+        // Sleep until a request arrives or the stream has drained a few blocks
+        unique_lock<mutex> lock(wakeMutex);
+        wake.wait_for(lock, chrono::milliseconds(5), [this] { return !running.load() || requests.size() > 0; });
+    }
+}
+
+void MusicPlayer::handle(const Request& request) {
+    Deck* deck = findDeck(request.path);
+    if (!deck) {
+        deck = openDeck(request.path);  // The only place a file is opened
+    }
+    if (!deck || !request.crossfade) return;
+    if (deck->state == DeckState::Playing && deck->target == 1.0f) return;  // Already the current track
+
+    //=== CROSSFADE START ===
+    // Every other playing deck ramps to silence while this one ramps up, starting from
+    // whatever gain it has (a track that was fading out turns around without restarting)
+    float fadeFrames = max(1.0f, request.fadeSeconds * getSampleRate());
+    for (Deck& other : decks) {
+        if (&other != deck && other.state == DeckState::Playing) {
+            other.target = 0.0f;
+            other.gainStep = 1.0f / fadeFrames;
+        }
+    }
+    deck->state = DeckState::Playing;
+    deck->target = 1.0f;
+    deck->gainStep = 1.0f / fadeFrames;
+}
+
+MusicPlayer::Deck* MusicPlayer::findDeck(const char* path) {
+    for (Deck& deck : decks) {
+        if (deck.state != DeckState::Closed && strcmp(deck.path, path) == 0) {
+            return &deck;
+        }
+    }
+    return nullptr;
+}
+
+// Open a track into a free deck and decode its first PrefetchSeconds
+// Reuses, in order: a closed deck, a prefetched deck, the quietest deck fading out
+MusicPlayer::Deck* MusicPlayer::openDeck(const char* path) {
+    Deck* deck = nullptr;
+    for (Deck& candidate : decks) {
+        if (candidate.state == DeckState::Closed) {
+            deck = &candidate;
+            break;
+        }
+    }
+    for (Deck& candidate : decks) {
+        if (!deck && candidate.state == DeckState::Prefetched) {
+            deck = &candidate;
+        }
+    }
+    for (Deck& candidate : decks) {
+        if (candidate.target == 0.0f && (!deck || (deck->state == DeckState::Playing && candidate.gain < deck->gain))) {
+            deck = &candidate;
+        }
+    }
+    if (!deck) return nullptr;
+    closeDeck(*deck);
+
+    if (!openMusicStream(deck->file, path) || deck->file.getChannelCount() == 0) {
+        cerr << "Failed to load " << path << endl;
+        closeDeck(*deck);
+        return nullptr;
+    }
+    deck->state = DeckState::Prefetched;
+    deck->path = path;
+    deck->channels = deck->file.getChannelCount();
+    deck->step = static_cast<float>(deck->file.getSampleRate()) / getSampleRate();
+
+    if (!decode(*deck, static_cast<size_t>(PrefetchSeconds * getSampleRate()))) {
+        cerr << "Failed to decode " << path << endl;
+        closeDeck(*deck);
+        return nullptr;
+    }
+    return deck;
+}
+
+void MusicPlayer::closeDeck(Deck& deck) {
+    if (deck.state != DeckState::Closed) {
+        deck.file.close();
+    }
+    deck.state = DeckState::Closed;
+    deck.path = nullptr;
+    deck.frames.clear();
+    deck.readFrame = 0;
+    deck.phase = 0.0;
+    deck.primed = false;
+    deck.gain = 0.0f;
+    deck.target = 0.0f;
+    deck.gainStep = 0.0f;
+}
+
+// Decode until at least minFrames unconsumed stereo frames at the output rate are buffered
+// Tracks loop seamlessly: at the end of the file decoding continues from the start
+bool MusicPlayer::decode(Deck& deck, size_t minFrames) {
+    if (deck.readFrame > 0) {
+        deck.frames.erase(deck.frames.begin(), deck.frames.begin() + deck.readFrame * 2);
+        deck.readFrame = 0;
+    }
+
+    bool rewound = false;
+    while (deck.frames.size() / 2 < minFrames) {
+        uint64_t count = deck.file.read(rawSamples.data(), rawSamples.size() / deck.channels * deck.channels);
+        if (count == 0) {
+            if (rewound) return false;  // Nothing readable even from the start
+            deck.file.seek(static_cast<uint64_t>(0));
+            rewound = true;
+            continue;
+        }
+        rewound = false;
+
+        //=== CHANNEL MAPPING AND RESAMPLING ===
+        // Mono is duplicated, extra channels are dropped; linear interpolation to the output rate
+        for (size_t frame = 0; frame < count / deck.channels; ++frame) {
+            const int16_t* in = &rawSamples[frame * deck.channels];
+            float left = in[0] / 32768.0f;
+            float right = deck.channels > 1 ? in[1] / 32768.0f : left;
+            if (!deck.primed) {
+                deck.previous[0] = left;
+                deck.previous[1] = right;
+                deck.primed = true;
+                continue;
+            }
+            while (deck.phase < 1.0) {
+                float t = static_cast<float>(deck.phase);
+                deck.frames.push_back(deck.previous[0] + (left - deck.previous[0]) * t);
+                deck.frames.push_back(deck.previous[1] + (right - deck.previous[1]) * t);
+                deck.phase += deck.step;
+            }
+            deck.phase -= 1.0;
+            deck.previous[0] = left;
+            deck.previous[1] = right;
+        }
+    }
+    return true;
+}
+
+// Mix one block of every playing deck into the output ring
+void MusicPlayer::mixNextBlock() {
+    fill(mixBlock.begin(), mixBlock.end(), 0.0f);
+    size_t playing = 0;
+
+    for (Deck& deck : decks) {
+        if (deck.state != DeckState::Playing) continue;
+        if (!decode(deck, BlockFrames)) {
+            cerr << "Failed to decode " << deck.path << endl;
+            closeDeck(deck);
+            continue;
+        }
+
+        //=== PER-SAMPLE CROSSFADE ===
+        // The linear ramp is shaped with sin() so fading pairs keep constant power
+        const float* in = &deck.frames[deck.readFrame * 2];
+        float gain = deck.gain;
+        for (size_t i = 0; i < BlockFrames; ++i) {
+            float shaped = sin(gain * 1.5707963f);
+            mixBlock[i * 2] += in[i * 2] * shaped;
+            mixBlock[i * 2 + 1] += in[i * 2 + 1] * shaped;
+            if (gain < deck.target) {
+                gain = min(deck.target, gain + deck.gainStep);
+            } else if (gain > deck.target) {
+                gain = max(deck.target, gain - deck.gainStep);
+            }
+        }
+        deck.gain = gain;
+        deck.readFrame += BlockFrames;
+
+        if (deck.gain <= 0.0f && deck.target <= 0.0f) {
+            closeDeck(deck);  // Faded out
+        } else {
+            playing++;
+        }
+    }
+
+    for (size_t i = 0; i < mixBlock.size(); ++i) {
+        float sample = min(max(mixBlock[i], -1.0f), 1.0f);
+        mixSamples[i] = static_cast<int16_t>(lrintf(sample * 32767.0f));
+    }
+    output.write(mixSamples.data(), mixSamples.size());  // The caller checked the space
+    audible.store(playing > 0);
+    playingDecks.store(playing);
+}
+
+float MusicPlayer::getBufferFill() const {
+    return static_cast<float>(output.size()) / (BufferedFrames * 2);
+}
+
+//=== SOUNDSTREAM OVERRIDES ===
+
+// Stream thread: hand the next mixed chunk to SFML (silence if the decoder fell behind)
+bool MusicPlayer::onGetData(Chunk& data) {
+    size_t count = output.read(chunkSamples.data(), chunkSamples.size());
+    if (count < chunkSamples.size()) {
+        fill(chunkSamples.begin() + count, chunkSamples.end(), static_cast<int16_t>(0));
+        if (audible.load()) {
+            underruns++;
+        }
+    }
+    data.samples = chunkSamples.data();
+    data.sampleCount = chunkSamples.size();
+    return true;  // Endless stream
+}
+
+// The mix has no timeline; seeking is meaningless
+void MusicPlayer::onSeek(Time timeOffset) {}
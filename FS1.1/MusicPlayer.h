@@ -0,0 +1,115 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "SpscQueue.h"
+
+using namespace sf;
+using namespace std;
+
+//=== MUSIC PLAYER CLASS DECLARATION ===
+// Background music as a single SoundStream with gapless, sample-accurate crossfades
+// - A decoder thread owns every track: it opens files, decodes, loops and mixes them, and
+//   writes the finished stereo mix into a lock-free ring read by the SFML stream thread
+// - prefetch() opens and pre-buffers the next track as soon as it is known (pre-level
+//   screens), so crossfadeTo() later starts mixing without touching the disk
+// - Crossfades are per-sample gain ramps inside the mix, so there is never a gap or click
+// - Main thread calls only push small requests into a lock-free queue: they never block
+// Track paths must have static storage duration (string literals)
+class MusicPlayer : public SoundStream {
+public:
+    explicit MusicPlayer(unsigned int sampleRate = 44100);
+    ~MusicPlayer() override;
+
+    MusicPlayer(const MusicPlayer&) = delete;
+    MusicPlayer& operator=(const MusicPlayer&) = delete;
+
+    //=== TRACK CONTROL (main thread) ===
+    // Open and decode the start of a track that is about to be needed
+    void prefetch(const char* path);
+
+    // Fade the current track(s) out and the given one in over fadeSeconds (looped)
+    // Prefetches the track first if that has not happened yet
+    void crossfadeTo(const char* path, float fadeSeconds = 1.5f);
+
+    //=== STATISTICS ===
+    size_t getUnderrunCount() const { return underruns.load(); }  // Chunks padded with silence
+    float getBufferFill() const;                                  // Mixed ahead, 1.0f = BufferedFrames
+    size_t getPlayingDeckCount() const { return playingDecks.load(); }
+    uint64_t getBusyNanoseconds() const { return busyNanoseconds.load(); }  // Decoder thread work, total
+
+private:
+    //=== REQUEST STRUCTURE ===
+    struct Request {
+        const char* path = nullptr;
+        float fadeSeconds = 0.0f;
+        bool crossfade = false;         // false: prefetch only
+    };
+
+    //=== DECK STRUCTURE ===
+    // One open track (decoder thread only)
+    enum class DeckState { Closed, Prefetched, Playing };
+    struct Deck {
+        DeckState state = DeckState::Closed;
+        const char* path = nullptr;
+        InputSoundFile file;
+        unsigned int channels = 0;
+        float step = 1.0f;              // Source frames per output frame
+
+        vector<float> frames;           // Decoded stereo frames at the output rate
+        size_t readFrame = 0;           // First unconsumed frame in frames
+
+        // Linear resampler state (previous source frame and position between frames)
+        float previous[2] = { 0.0f, 0.0f };
+        double phase = 0.0;
+        bool primed = false;
+
+        // Crossfade gain ramp
+        float gain = 0.0f;
+        float target = 0.0f;
+        float gainStep = 0.0f;          // Per output frame
+    };
+
+    static constexpr size_t DeckCount = 3;          // Two tracks fading out while a third fades in
+    static constexpr size_t BlockFrames = 1024;     // Frames mixed per decoder iteration
+    static constexpr size_t BufferedFrames = 8192;  // Mix kept ahead of playback (~186 ms)
+    static constexpr size_t ChunkFrames = 1024;     // Frames handed to SFML per onGetData
+    static constexpr float PrefetchSeconds = 1.0f;  // Decoded at prefetch time
+
+    // Decoder thread
+    thread decoder;
+    atomic<bool> running{ true };
+    mutex wakeMutex;                    // Only for sleeping; never held while decoding
+    condition_variable wake;
+    SpscQueue<Request, 64> requests;    // Main thread -> decoder thread
+    array<Deck, DeckCount> decks;
+    vector<int16_t> rawSamples;         // File read scratch
+    vector<float> mixBlock;             // Stereo float mix scratch
+    vector<int16_t> mixSamples;         // Converted block
+    atomic<size_t> playingDecks{ 0 };
+    atomic<uint64_t> busyNanoseconds{ 0 };
+
+    // Stream thread
+    SpscQueue<int16_t, BufferedFrames * 4> output;  // Interleaved stereo mix, decoder -> stream
+    vector<int16_t> chunkSamples;
+    atomic<bool> audible{ false };      // A deck is playing (silence is then an underrun)
+    atomic<size_t> underruns{ 0 };
+
+    //=== DECODER THREAD ===
+    void run();
+    void handle(const Request& request);
+    Deck* findDeck(const char* path);
+    Deck* openDeck(const char* path);
+    void closeDeck(Deck& deck);
+    bool decode(Deck& deck, size_t minFrames);      // false: track unreadable
+    void mixNextBlock();
+
+    //=== SOUNDSTREAM OVERRIDES ===
+    bool onGetData(Chunk& data) override;
+    void onSeek(Time timeOffset) override;
+};
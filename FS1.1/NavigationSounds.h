@@ -1,6 +1,8 @@
 #pragma once
 #include <SFML/Audio.hpp>
-#include <optional>
+#include <memory>
+#include "ResourceManager.h"
+#include "UiSoundMixer.h"
 
 using namespace sf;
 using namespace std;
@@ -12,46 +14,47 @@ using namespace std;
 
 struct NavigationSounds {
     //=== AUDIO BUFFER STORAGE ===
-    // Sound buffers store raw audio data loaded from files
+    // Handles to sound buffers owned by the global ResourceManager
     // Each buffer corresponds to a specific UI interaction type
-    // Buffers are persistent and shared between multiple Sound instances
+    // Held only while loadSounds() copies them into the mixer, then released
     
-    SoundBuffer hoverBuffer;    // Audio data for menu item hover/selection change
-                               // File: "Sounds/UI_Hover.ogg" 
-                               // Usage: When mouse hovers over items or keyboard changes selection
+    SoundBufferHandle hoverBuffer;  // Audio data for menu item hover/selection change
+                                    // File: "Sounds/UI_Hover.ogg"
+                                    // Usage: When mouse hovers over items or keyboard changes selection
     
-    SoundBuffer selectBuffer;   // Audio data for confirmation and positive actions
-                               // File: "Sounds/UI_Select.ogg"
-                               // Usage: Menu item activation, level start, settings confirmation
+    SoundBufferHandle selectBuffer; // Audio data for confirmation and positive actions
+                                    // File: "Sounds/UI_Select.ogg"
+                                    // Usage: Menu item activation, level start, settings confirmation
     
-    SoundBuffer backBuffer;     // Audio data for navigation backward and cancellation
-                               // File: "Sounds/UI_Back.ogg"  
-                               // Usage: Return to previous menu, cancel operations, ESC key
+    SoundBufferHandle backBuffer;   // Audio data for navigation backward and cancellation
+                                    // File: "Sounds/UI_Back.ogg"
+                                    // Usage: Return to previous menu, cancel operations, ESC key
     
-    SoundBuffer errorBuffer;    // Audio data for invalid actions and boundary conditions
-                               // File: "Sounds/UI_Error.ogg" (currently disabled)
-                               // Usage: Attempting invalid operations, hitting limits
+    SoundBufferHandle errorBuffer;  // Audio data for invalid actions and boundary conditions
+                                    // File: "Sounds/UI_Error.ogg" (currently disabled)
+                                    // Usage: Attempting invalid operations, hitting limits
     
-    //=== SOUND INSTANCE MANAGEMENT ===
-    // Optional Sound objects that can play the loaded audio buffers
-    // Using std::optional allows for graceful handling of loading failures
-    // Each sound can be played independently with individual volume/pitch control
+    //=== SOUND VOICE MANAGEMENT ===
+    // All UI sounds play through one always-running mixer stream (see UiSoundMixer.h)
+    // Each effect owns a small round-robin voice pool, so rapid triggers overlap
+    // instead of restarting a single Sound object
     
-    optional<Sound> hoverSound;    // Playable hover sound instance
-                                  // State: Active when hoverBuffer loads successfully
-                                  // Behavior: Immediate replacement on rapid hover changes
+    static constexpr size_t VoicesPerEffect = 4;  // Overlapping instances per effect
     
-    optional<Sound> selectSound;   // Playable selection confirmation sound instance  
-                                  // State: Active when selectBuffer loads successfully
-                                  // Behavior: Immediate replacement prevents sound overlap
+    unique_ptr<UiSoundMixer> mixer;  // Created by loadSounds() (not at static initialization)
+                                     // Started once and kept playing silence between sounds
     
-    optional<Sound> backSound;     // Playable back navigation sound instance
-                                  // State: Active when backBuffer loads successfully  
-                                  // Behavior: Indicates successful return navigation
+    UiSoundMixer::SoundId hoverSound = UiSoundMixer::InvalidId;   // Hover voices
+                                                                  // State: Valid when hoverBuffer loads successfully
     
-    optional<Sound> errorSound;    // Playable error notification sound instance
-                                  // State: Currently disabled (buffer loading commented out)
-                                  // Behavior: Would indicate invalid user actions
+    UiSoundMixer::SoundId selectSound = UiSoundMixer::InvalidId;  // Selection confirmation voices
+                                                                  // State: Valid when selectBuffer loads successfully
+    
+    UiSoundMixer::SoundId backSound = UiSoundMixer::InvalidId;    // Back navigation voices
+                                                                  // State: Valid when backBuffer loads successfully
+    
+    UiSoundMixer::SoundId errorSound = UiSoundMixer::InvalidId;   // Error notification voices
+                                                                  // State: Currently disabled (buffer loading commented out)
     
     //=== SYSTEM STATE MANAGEMENT ===
     // Configuration and status tracking for the audio system
@@ -78,45 +81,54 @@ struct NavigationSounds {
     //=== INITIALIZATION SYSTEM ===
     // Attempts to load all required audio files and initialize sound objects
     // Returns: true if all sounds loaded successfully, false otherwise  
-    // Side Effects: Sets soundsLoaded flag, creates Sound instances, applies initial volume
+    // Side Effects: Sets soundsLoaded flag, fills and starts the mixer, applies initial volume
     // Error Handling: Continues loading other sounds if individual files fail
     // Usage: Called once during application startup
     bool loadSounds();
     
     //=== VOLUME MANAGEMENT SYSTEM ===
-    // Updates volume for all active sound instances based on current soundVolume setting
+    // Updates the mixer volume based on current soundVolume setting
     // Called: When volume settings change or after initial sound loading
-    // Behavior: Only affects sounds that loaded successfully (optional check)
-    // Range: Applies soundVolume (0.0f-100.0f) directly to SFML sound objects
+    // Behavior: No effect until loadSounds() has created the mixer
+    // Range: Applies soundVolume (0.0f-100.0f) directly to the mixer stream
     void updateVolume();
     
     //=== AUDIO PLAYBACK INTERFACE ===
     // Methods for triggering specific UI sound effects with intelligent behavior
     
-    // Plays hover/selection change sound with immediate replacement
+    // Plays hover/selection change sound on a round-robin voice
     // Usage: Menu navigation, mouse hover events, keyboard selection changes
-    // Behavior: Stops any currently playing hover sound before starting new playback
-    // Purpose: Provides responsive audio feedback without sound overlap
+    // Behavior: Starts on the next hover voice, one audio chunk after the call
+    // Purpose: Provides responsive audio feedback when moving quickly through items
     void playHover();
     
-    // Plays selection confirmation sound with immediate replacement  
+    // Plays selection confirmation sound on a round-robin voice  
     // Usage: Menu item activation, level transitions, settings confirmation
-    // Behavior: Stops any currently playing select sound before starting new playback
+    // Behavior: Starts on the next select voice, one audio chunk after the call
     // Purpose: Provides clear confirmation feedback for positive actions
     void playSelect();
     
-    // Plays back navigation sound with immediate replacement
+    // Plays back navigation sound on a round-robin voice
     // Usage: Return to previous menu, cancel operations, ESC key presses
-    // Behavior: Stops any currently playing back sound before starting new playback  
+    // Behavior: Starts on the next back voice, one audio chunk after the call
     // Purpose: Provides audio feedback for navigation backward/cancellation
     void playBack();
     
-    // Plays error notification sound with immediate replacement
+    // Plays error notification sound on a round-robin voice
     // Usage: Invalid operations, boundary conditions, failed actions
-    // Behavior: Stops any currently playing error sound before starting new playback
+    // Behavior: Starts on the next error voice, one audio chunk after the call
     // Purpose: Provides negative feedback for invalid user actions
     // Note: Currently disabled due to commented-out buffer loading
     void playError();
+    
+    //=== LATENCY REPORT ===
+    // Times voices the mixer stream has started playing since the last call
+    // Usage: Called once per frame, before audio telemetry is sampled
+    void updateLatency();
+
+    // Prints trigger-to-playback latency measured by the mixer (average, max, last)
+    // Usage: Called once at shutdown
+    void reportLatency() const;
 };
 
 //=== GLOBAL INSTANCE DECLARATION ===
@@ -133,15 +145,16 @@ extern NavigationSounds navSounds;
 // Design Principles:
 // - Centralized audio management for consistent UI feedback
 // - Graceful degradation when audio files are missing
-// - Immediate sound replacement prevents audio overlap and lag
+// - Per-effect voice pools let repeated sounds overlap without restarting a source
 // - Volume control integrated with global settings system
-// - Optional-based design allows for partial loading success
+// - Invalid sound ids allow for partial loading success
 //
 // Performance Considerations:  
-// - Sound buffers loaded once and reused for all playback
-// - Minimal memory footprint with optional sound instances
-// - Immediate stop/play prevents memory leaks from overlapping sounds
-// - Volume updates only applied to successfully loaded sounds
+// - Sound buffers decoded once and copied into the mixer in output format
+// - The mixer stream never stops, so a trigger never waits for a source to start
+// - Triggers bypass the audio command thread and are read by the mix thread directly,
+//   which schedules them sample-accurately one ~6 ms chunk after the input
+// - Volume is a single stream volume applied through the audio command thread
 //
 // Error Handling Strategy:
 // - Individual sound loading failures don't prevent system operation
@@ -150,7 +163,7 @@ extern NavigationSounds navSounds;
 // - System continues functioning with reduced audio feedback
 //
 // Integration Points:
-// - Volume synchronized with global musicVolume setting (80% ratio)
+// - Volume follows the music volume setting (80% ratio) through a settings subscription in main()
 // - Called from all menu systems and navigation interfaces
 // - Consistent behavior across different game states and contexts
 // - F1 settings access provides real-time volume adjustment
\ No newline at end of file
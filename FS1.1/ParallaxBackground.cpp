@@ -0,0 +1,38 @@
+#include "ParallaxBackground.h"
+#include <cmath>
+
+using namespace sf;
+using namespace std;
+
+//=== LAYERS ===
+
+void ParallaxBackground::addLayer(const Texture& texture, Vector2f scale, float speed) {
+    layers.push_back({ &texture, scale, speed });
+}
+
+//=== FRAME ===
+
+void ParallaxBackground::scroll(float distance) {
+    for (Layer& layer : layers) {
+        float height = static_cast<float>(layer.texture->getSize().y);
+        if (height <= 0.0f) continue;
+        layer.offset = fmod(layer.offset + distance * layer.speed / layer.scale.y, height);
+        if (layer.offset < 0.0f) layer.offset += height;
+    }
+}
+
+void ParallaxBackground::draw(RenderTarget& target, Vector2f size) const {
+    for (const Layer& layer : layers) {
+        // Texture coordinates past the texture's edge wrap around (repeat mode)
+        float right = size.x / layer.scale.x;
+        float top = -layer.offset;
+        float bottom = size.y / layer.scale.y - layer.offset;
+        const Vertex quad[4] = {
+            { Vector2f(0.0f, 0.0f), Color::White, Vector2f(0.0f, top) },
+            { Vector2f(size.x, 0.0f), Color::White, Vector2f(right, top) },
+            { Vector2f(0.0f, size.y), Color::White, Vector2f(0.0f, bottom) },
+            { Vector2f(size.x, size.y), Color::White, Vector2f(right, bottom) }
+        };
+        target.draw(quad, 4, PrimitiveType::TriangleStrip, RenderStates(layer.texture));
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+//=== PARALLAX BACKGROUND CLASS DECLARATION ===
+// Vertically scrolling background made of stacked layers, each a repeating texture
+// - A layer is one full-screen quad: scrolling only shifts its texture coordinates and the
+//   texture's repeat mode wraps them, so each layer costs one quad and one draw call
+// - Layers move at their own share of the scroll speed (smaller = farther away) and are
+//   drawn in the order they were added
+// The textures must have setRepeated(true) and outlive the layers (clear() before releasing)
+class ParallaxBackground {
+public:
+    //=== LAYERS ===
+    // scale: screen pixels per texture pixel; speed: share of the scroll distance
+    void addLayer(const Texture& texture, Vector2f scale, float speed);
+    void clear() { layers.clear(); }
+    size_t getLayerCount() const { return layers.size(); }
+
+    //=== FRAME ===
+    // Move every layer down by its share of distance (screen pixels)
+    void scroll(float distance);
+    // Cover the area from (0, 0) to size
+    void draw(RenderTarget& target, Vector2f size) const;
+
+private:
+    struct Layer {
+        const Texture* texture;
+        Vector2f scale;
+        float speed;
+        float offset = 0.0f;            // Texture pixels scrolled, kept within one texture height
+    };
+    vector<Layer> layers;
+};
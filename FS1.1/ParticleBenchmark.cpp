@@ -0,0 +1,114 @@
+#include "ParticleBenchmark.h"
+#include "ParticleSystem.h"
+#include "BenchmarkTable.h"
+#include "Random.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+using namespace sf;
+using namespace std;
+
+//=== TIMING ===
+
+// Nanoseconds per particle of one step (repeated for 0.2 seconds)
+template <typename Step>
+static double timePerParticle(size_t count, Step step) {
+    return timeRepeated(step) * 1.0e9 / count;
+}
+
+// Exhaust-like particles around the screen center; seeded, so every system gets the same set
+static void fill(ParticleSystem& particles, size_t count, float lifetime) {
+    Pcg32 gen(1234);
+    ParticleStyle style;
+    style.velocity = Vector2f(0.0f, 60.0f);
+    style.velocitySpread = Vector2f(40.0f, 20.0f);
+    style.lifetime = lifetime;
+    style.lifetimeSpread = lifetime * 0.5f;
+    style.size = 3.0f;
+    style.growth = 6.0f;
+    style.color = Color(150, 150, 150, 160);
+    uniform_real_distribution<float> xDist(0.0f, 1920.0f);
+    uniform_real_distribution<float> yDist(0.0f, 1080.0f);
+    for (size_t i = 0; i < count; i += 100) {
+        particles.emit(Vector2f(xDist(gen), yDist(gen)), style, min<size_t>(100, count - i), gen);
+    }
+}
+
+//=== AGREEMENT CHECK ===
+
+// Largest difference between the scalar and vector paths after a second of 60 Hz steps
+// (short lifetimes, so removal runs on both as well)
+static float compareKernels(size_t count) {
+    ParticleSystem scalar(count, 1.5f);
+    ParticleSystem batch(count, 1.5f);
+    fill(scalar, count, 0.6f);
+    fill(batch, count, 0.6f);
+    for (int frame = 0; frame < 60; ++frame) {
+        scalar.updateScalar(1.0f / 60.0f, 200.0f);
+        batch.update(1.0f / 60.0f, 200.0f);
+    }
+    if (scalar.size() != batch.size()) return INFINITY;
+    float difference = 0.0f;
+    for (size_t i = 0; i < scalar.size(); ++i) {
+        difference = max(difference, fabs(scalar.x[i] - batch.x[i]));
+        difference = max(difference, fabs(scalar.y[i] - batch.y[i]));
+        difference = max(difference, fabs(scalar.edge[i] - batch.edge[i]));
+        difference = max(difference, fabs(scalar.life[i] - batch.life[i]));
+    }
+    return difference;
+}
+
+//=== BENCHMARK ===
+
+int runParticleBenchmark() {
+    const size_t sizes[] = { 1000, 10000, 100000 };
+    const double FRAME_BUDGET_US = 1000000.0 / 240.0;
+    const float STEP = 1.0f / 240.0f;
+    unsigned workers = max(2u, thread::hardware_concurrency()) - 1;  // Every other hardware thread
+    bool agreed = true;
+
+    cout << "Particle micro-benchmark (vector path: " << ParticleSystem::getKernelPath()
+         << ", " << workers << " workers)" << endl;
+    cout << "  particles   scalar ns   batch ns   threaded ns   vertices ns   frame us   240 fps" << endl;
+
+    for (size_t count : sizes) {
+        // Lifetimes far beyond the run keep the count constant while timing; no drag, or the
+        // velocities would decay into denormals over the thousands of steps and slow every path
+        ParticleSystem particles(count, 0.0f);
+        fill(particles, count, 1.0e6f);
+
+        double scalar = timePerParticle(count, [&]() { particles.updateScalar(STEP, 200.0f); });
+        double batch = timePerParticle(count, [&]() { particles.update(STEP, 200.0f); });
+        particles.setWorkerCount(workers);
+        double threaded = timePerParticle(count, [&]() { particles.update(STEP, 200.0f); });
+        particles.setWorkerCount(0);
+        double vertices = timePerParticle(count, [&]() { particles.buildVertices(); });
+
+        double frame = (min(batch, threaded) + vertices) * count / 1000.0;
+        bool fits = frame < FRAME_BUDGET_US;
+        float difference = compareKernels(count);
+        bool match = difference < 1.0e-3f;
+        agreed = agreed && match;
+
+        BenchmarkRow row("particles");
+        row.column("particles", count, 11);
+        row.text("path", ParticleSystem::getKernelPath());
+        row.field("workers", static_cast<size_t>(workers));
+        row.column("scalar_ns_per_particle", scalar, 9);
+        row.column("batch_ns_per_particle", batch, 8);
+        row.column("threaded_ns_per_particle", threaded, 11);
+        row.column("vertices_ns_per_particle", vertices, 11);
+        row.column("frame_us", frame, 8);
+        row.flag("fits_240fps", fits);
+        row.flag("match", match);
+        row.note() << "   " << (fits ? "yes" : "no");
+        if (!match) {
+            row.note() << " (MISMATCH: scalar and vector differ by " << difference << ")";
+        }
+        row.write();
+    }
+
+    return agreed ? 0 : 1;
+}
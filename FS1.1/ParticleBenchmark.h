@@ -0,0 +1,15 @@
+#pragma once
+
+using namespace std;
+
+//=== PARTICLE MICRO-BENCHMARK ===
+// Times one particle system step for several particle counts, up to the 100k target:
+// - "scalar": updateScalar (no vector instructions, main thread only)
+// - "batch": update with the vector kernel compiled into this build, main thread only
+// - "threaded": update with one worker per remaining hardware thread
+// - "vertices": building the single draw call's vertex list
+// The frame cost (fastest update plus vertices) is compared with a 240 fps frame (4.17 ms)
+// Prints a table to the console and writes one "particles" record per count to the benchmark log
+// Run with --microbench; no window or audio is created
+// Returns: process exit code (non-zero if the scalar and vector paths disagree)
+int runParticleBenchmark();
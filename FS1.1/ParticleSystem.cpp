@@ -0,0 +1,206 @@
+#include "ParticleSystem.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX__)
+#define PARTICLE_KERNEL_AVX 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PARTICLE_KERNEL_SSE 1
+#include <emmintrin.h>
+#endif
+
+using namespace sf;
+using namespace std;
+
+//=== INTEGRATION KERNEL ===
+// Per particle: velocity *= damping; position += (velocity + drift) * dt; edge += growth * dt; life -= dt
+
+struct ParticleStep {
+    float deltaTime;
+    float driftY;
+    float damping;                      // Velocity kept over the step
+};
+
+// Particles [first, last) one at a time
+static void integrateRange(ParticleSystem& particles, size_t first, size_t last, const ParticleStep& step) {
+    float* x = particles.x.data();
+    float* y = particles.y.data();
+    float* velocityX = particles.velocityX.data();
+    float* velocityY = particles.velocityY.data();
+    float* life = particles.life.data();
+    float* edge = particles.edge.data();
+    const float* growth = particles.growth.data();
+    for (size_t i = first; i < last; ++i) {
+        velocityX[i] *= step.damping;
+        velocityY[i] *= step.damping;
+        x[i] += velocityX[i] * step.deltaTime;
+        y[i] += (velocityY[i] + step.driftY) * step.deltaTime;
+        edge[i] += growth[i] * step.deltaTime;
+        life[i] -= step.deltaTime;
+    }
+}
+
+// Vector steps over [first, last), scalar tail
+static void integrateBatch(ParticleSystem& particles, size_t first, size_t last, const ParticleStep& step) {
+    size_t i = first;
+
+#if defined(PARTICLE_KERNEL_AVX) || defined(PARTICLE_KERNEL_SSE)
+    float* x = particles.x.data();
+    float* y = particles.y.data();
+    float* velocityX = particles.velocityX.data();
+    float* velocityY = particles.velocityY.data();
+    float* life = particles.life.data();
+    float* edge = particles.edge.data();
+    const float* growth = particles.growth.data();
+#endif
+
+#if defined(PARTICLE_KERNEL_AVX)
+    const __m256 deltaTime = _mm256_set1_ps(step.deltaTime);
+    const __m256 driftY = _mm256_set1_ps(step.driftY);
+    const __m256 damping = _mm256_set1_ps(step.damping);
+    for (; i + 8 <= last; i += 8) {
+        __m256 vx = _mm256_mul_ps(_mm256_loadu_ps(velocityX + i), damping);
+        __m256 vy = _mm256_mul_ps(_mm256_loadu_ps(velocityY + i), damping);
+        _mm256_storeu_ps(velocityX + i, vx);
+        _mm256_storeu_ps(velocityY + i, vy);
+        _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_mul_ps(vx, deltaTime)));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(_mm256_add_ps(vy, driftY), deltaTime)));
+        _mm256_storeu_ps(edge + i, _mm256_add_ps(_mm256_loadu_ps(edge + i), _mm256_mul_ps(_mm256_loadu_ps(growth + i), deltaTime)));
+        _mm256_storeu_ps(life + i, _mm256_sub_ps(_mm256_loadu_ps(life + i), deltaTime));
+    }
+#elif defined(PARTICLE_KERNEL_SSE)
+    const __m128 deltaTime = _mm_set1_ps(step.deltaTime);
+    const __m128 driftY = _mm_set1_ps(step.driftY);
+    const __m128 damping = _mm_set1_ps(step.damping);
+    for (; i + 4 <= last; i += 4) {
+        __m128 vx = _mm_mul_ps(_mm_loadu_ps(velocityX + i), damping);
+        __m128 vy = _mm_mul_ps(_mm_loadu_ps(velocityY + i), damping);
+        _mm_storeu_ps(velocityX + i, vx);
+        _mm_storeu_ps(velocityY + i, vy);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(vx, deltaTime)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_add_ps(vy, driftY), deltaTime)));
+        _mm_storeu_ps(edge + i, _mm_add_ps(_mm_loadu_ps(edge + i), _mm_mul_ps(_mm_loadu_ps(growth + i), deltaTime)));
+        _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), deltaTime));
+    }
+#endif
+
+    integrateRange(particles, i, last, step);
+}
+
+//=== CONSTRUCTOR ===
+
+ParticleSystem::ParticleSystem(size_t capacity, float drag)
+    : x(capacity), y(capacity), velocityX(capacity), velocityY(capacity), life(capacity),
+      fade(capacity), edge(capacity), growth(capacity), color(capacity), drag(drag) {
+    vertices.reserve(capacity * 6);
+}
+
+//=== EMISSION ===
+
+size_t ParticleSystem::emit(Vector2f position, const ParticleStyle& style, size_t requested, Pcg32& gen) {
+    size_t added = min(requested, capacity() - count);
+    dropped += requested - added;
+    uniform_real_distribution<float> spread(-1.0f, 1.0f);
+    for (size_t k = 0; k < added; ++k) {
+        size_t i = count++;
+        float lifetime = max(0.01f, style.lifetime + style.lifetimeSpread * spread(gen));
+        x[i] = position.x;
+        y[i] = position.y;
+        velocityX[i] = style.velocity.x + style.velocitySpread.x * spread(gen);
+        velocityY[i] = style.velocity.y + style.velocitySpread.y * spread(gen);
+        life[i] = lifetime;
+        fade[i] = 1.0f / lifetime;
+        edge[i] = style.size;
+        growth[i] = style.growth;
+        color[i] = style.color;
+    }
+    return added;
+}
+
+void ParticleSystem::clear() {
+    count = 0;
+    dropped = 0;
+}
+
+//=== SIMULATION ===
+
+void ParticleSystem::update(float deltaTime, float driftY) {
+    float damping = exp(-drag * deltaTime);
+    if (jobs.getWorkerCount() == 0 || count < MIN_PARALLEL_PARTICLES) {
+        integrateBatch(*this, 0, count, { deltaTime, driftY, damping });
+        removeDead();
+        return;
+    }
+
+    // Chunks are whole vector steps (multiples of 8), so only the last one has a scalar tail
+    ParticleStep step = { deltaTime, driftY, damping };
+    size_t chunks = jobs.getThreadCount();
+    size_t chunkSize = ((count + chunks - 1) / chunks + 7) & ~static_cast<size_t>(7);
+    jobs.run(chunks, [&](size_t chunk) {
+        size_t first = min(count, chunk * chunkSize);
+        integrateBatch(*this, first, min(count, first + chunkSize), step);
+    });
+    removeDead();
+}
+
+void ParticleSystem::updateScalar(float deltaTime, float driftY) {
+    integrateRange(*this, 0, count, { deltaTime, driftY, exp(-drag * deltaTime) });
+    removeDead();
+}
+
+const char* ParticleSystem::getKernelPath() {
+#if defined(PARTICLE_KERNEL_AVX)
+    return "AVX";
+#elif defined(PARTICLE_KERNEL_SSE)
+    return "SSE";
+#else
+    return "scalar";
+#endif
+}
+
+void ParticleSystem::removeDead() {
+    for (size_t i = count; i-- > 0;) {
+        if (life[i] > 0.0f) continue;
+        size_t last = --count;
+        x[i] = x[last];
+        y[i] = y[last];
+        velocityX[i] = velocityX[last];
+        velocityY[i] = velocityY[last];
+        life[i] = life[last];
+        fade[i] = fade[last];
+        edge[i] = edge[last];
+        growth[i] = growth[last];
+        color[i] = color[last];
+    }
+}
+
+//=== RENDERING ===
+
+void ParticleSystem::buildVertices() {
+    vertices.resize(count * 6);
+    Vertex* out = vertices.data();
+    for (size_t i = 0; i < count; ++i) {
+        float half = edge[i] * 0.5f;
+        float left = x[i] - half;
+        float top = y[i] - half;
+        float right = x[i] + half;
+        float bottom = y[i] + half;
+        Color tint = color[i];
+        tint.a = static_cast<uint8_t>(tint.a * min(1.0f, life[i] * fade[i]));  // Fades out with age
+
+        out[0] = { Vector2f(left, top), tint };
+        out[1] = { Vector2f(right, top), tint };
+        out[2] = { Vector2f(left, bottom), tint };
+        out[3] = out[2];
+        out[4] = out[1];
+        out[5] = { Vector2f(right, bottom), tint };
+        out += 6;
+    }
+}
+
+void ParticleSystem::draw(RenderTarget& target) {
+    buildVertices();
+    if (vertices.empty()) return;
+    target.draw(vertices.data(), vertices.size(), PrimitiveType::Triangles);
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "JobSystem.h"
+#include "Random.h"
+
+using namespace sf;
+using namespace std;
+
+//=== PARTICLE STYLE ===
+// How new particles start out; spreads are uniform +/- ranges around the base values
+struct ParticleStyle {
+    Vector2f velocity;                  // Pixels/second
+    Vector2f velocitySpread;
+    float lifetime = 1.0f;              // Seconds
+    float lifetimeSpread = 0.0f;
+    float size = 4.0f;                  // Edge length at birth (pixels)
+    float growth = 0.0f;                // Edge length gained per second
+    Color color = Color::White;         // Fades to transparent over the lifetime
+};
+
+//=== PARTICLE EMITTER ===
+// Continuous source: turns a rate into whole particles frame by frame, carrying the fraction over
+struct ParticleEmitter {
+    ParticleStyle style;
+    float rate = 0.0f;                  // Particles per second
+    float pending = 0.0f;               // Fraction of a particle carried to the next frame
+
+    // Returns: particles due after deltaTime seconds (pass deltaTime * n for n sources sharing the emitter)
+    size_t due(float deltaTime) {
+        pending += rate * deltaTime;
+        size_t count = static_cast<size_t>(pending);
+        pending -= static_cast<float>(count);
+        return count;
+    }
+};
+
+//=== PARTICLE SYSTEM CLASS DECLARATION ===
+// Short-lived untextured squares (exhaust, dust, crash debris) as structure-of-arrays components
+// - Every component is allocated at full capacity up front; emitting writes at the end and a dead
+//   particle is replaced by the last one, so a running effect never allocates
+// - update() integrates drag, velocity, growth and age over the packed arrays with AVX (8 particles
+//   per step) when the build enables it, SSE (4) on every x86/x64 build, scalar elsewhere
+// - With workers (setWorkerCount) the integration is split into equal chunks, one per thread, run
+//   on the system's JobSystem. Small systems stay on the main thread
+// - draw() renders every live particle as one triangle list: a single draw call
+// Main thread only (the workers are internal to update())
+class ParticleSystem {
+public:
+    ParticleSystem(size_t capacity, float drag);
+
+    ParticleSystem(const ParticleSystem&) = delete;
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+    //=== EMISSION ===
+    // Add count particles at position; particles that do not fit the capacity are dropped
+    // Returns: number of particles added
+    size_t emit(Vector2f position, const ParticleStyle& style, size_t count, Pcg32& gen);
+    void clear();
+
+    //=== SIMULATION ===
+    // Advance every particle by deltaTime and remove the dead ones
+    // driftY: speed added to every particle's own (pixels/second), e.g. the road scrolling under them
+    void update(float deltaTime, float driftY);
+    // Same step without vector instructions or workers (reference and fallback)
+    void updateScalar(float deltaTime, float driftY);
+
+    // Threads helping update() besides the main thread (0 = main thread only)
+    void setWorkerCount(unsigned count) { jobs.setWorkerCount(count); }
+    unsigned getWorkerCount() const { return jobs.getWorkerCount(); }
+
+    //=== RENDERING ===
+    void draw(RenderTarget& target);
+    // Fill the vertex list without drawing (draw() does this first)
+    void buildVertices();
+    const vector<Vertex>& getVertices() const { return vertices; }
+
+    //=== QUERIES ===
+    size_t size() const { return count; }
+    size_t capacity() const { return x.size(); }
+    uint64_t getDroppedCount() const { return dropped; }  // Particles that did not fit since clear()
+    static const char* getKernelPath();                   // "AVX", "SSE" or "scalar"
+
+    //=== COMPONENT ARRAYS ===
+    // Allocated at capacity; elements [0, size()) are live. Read only outside the system
+    vector<float> x, y;                 // Center position (screen pixels)
+    vector<float> velocityX, velocityY; // Own motion (pixels/second)
+    vector<float> life;                 // Seconds left
+    vector<float> fade;                 // 1 / lifetime: life * fade is the remaining share
+    vector<float> edge;                 // Current edge length (pixels)
+    vector<float> growth;               // Edge length gained per second
+    vector<Color> color;                // Birth color
+
+private:
+    float drag;                         // Share of the velocity lost per second (exponential)
+    size_t count = 0;
+    uint64_t dropped = 0;
+    vector<Vertex> vertices;            // Six per live particle, rebuilt every draw
+
+    //=== WORKERS ===
+    static constexpr size_t MIN_PARALLEL_PARTICLES = 4096;  // Below this threads cost more than they save
+    JobSystem jobs;
+
+    // Swap dead particles out (backwards: the last particle fills the hole)
+    void removeDead();
+};
@@ -1,4 +1,9 @@
 #include "PlayingState.h"
+#include "ResourceManager.h"
+#include "Random.h"
+#include "Input.h"
+
+extern GameState previousState;  // Return target for the settings menu
 
 //=== UTILITY FUNCTIONS ===
 
@@ -11,92 +16,93 @@ string keyToString(Keyboard::Key key) {
     return string(1, static_cast<char>('A' + (keyValue - aValue)));
 }
 
-//=== MAIN GAME LOOP FUNCTION ===
+//=== LEVEL 1 STATE CLASS ===
 // Handles all logic and rendering for PlayingState (Level 1: Speeding Lines)
-void handlePlayingState(RenderWindow& window, bool& running, GameState& state)
-{
-    //=== PERSISTENT STATE VARIABLES ===
-    // Static variables maintain state between function calls
-    
-    // Font system
-    static Font font;                    // Text rendering font
-    static bool fontLoaded = false;      // Font loading status
-    
-    // Scrolling text system
-    static Text scrollingText(font, "", 30);  // Main text object for scrolling display
-    static float textX = 0.0f;               // Primary horizontal scroll position
-    static float textX2 = 0.0f;              // Secondary position for seamless scrolling
-    static Clock clock;                      // Frame timing system
-    
-    // Input state tracking for proper edge detection
-    static bool mPressed = false;            // M key state
-    static bool f1Pressed = false;           // F1 key state
-    static bool escPressed = false;          // ESC key state (NEW)
-    
-    // External references to global game state
-    extern GameState previousState;    // For returning from settings menu
-    extern int framerateOptions[];     // Available framerate settings
-    extern int framerateIndex;         // Current framerate selection
+class PlayingState : public GameStateHandler {
+public:
+    PlayingState();
+
+    //=== RESOURCE LIFECYCLE ===
+    void load(RenderWindow& window) override {
+        fontHandle = resources.acquireFont("arial.ttf");  // Shared font from the resource cache
+        scrollingText.emplace(resources.get(fontHandle), "", 30);
+        scrollingText->setFillColor(Color::White);        // Set text color to white
+        
+        // Text speed follows the framerate setting
+        framerateSubscription = settings.subscribe(SETTING_FRAMERATE,
+            [this](const SettingsSnapshot& current, uint32_t) { framerate = current.getFramerate(); });
+    }
+
+    void unload() override {
+        framerateSubscription.reset();
+        scrollingText.reset();  // Text must not outlive its font
+        resources.release(fontHandle);
+    }
+
+    //=== ACTIVATION LIFECYCLE ===
+    // Each visit picks a new key and restarts the scroll
+    void enter(RenderWindow& window) override;
+
+    //=== FRAME HOOKS ===
+    void update(RenderWindow& window, float deltaTime, GameState& state) override;
+    void draw(RenderWindow& window) override;
+
+private:
+    // Font and scrolling text system
+    FontHandle fontHandle;                   // Shared text rendering font
+    optional<Text> scrollingText;            // Main text object for scrolling display
+    float textX = 0.0f;                      // Primary horizontal scroll position
+    float textX2 = 0.0f;                     // Secondary position for seamless scrolling
+    int framerate = 60;                      // Text speed setting (kept current by the subscription)
+    SettingsSubscription framerateSubscription;
     
     //=== RANDOM KEY SELECTION SYSTEM ===
     // Dynamically chooses which key player must press to advance
-    static bool keyChosen = false;              // Has a key been selected this session?
-    static Keyboard::Key randomKey = Keyboard::Key::Unknown;  // Currently active key
-    static bool keyPressed = false;             // Input state tracking
-    
+    Keyboard::Key randomKey = Keyboard::Key::Unknown;  // Currently active key
+    vector<Keyboard::Key> candidateKeys;     // Available keys for random selection (A-Z minus reserved keys)
+};
+
+PlayingState::PlayingState() {
     // Keys that are reserved for navigation and cannot be used for progression
-    static set<Keyboard::Key> reservedKeys = {
+    const set<Keyboard::Key> reservedKeys = {
         Keyboard::Key::M,        // Return to menu
         Keyboard::Key::F1,       // Open settings
-        Keyboard::Key::Escape    // Return to pre-level screen (NEW)
+        Keyboard::Key::Escape    // Return to pre-level screen
         // Additional reserved keys can be added here as needed
     };
     
-    // Available keys for random selection (A-Z minus reserved keys)
-    static vector<Keyboard::Key> candidateKeys;
-    if (candidateKeys.empty()) {
-        // Generate list of usable keys from A to Z
-        int aValue = static_cast<int>(Keyboard::Key::A);
-        int zValue = static_cast<int>(Keyboard::Key::Z);
-        
-        for (int k = aValue; k <= zValue; ++k) {
-            Keyboard::Key currentKey = static_cast<Keyboard::Key>(k);
-            // Only include keys not in reserved set
-            if (reservedKeys.count(currentKey) == 0)
-                candidateKeys.push_back(currentKey);
-        }
-    }
-    
-    // Select random key if none chosen yet
-    if (!keyChosen) {
-        random_device rd;                    // Hardware random number generator
-        mt19937 gen(rd());                   // Mersenne Twister generator
-        uniform_int_distribution<> dis(0, static_cast<int>(candidateKeys.size()) - 1);
-        randomKey = candidateKeys[dis(gen)]; // Select random valid key
-        keyChosen = true;                    // Mark selection as complete
-    }
+    // Generate list of usable keys from A to Z
+    int aValue = static_cast<int>(Keyboard::Key::A);
+    int zValue = static_cast<int>(Keyboard::Key::Z);
     
-    //=== FONT AND TEXT INITIALIZATION ===
-    // One-time setup for text rendering system
-    if (!fontLoaded) {
-        font.openFromFile("arial.ttf");           // Load standard font
-        scrollingText.setFillColor(Color::White); // Set text color to white
-        fontLoaded = true;                        // Mark font as loaded
-        textX = 0.0f;                            // Initialize scroll positions
-        textX2 = 0.0f;
-        clock.restart();                         // Begin frame timing
+    for (int k = aValue; k <= zValue; ++k) {
+        Keyboard::Key currentKey = static_cast<Keyboard::Key>(k);
+        // Only include keys not in reserved set
+        if (reservedKeys.count(currentKey) == 0)
+            candidateKeys.push_back(currentKey);
     }
+}
+
+void PlayingState::enter(RenderWindow& window) {
+    // Select random key for this visit
+    uniform_int_distribution<> dis(0, static_cast<int>(candidateKeys.size()) - 1);
+    randomKey = candidateKeys[dis(randomService.stream(RandomStream::LevelKeys))];  // Select random valid key
     
     //=== TEXT CONTENT GENERATION ===
-    // Create dynamic message showing which key to press
+    // Create message showing which key to press
     string scrollMsg = "NextLevel = ";
     scrollMsg += keyToString(randomKey);  // Convert key enum to displayable character
     scrollMsg += " ";                     // Add spacing for visual separation
-    scrollingText.setString(scrollMsg);   // Apply message to text object
+    scrollingText->setString(scrollMsg);  // Apply message to text object
     
-    //=== FRAME TIMING AND SPEED CALCULATION ===
-    float deltaTime = clock.restart().asSeconds();  // Time since last frame
-    int framerate = framerateOptions[framerateIndex]; // Current FPS setting
+    textX = 0.0f;                         // Initialize scroll positions
+    textX2 = 0.0f;
+}
+
+//=== LEVEL 1 UPDATE ===
+void PlayingState::update(RenderWindow& window, float deltaTime, GameState& state)
+{
+    //=== SCROLL SPEED CALCULATION ===
     float baseSpeed = 1000.0f;                       // Base scrolling speed
     float speed;
     
@@ -107,15 +113,9 @@ void handlePlayingState(RenderWindow& window, bool& running, GameState& state)
     else
         speed = baseSpeed * 2.0f;  // Special case for unlimited framerate
     
-    //=== TEXT MEASUREMENT FOR SCROLLING ===
-    float textWidth = scrollingText.getLocalBounds().size.x;  // Width of text string
-    float textHeight = font.getLineSpacing(scrollingText.getCharacterSize()); // Line height
-    
-    // Calculate how many text lines fit on screen vertically
-    int numLines = static_cast<int>(window.getSize().y / textHeight) + 1;
-    
     //=== SCROLLING ANIMATION SYSTEM ===
     // Update horizontal positions for continuous scrolling effect
+    float textWidth = scrollingText->getLocalBounds().size.x;  // Width of text string
     
     // Primary scroll position (left-to-right movement)
     textX -= speed * deltaTime;
@@ -129,7 +129,43 @@ void handlePlayingState(RenderWindow& window, bool& running, GameState& state)
         textX2 -= textWidth;  // Reset position for seamless loop
     }
     
-    //=== RENDERING PIPELINE ===
+    //=== INPUT HANDLING SYSTEM ===
+    // Keys held while entering must be released before they count (see Input.h)
+    
+    // Check for level progression key press
+    if (input.wasPressed(randomKey)) {
+        state = PRELEVEL2;        // Advance to pre-level screen for level 2
+    }
+    
+    // Return to pre-level screen (ESC key)
+    if (input.wasPressed(Keyboard::Key::Escape)) {
+        state = PRELEVEL1;        // Return to Level 1 pre-level screen
+    }
+    
+    // Return to main menu (M key)
+    if (input.wasPressed(Keyboard::Key::M)) {
+        state = MENU;             // Return to main menu
+    }
+    
+    // Open settings menu (F1 key)
+    if (input.wasPressed(Keyboard::Key::F1)) {
+        previousState = PLAYING;  // Store current state for return
+        state = SETTINGS;         // Open settings menu
+    }
+}
+
+//=== LEVEL 1 RENDERING ===
+void PlayingState::draw(RenderWindow& window)
+{
+    const Font& font = resources.get(fontHandle);
+    
+    //=== TEXT MEASUREMENT FOR SCROLLING ===
+    float textWidth = scrollingText->getLocalBounds().size.x;  // Width of text string
+    float textHeight = font.getLineSpacing(scrollingText->getCharacterSize()); // Line height
+    
+    // Calculate how many text lines fit on screen vertically
+    int numLines = static_cast<int>(window.getSize().y / textHeight) + 1;
+    
     window.clear(Color::Black);  // Clear screen with black background
     
     // Draw scrolling text pattern across entire screen
@@ -142,59 +178,13 @@ void handlePlayingState(RenderWindow& window, bool& running, GameState& state)
         
         // Draw repeated text instances across screen width
         for (float x = startX; x < window.getSize().x + textWidth; x += textWidth) {
-            scrollingText.setPosition(Vector2f(x, y));
-            window.draw(scrollingText);
-        }
-    }
-    
-    //=== INPUT HANDLING SYSTEM ===
-    
-    // Check for level progression key press
-    if (Keyboard::isKeyPressed(randomKey)) {
-        if (!keyPressed) {  // Edge detection to prevent key repeat
-            state = PRELEVEL2;    // Advance to pre-level screen for level 2
-            keyChosen = false;    // Reset key selection for next session
-            keyPressed = true;    // Mark key as pressed
-        }
-    }
-    else {
-        keyPressed = false;  // Reset press state when key released
-    }
-    
-    // NEW: Return to pre-level screen (ESC key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::Escape)) {
-        if (!escPressed) {  // Edge detection to prevent key repeat
-            state = PRELEVEL1;     // Return to Level 1 pre-level screen
-            keyChosen = false;     // Reset key selection for restart
-            escPressed = true;     // Mark key as pressed
+            scrollingText->setPosition(Vector2f(x, y));
+            window.draw(*scrollingText);
         }
     }
-    else {
-        escPressed = false;  // Reset when key released
-    }
-    
-    // Return to main menu (M key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::M)) {
-        if (!mPressed) {  // Edge detection to prevent key repeat
-            state = MENU;        // Return to main menu
-            keyChosen = false;   // Reset key selection
-            mPressed = true;     // Mark key as pressed
-        }
-    }
-    else {
-        mPressed = false;  // Reset when key released
-    }
-    
-    // Open settings menu (F1 key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::F1)) {
-        if (!f1Pressed) {  // Edge detection to prevent key repeat
-            previousState = state;  // Store current state for return
-            state = SETTINGS;       // Open settings menu
-            keyChosen = false;      // Reset key selection
-            f1Pressed = true;       // Mark key as pressed
-        }
-    }
-    else {
-        f1Pressed = false;  // Reset when key released
-    }
+}
+
+//=== FACTORY ===
+unique_ptr<GameStateHandler> createPlayingState() {
+    return make_unique<PlayingState>();
 }
\ No newline at end of file
@@ -1,7 +1,8 @@
 #pragma once
 #include <SFML/Graphics.hpp>
-#include "GameState.h"
+#include "GameStateHandler.h"
 #include "SettingsState.h"
+#include <memory>
 #include <random>
 #include <set>
 #include <map>
@@ -10,5 +11,5 @@
 using namespace sf;
 using namespace std;
 
-// Handles the main game loop and rendering for the scrolling text state.
-void handlePlayingState(RenderWindow& window, bool& running, GameState& state);
\ No newline at end of file
+// Creates the scrolling text state (Level 1: Speeding Lines).
+unique_ptr<GameStateHandler> createPlayingState();
@@ -1,816 +1,623 @@
 #include "PlayingState3.h"
+#include "ResourceManager.h"
+#include "EngineMixer.h"
+#include "AudioSystem.h"
+#include "AudioTelemetry.h"
+#include "BenchmarkLog.h"
+#include "Level3Simulation.h"
+#include "SpriteBatch.h"
+#include "TextureAtlas.h"
+#include "ParallaxBackground.h"
+#include "ParticleSystem.h"
+#include <chrono>
+#include <sstream>
+#include "EngineVoicePool.h"
+#include "Settings.h"
+#include "Input.h"
+
+extern GameState previousState;  // Return target for the settings menu
 
 //=== DATA STRUCTURES ===
-// These structs define the blueprint for game objects
+// The level's rules run in Level3Simulation (see Level3Simulation.h); this state turns the
+// keyboard into its input and presents the result: rendering, engine audio and effects
 
-// Represents a player's car with position, movement, and visual components
-struct Car {
-    Vector2f position;        // Current X,Y coordinates on screen
-    Vector2f velocity;        // Movement speed and direction per frame
-    float speed = 400.0f;     // Standard movement speed in pixels/second
-    float maxSpeed = 500.0f;  // Maximum possible speed
-    optional<Sprite> sprite;  // Optional sprite for car image (may be null)
-    RectangleShape shape;     // Fallback rectangle if no sprite loaded
-    int spriteIndex = 0;      // Index into sprite sheet for car appearance
-    
-    // Hitbox configuration
-    float hitboxSizeMultiplier = 1.0f;
+//=== UTILITY FUNCTIONS ===
 
-    // Constructor initializes default values
-    Car() : shape({30, 50}) {
-        velocity = Vector2f(0, 0);           // Start stationary
-        shape.setSize(Vector2f(30, 50));     // Set rectangle dimensions
-        shape.setFillColor(Color::Red);      // Default color
-        shape.setOrigin(Vector2f(15, 25));   // Center origin for rotation
+// Transparent tile of small stones, flowers and dark grass tufts for the roadside layer
+// Fixed seed: the same pattern every run; details wrap around the edges so the tile repeats seamlessly
+Image createRoadsideDetails(unsigned size, int count) {
+    Image image(Vector2u(size, size), Color::Transparent);
+    Pcg32 detailGen(7);
+    uniform_int_distribution<unsigned> positionDist(0, size - 1);
+    uniform_int_distribution<int> kindDist(0, 2);
+    const Color colors[] = { Color(120, 120, 110), Color(235, 220, 90), Color(40, 90, 30) };
+    const Vector2u extents[] = { Vector2u(3, 2), Vector2u(2, 2), Vector2u(1, 4) };  // Stone, flower, tuft
+    for (int i = 0; i < count; ++i) {
+        unsigned x = positionDist(detailGen);
+        unsigned y = positionDist(detailGen);
+        int kind = kindDist(detailGen);
+        for (unsigned dy = 0; dy < extents[kind].y; ++dy) {
+            for (unsigned dx = 0; dx < extents[kind].x; ++dx) {
+                image.setPixel(Vector2u((x + dx) % size, (y + dy) % size), colors[kind]);
+            }
+        }
     }
-};
+    return image;
+}
+
+// Calculates Euclidean distance between two 2D points
+float calculateDistance(float x1, float y1, float x2, float y2) {
+    float dx = x1 - x2;  // Delta X
+    float dy = y1 - y2;  // Delta Y
+    return sqrt(dx * dx + dy * dy);  // Pythagorean theorem
+}
 
-// Represents AI-controlled obstacle cars with sound effects
-struct Obstacle {
-    Vector2f position;        // Screen coordinates
-    Vector2f velocity;        // Movement vector
-    optional<Sprite> sprite;  // Car image (optional)
-    RectangleShape shape;     // Fallback rectangle shape
-    bool active = true;       // Whether obstacle is still in play
-    int spriteIndex = 0;      // Which car sprite to use from sheet
-                                
-    float hitboxSizeMultiplier = 0.7f;
+//=== LEVEL 3 STATE CLASS ===
+// Handles all logic and rendering for PlayingState3 (Level 3: endless road)
+class PlayingState3 : public GameStateHandler {
+public:
+    explicit PlayingState3(int trafficDensity);
+    
+    //=== RESOURCE LIFECYCLE ===
+    void queueAssets(AssetLoader& loader) override {
+        loader.addTexture("Images/grass.png");      // Repeated background tile: not atlas material
+        loader.addAtlasImage("Images/Cars.png");
+        loader.addSoundBuffer("Sounds/Engine1.2.ogg");
+        loader.addSoundBuffer("Sounds/Engine4.ogg");
+    }
+    
+    void load(RenderWindow& window) override;
+    void unload() override;
+    
+    //=== ACTIVATION LIFECYCLE ===
+    void enter(RenderWindow& window) override;
+    void exit() override;
+    
+    //=== FRAME HOOKS ===
+    void update(RenderWindow& window, float deltaTime, GameState& state) override;
+    void draw(RenderWindow& window) override;
 
-    // Audio system - each obstacle has independent sound
-    Sound* engineSound = nullptr;              // SFML Sound object pointer
-    SoundBuffer* personalSoundBuffer = nullptr; // Each obstacle owns sound data
-    bool soundInitialized = false;             // Has audio been set up?
-    float soundVolume = 0.0f;                 // Current volume level
-    
-    // Constructor: creates obstacle at specified coordinates
-    Obstacle(float x, float y) : position(x, y), shape({40, 40}) {
-        velocity.y = 200.0f;                    // Always moves downward
-        spriteIndex = rand() % 5;               // Random car type (0-4)
-        shape.setSize(Vector2f(40, 40));        // Square shape
-        shape.setFillColor(Color::Yellow);      // Yellow color
-        shape.setOrigin(Vector2f(20, 20));      // Center origin
-    }
+private:
+    // Font loading (shared font from the resource cache)
+    FontHandle fontHandle;
     
-    // Destructor: cleanup audio resources to prevent memory leaks
-    ~Obstacle() {
-        if (engineSound) {
-            if (engineSound->getStatus() == Sound::Status::Playing) {
-                engineSound->stop();  // Stop audio before deletion
-            }
-            delete engineSound;       // Free memory
-        }
-        if (personalSoundBuffer) {
-            delete personalSoundBuffer;  // Free sound data memory
-        }
-    }
+    // Background system
+    TextureHandle backgroundTexture;        // Grass (repeated: it cannot come from the atlas)
+    Texture roadsideTexture;                // Generated details scattered beside the road (repeated)
+    ParallaxBackground background;          // Grass and roadside layers, one quad each
+    bool backgroundLoaded = false;          // Loading status flag
     
-    // Copy constructor: creates new obstacle from existing 
-    Obstacle(const Obstacle& other) : position(other.position), velocity(other.velocity), 
-                                     shape(other.shape), active(other.active),
-                                     sprite(other.sprite),
-                                     spriteIndex(other.spriteIndex),
-                                     hitboxSizeMultiplier(other.hitboxSizeMultiplier),
-                                     soundInitialized(false), soundVolume(0.0f), 
-                                     engineSound(nullptr), personalSoundBuffer(nullptr) {
-        // Note: Each obstacle needs its own audio objects for proper mixing
-    }
+    // Sprite sheet system for car graphics
+    TextureHandle carSpriteSheetHandle;     // Atlas page or standalone sheet holding the cars
+    AtlasRegion carSheetRegion;             // Sheet containing all car images (atlas page or standalone)
+    bool carSpriteSheetLoaded = false;      // Loading status
+    vector<IntRect> carSpriteRects;         // Defines sub-rectangles for each car
+    static const int SPRITE_WIDTH = 32;     // Individual sprite dimensions
+    static const int SPRITE_HEIGHT = 64;
+    static const int SPRITES_PER_ROW = 5;   // Layout of sprite sheet
     
-    // Assignment operator: copies data from another obstacle
-    Obstacle& operator=(const Obstacle& other) {
-        if (this != &other) {  // Prevent self-assignment
-            position = other.position;
-            velocity = other.velocity;
-            shape = other.shape;
-            active = other.active;
-            spriteIndex = other.spriteIndex;
-            sprite = other.sprite;
-            hitboxSizeMultiplier = other.hitboxSizeMultiplier;
-            // Audio objects are not copied - each obstacle maintains its own
-        }
-        return *this;
-    }
+    // Audio system - every engine (player and obstacles) is mixed into one stream
+    static constexpr size_t OBSTACLE_VOICES = 128;  // Audible obstacles before virtualization
+    EngineMixer engineMixer{ OBSTACLE_VOICES + 1 };
+    EngineMixer::VoiceId engineVoice = EngineMixer::InvalidId;  // Player engine (Engine4.ogg)
+    bool engineVoicePlaying = false;        // Last start/stop posted for the player engine
+    float lastGameSpeed = 200.0f;           // Previous frame's speed for audio adjustments
+    float musicVolume = 40.0f;              // Volume setting (kept current by the subscription)
+    SettingsSubscription volumeSubscription;
+    
+    // Obstacle audio template
+    bool obstacleEngineLoaded = false;              // Engine1.2.ogg is a mixer source
+    EngineVoicePool obstacleVoices{ OBSTACLE_VOICES };  // Mixer voices for the loudest obstacles
+    static constexpr float MAX_OBSTACLE_SOUND_DISTANCE = 800.0f; // Maximum audible range
+    static constexpr float MIN_OBSTACLE_SOUND_DISTANCE = 100.0f; // Distance for full volume
+    
+    // User interaction system
+    bool helpRequested = false;             // Player requested help display
+    
+    // Car visuals: quads cut from the sprite sheet (carSpriteRects), all cars drawn in one batch
+    float playerSpriteScale = 1.0f;         // Player design at 30px width (also the abandoned car)
+    float obstacleSpriteScale = 1.0f;       // Every design at 40px width
+    Vector2f carSpriteOrigin;               // Center of a design (sheet pixels)
+    RectangleShape playerShape;             // Fallback rectangles when the sheet is missing
+    RectangleShape obstacleShape;           // (only their size, origin and color are used)
+    RectangleShape carShape;                // Abandoned car fallback
+    
+    SpriteBatch carBatch{ Level3Simulation::CAR_CAPACITY };   // Every car quad of a frame
+    
+    // Effects: exhaust behind every car, dust where the player scrapes a wall, crash debris
+    static constexpr size_t PARTICLE_CAPACITY = 32768;      // Live particles (stress mode included)
+    optional<ParticleSystem> particles;     // One draw call (see ParticleSystem.h); exists while loaded
+    ParticleEmitter playerExhaust;
+    ParticleEmitter trafficExhaust;         // Shared by the obstacles (rate per car), taken in turn
+    ParticleEmitter wallDust;
+    ParticleStyle crashSparks;
+    ParticleStyle crashSmoke;
+    size_t exhaustCursor = 0;               // Dense index of the last obstacle that emitted
+    double particleUpdateTime = 0.0;        // Last frame's particle step (microseconds)
+    double particleDrawTime = 0.0;          // Last frame's particle layer (measured in draw)
+    
+    //=== GAME STATE ===
+    // Cars, road, speed, score and the text timeline; a run restarts on entering the level or pressing R
+    // (car and traffic storage exist while the level is loaded)
+    int trafficDensity;
+    optional<Level3Simulation> simulation;
+    
+    // Traffic cost measurement, reported every TRAFFIC_REPORT_SECONDS (stress HUD, benchmark log)
+    static constexpr float TRAFFIC_REPORT_SECONDS = 0.5f;
+    float trafficWindowTime = 0.0f;
+    size_t trafficWindowFrames = 0;
+    size_t trafficWindowCars = 0;           // Sum of obstacles per frame
+    size_t trafficWindowCandidates = 0;     // Sum of broadphase candidates per frame
+    double trafficWindowSimulation = 0.0;   // Microseconds: simulation step, engine audio and emission
+    double trafficWindowFlow = 0.0;         // Microseconds: traffic flow step (part of the simulation)
+    double trafficWindowBroadphase = 0.0;   // Microseconds: grid rebuild and queries
+    size_t trafficWindowQuads = 0;          // Sum of car quads per frame
+    size_t trafficWindowDraws = 0;          // Sum of car draw calls per frame
+    size_t trafficWindowLargestBatch = 0;   // Most quads in one draw call
+    double trafficWindowOverdraw = 0.0;     // Sum of car overdraw per frame
+    double trafficWindowCarDraw = 0.0;      // Microseconds: building and submitting the car batch
+    size_t trafficWindowParticles = 0;      // Sum of live particles per frame
+    double trafficWindowParticleUpdate = 0.0;   // Microseconds: particle step
+    double trafficWindowParticleDraw = 0.0;     // Microseconds: particle vertices and draw
+    double carDrawTime = 0.0;               // Last frame's car layer (measured in draw)
+    string trafficReport;                   // Last closed window (stress HUD)
+    
+    // Road drawing (the road itself is part of the simulation)
+    static constexpr float WALL_WIDTH = 10.0f;
+    VertexArray roadMesh;                   // Surface, walls and lane markings as one triangle strip
+    
+    // Random stream for effects (the simulation keeps its own, seeded from the Level3 stream)
+    Pcg32& gen;
+    
+    // Put the player back at the start of an empty road
+    void resetRun(RenderWindow& window);
+    
+    // Accumulate one frame of traffic cost and report closed windows
+    void recordTrafficCost(float deltaTime, size_t obstacles, size_t candidates, double simulationTime, double trafficTime, double broadphaseTime);
+    
+    // Silence every obstacle engine that is still playing
+    void stopObstacleSounds();
 };
 
-// Represents a segment of the racing track
-struct TrackSegment {
-    Vector2f position;    // Center position of this track piece
-    float width;         // Track width in pixels
-    Color color;         // Track color
-    RectangleShape leftWall, rightWall, road;  // Visual components
-    
-    // Constructor: creates track segment at specified Y position
-    TrackSegment(float y, float trackWidth, float screenWidth) : width(trackWidth), 
-        leftWall({10, 20}), rightWall({10, 20}), road({trackWidth, 20}) {
-        position.x = screenWidth / 2.0f;  // Center horizontally
-        position.y = y;                   // Set vertical position
-        color = Color(102, 102, 102, 255); // Gray color
+//=== CONSTRUCTOR ===
+PlayingState3::PlayingState3(int trafficDensity)
+    : playerShape({30, 50}), obstacleShape({40, 40}), carShape({30, 50}),
+      trafficDensity(trafficDensity),
+      gen(randomService.stream(RandomStream::Effects)) {
+    // Fallback player car (resized while walking)
+    playerShape.setFillColor(Color::Red);
+    playerShape.setOrigin(Vector2f(15, 25));
+    
+    // Fallback traffic car
+    obstacleShape.setFillColor(Color::Yellow);
+    obstacleShape.setOrigin(Vector2f(20, 20));
+    
+    // Fallback car shape for the abandoned vehicle
+    carShape.setFillColor(Color::Red);
+    carShape.setOrigin(Vector2f(15, 25));
+    
+    // Exhaust: grey puffs that stay on the road behind the car and spread as they fade
+    playerExhaust.rate = 40.0f;
+    playerExhaust.style.velocity = Vector2f(0.0f, 30.0f);
+    playerExhaust.style.velocitySpread = Vector2f(15.0f, 10.0f);
+    playerExhaust.style.lifetime = 0.5f;
+    playerExhaust.style.lifetimeSpread = 0.2f;
+    playerExhaust.style.size = 3.0f;
+    playerExhaust.style.growth = 10.0f;
+    playerExhaust.style.color = Color(180, 180, 180, 140);
+    trafficExhaust = playerExhaust;
+    trafficExhaust.rate = 6.0f;
+    trafficExhaust.style.lifetime = 0.4f;
+    trafficExhaust.style.color = Color(160, 160, 160, 110);
+    
+    // Dust thrown up while the player is pushed along a wall
+    wallDust.rate = 90.0f;
+    wallDust.style.velocity = Vector2f(0.0f, -20.0f);
+    wallDust.style.velocitySpread = Vector2f(60.0f, 40.0f);
+    wallDust.style.lifetime = 0.6f;
+    wallDust.style.lifetimeSpread = 0.2f;
+    wallDust.style.size = 4.0f;
+    wallDust.style.growth = 14.0f;
+    wallDust.style.color = Color(150, 120, 80, 170);
+    
+    // Crash burst: fast short sparks and slow lingering smoke
+    crashSparks.velocitySpread = Vector2f(300.0f, 300.0f);
+    crashSparks.lifetime = 0.5f;
+    crashSparks.lifetimeSpread = 0.25f;
+    crashSparks.size = 3.0f;
+    crashSparks.color = Color(255, 190, 60);
+    crashSmoke.velocitySpread = Vector2f(80.0f, 80.0f);
+    crashSmoke.lifetime = 1.2f;
+    crashSmoke.lifetimeSpread = 0.4f;
+    crashSmoke.size = 6.0f;
+    crashSmoke.growth = 20.0f;
+    crashSmoke.color = Color(70, 70, 70, 200);
+}
+
+//=== RESOURCE LIFECYCLE ===
+
+// Acquires the level's textures, sounds and music (cache hits after the pre-level preload)
+void PlayingState3::load(RenderWindow& window)
+{
+    // Every engine volume scales with the music volume setting
+    volumeSubscription = settings.subscribe(SETTING_MUSIC_VOLUME,
+        [this](const SettingsSnapshot& current, uint32_t) { musicVolume = current.musicVolume; });
+    
+    // Particle and car storage are sized for stress traffic: only allocated while the level is loaded
+    particles.emplace(PARTICLE_CAPACITY, 1.5f);
+    simulation.emplace(trafficDensity, randomService.stream(RandomStream::Level3)());
+    
+    // Car sprite sheet lookup (atlas region) and processing
+    if (textureAtlas.acquire("Images/Cars.png", carSheetRegion, carSpriteSheetHandle)) {
+        carSpriteSheetLoaded = true;
+        
+        // Parse sprite sheet into individual car rectangles
+        carSpriteRects.clear();
+        
+        // Calculate dimensions of each sprite
+        Vector2i textureSize = carSheetRegion.rect.size;
+        int actualSpriteWidth = textureSize.x / SPRITES_PER_ROW;
+        int actualSpriteHeight = textureSize.y;
+        
+        cout << "Texture size: " << textureSize.x << "x" << textureSize.y << endl;
+        cout << "Calculated sprite size: " << actualSpriteWidth << "x" << actualSpriteHeight << endl;
+        
+        // Create rectangle definitions for each car sprite (offset to the sheet's region)
+        for (int i = 0; i < Level3Simulation::CAR_DESIGNS; ++i) {
+            int col = i; // Column in sprite sheet (horizontal layout)
+            
+            // Define rectangle bounds for this sprite
+            IntRect rect(carSheetRegion.rect.position + Vector2i(col * actualSpriteWidth, 0), {actualSpriteWidth, actualSpriteHeight});
+            carSpriteRects.push_back(rect);
+            
+            cout << "Car " << i << " rect: (" << rect.position.x << ", " << rect.position.y
+                 << ", " << rect.size.x << ", " << rect.size.y << ")" << endl;
+        }
         
-        // Configure road surface
-        road.setSize(Vector2f(trackWidth, 20));
-        road.setFillColor(Color(102, 102, 102, 255));
-        road.setPosition(Vector2f(position.x - trackWidth/2, y));
+        // Quad scales: the player uses the first design, traffic any of them
+        playerSpriteScale = 30.0f / actualSpriteWidth;      // Target width of 30 pixels
+        obstacleSpriteScale = 40.0f / actualSpriteWidth;    // Target 40px width
+        carSpriteOrigin = Vector2f(actualSpriteWidth / 2.0f, actualSpriteHeight / 2.0f);
+        cout << "Car sprites initialized with scales: " << playerSpriteScale << ", " << obstacleSpriteScale << endl;
+    } else {
+        cerr << "Failed to load Images/Cars.png" << endl;
+        carSpriteSheetLoaded = false;
+    }
+    
+    // Background layers: grass stretched to the window (one tile per screen), slower than the
+    // road for depth, and roadside details in between
+    backgroundTexture = resources.acquireTexture("Images/grass.png");
+    if (backgroundTexture.isValid()) {
+        Texture& grass = resources.get(backgroundTexture);
+        grass.setRepeated(true);
         
-        // Configure left barrier
-        leftWall.setSize(Vector2f(10, 20));
-        leftWall.setFillColor(Color::White);
-        leftWall.setPosition(Vector2f(position.x - trackWidth/2 - 10, y));
+        // Calculate scaling to fit window
+        Vector2u windowSize = window.getSize();
+        Vector2u textureSize = grass.getSize();
         
-        // Configure right barrier
-        rightWall.setSize(Vector2f(10, 20));
-        rightWall.setFillColor(Color::White);
-        rightWall.setPosition(Vector2f(position.x + trackWidth/2, y));
+        float scaleX = static_cast<float>(windowSize.x) / textureSize.x;
+        float scaleY = static_cast<float>(windowSize.y) / textureSize.y;
+        
+        background.addLayer(grass, Vector2f(scaleX, scaleY), 0.3f);
+        backgroundLoaded = true;
+    }
+    else {
+        cerr << "Failed to load grass.png" << endl;
+    }
+    if (roadsideTexture.loadFromImage(createRoadsideDetails(128, 40))) {
+        roadsideTexture.setRepeated(true);
+        background.addLayer(roadsideTexture, Vector2f(2.0f, 2.0f), 0.6f);
+    }
+    
+    // Engine loops are copied into the mixer once; the decoded buffers are released right
+    // away (the decode cache makes the next load cheap)
+    SoundBufferHandle engineBuffer = resources.acquireSoundBuffer("Sounds/Engine4.ogg");
+    EngineMixer::SourceId engineSource = engineBuffer.isValid() ? engineMixer.addSource(resources.get(engineBuffer)) : EngineMixer::InvalidId;
+    resources.release(engineBuffer);
+    engineVoice = engineMixer.addVoice(engineSource);
+    if (engineVoice != EngineMixer::InvalidId) {
+        float initialVolume = (60.0f / 100.0f) * musicVolume;  // UPDATED: Increased initial volume from 30% to 60%
+        audio.setVoice(engineMixer, engineVoice, initialVolume / 100.0f, 1.0f);  // Set volume based on global setting
+    } else {
+        cerr << "Failed to load Engine4.ogg" << endl;
+    }
+    
+    // Obstacle sound template loading
+    SoundBufferHandle obstacleBuffer = resources.acquireSoundBuffer("Sounds/Engine1.2.ogg");
+    EngineMixer::SourceId obstacleSource = obstacleBuffer.isValid() ? engineMixer.addSource(resources.get(obstacleBuffer)) : EngineMixer::InvalidId;
+    resources.release(obstacleBuffer);
+    obstacleEngineLoaded = obstacleSource != EngineMixer::InvalidId && obstacleVoices.bind(engineMixer, obstacleSource) > 0;
+    if (!obstacleEngineLoaded) {
+        cerr << "Failed to load Engine1.2.ogg for obstacles" << endl;
+    }
+    
+    // Acquire text font (cache hit - already opened by main)
+    fontHandle = resources.acquireFont("arial.ttf");
+    
+    // Stress traffic exhausts enough particles, and simulates enough vehicles, to share their
+    // steps with worker threads (normal traffic stays below both parallel thresholds, so it would
+    // never wake them). Both pools come out of one budget of spare hardware threads
+    if (simulation->getTrafficDensity() > 1) {
+        Level3WorkerBudget budget = getStressWorkerBudget();
+        particles->setWorkerCount(budget.particles);
+        simulation->setWorkerCount(budget.traffic);
     }
-};
-
-//=== UTILITY FUNCTIONS ===
-
-// Get smaller hitbox bounds for improved collision detection
-// This creates a hitbox that is smaller than the visual sprite for better gameplay feel
-FloatRect getHitboxBounds(const Sprite& sprite, float sizeMultiplier) {
-    FloatRect spriteBounds = sprite.getGlobalBounds();
-    
-    // Calculate reduced dimensions
-    float reducedWidth = spriteBounds.size.x * sizeMultiplier;
-    float reducedHeight = spriteBounds.size.y * sizeMultiplier;
-    
-    // Center the smaller hitbox within the sprite bounds
-    float offsetX = (spriteBounds.size.x - reducedWidth) / 2.0f;
-    float offsetY = (spriteBounds.size.y - reducedHeight) / 2.0f;
-    
-    return FloatRect(
-        Vector2f(spriteBounds.position.x + offsetX, spriteBounds.position.y + offsetY),
-        Vector2f(reducedWidth, reducedHeight)
-    );
 }
 
-// Overload for RectangleShape (fallback when sprites aren't available)
-FloatRect getHitboxBounds(const RectangleShape& shape, float sizeMultiplier) {
-    FloatRect shapeBounds = shape.getGlobalBounds();
-    
-    // Calculate reduced dimensions
-    float reducedWidth = shapeBounds.size.x * sizeMultiplier;
-    float reducedHeight = shapeBounds.size.y * sizeMultiplier;
-    
-    // Center the smaller hitbox within the shape bounds
-    float offsetX = (shapeBounds.size.x - reducedWidth) / 2.0f;
-    float offsetY = (shapeBounds.size.y - reducedHeight) / 2.0f;
-    
-    return FloatRect(
-        Vector2f(shapeBounds.position.x + offsetX, shapeBounds.position.y + offsetY),
-        Vector2f(reducedWidth, reducedHeight)
-    );
+// Returns this level's textures and sound buffers to the resource manager
+// Every object that points into those assets (sprites, obstacle sounds) is dropped first
+void PlayingState3::unload()
+{
+    background.clear();           // Layers point at the background textures
+    particles.reset();            // Frees the particle storage and stops its workers
+    simulation.reset();           // Same for the cars and the traffic flow
+    carSpriteRects.clear();       // Car quads are cut from the car sprite sheet
+    
+    // Drop the engine loops (stopping the stream first: the mix thread reads them, and
+    // the audio thread must be done with every queued voice command)
+    obstacleVoices.unbind();
+    audio.stop(engineMixer);
+    audio.flush();
+    engineMixer.clear();
+    engineVoice = EngineMixer::InvalidId;
+    
+    volumeSubscription.reset();
+    resources.release(backgroundTexture);
+    resources.release(carSpriteSheetHandle);
+    resources.release(fontHandle);
+    carSheetRegion = AtlasRegion();
+    backgroundLoaded = false;
+    carSpriteSheetLoaded = false;
+    obstacleEngineLoaded = false;
 }
 
-// AABB (Axis-Aligned Bounding Box) collision detection for rectangles
-bool checkCollision(const RectangleShape& rect1, const RectangleShape& rect2) {
-    FloatRect bounds1 = rect1.getGlobalBounds();  // Get rectangle 1's screen bounds
-    FloatRect bounds2 = rect2.getGlobalBounds();  // Get rectangle 2's screen bounds
-    
-    // Check for overlap in both X and Y axes
-    return (bounds1.position.x < bounds2.position.x + bounds2.size.x &&
-            bounds1.position.x + bounds1.size.x > bounds2.position.x &&
-            bounds1.position.y < bounds2.position.y + bounds2.size.y &&
-            bounds1.position.y + bounds1.size.y > bounds2.position.y);
-}
+//=== ACTIVATION LIFECYCLE ===
 
-// Enhanced collision detection for sprite objects with customizable hitbox size
-bool checkSpriteCollision(const Sprite& sprite1, const Sprite& sprite2, float sizeMultiplier1 = 0.7f, float sizeMultiplier2 = 0.7f) {
-    FloatRect bounds1 = getHitboxBounds(sprite1, sizeMultiplier1);
-    FloatRect bounds2 = getHitboxBounds(sprite2, sizeMultiplier2);
+// Every visit starts a new run and restarts the narrative timers
+void PlayingState3::enter(RenderWindow& window)
+{
+    simulation->resetTimeline(musicVolume <= 0.0f);  // Silence counts from here
     
-    auto intersection = bounds1.findIntersection(bounds2);
-    return intersection.has_value();  // Returns true if intersection exists
+    audio.play(engineMixer);  // One stream for every engine while the level is active
+    audioTelemetry.attachEngine(&engineMixer, &obstacleVoices);
+    resetRun(window);
 }
 
-// Mixed collision detection (sprite vs rectangle shape)
-bool checkMixedCollision(const Sprite& sprite, const RectangleShape& shape, float spriteMultiplier = 0.7f, float shapeMultiplier = 0.7f) {
-    FloatRect spriteBounds = getHitboxBounds(sprite, spriteMultiplier);
-    FloatRect shapeBounds = getHitboxBounds(shape, shapeMultiplier);
-    
-    auto intersection = spriteBounds.findIntersection(shapeBounds);
-    return intersection.has_value();
+// Complete audio cleanup before leaving the level
+void PlayingState3::exit()
+{
+    audio.stopVoice(engineMixer, engineVoice);
+    engineVoicePlaying = false;
+    stopObstacleSounds();
+    audio.stop(engineMixer);
+    audioTelemetry.attachEngine(nullptr, nullptr);
 }
 
-// Enhanced collision detection for rectangles with customizable hitbox size
-bool checkCollision(const RectangleShape& rect1, const RectangleShape& rect2, float sizeMultiplier1 = 0.7f, float sizeMultiplier2 = 0.7f) {
-    FloatRect bounds1 = getHitboxBounds(rect1, sizeMultiplier1);
-    FloatRect bounds2 = getHitboxBounds(rect2, sizeMultiplier2);
-    
-    // Check for overlap in both X and Y axes
-    return (bounds1.position.x < bounds2.position.x + bounds2.size.x &&
-            bounds1.position.x + bounds1.size.x > bounds2.position.x &&
-            bounds1.position.y < bounds2.position.y + bounds2.size.y &&
-            bounds1.position.y + bounds1.size.y > bounds2.position.y);
+//=== RUN RESET ===
+void PlayingState3::resetRun(RenderWindow& window)
+{
+    stopObstacleSounds();  // Audio cleanup before reset
+    particles->clear();
+    helpRequested = false;
+    playerShape.setSize(Vector2f(30, 50));
+    playerShape.setOrigin(Vector2f(15, 25));
+    
+    // Hitboxes from the drawn sizes (sprites when the sheet loaded, fallback rectangles otherwise)
+    Vector2f playerSize = playerShape.getSize();
+    Vector2f obstacleSize = obstacleShape.getSize();
+    if (carSpriteSheetLoaded && !carSpriteRects.empty()) {
+        playerSize = Vector2f(carSpriteRects[0].size) * playerSpriteScale;
+        obstacleSize = Vector2f(carSpriteRects[0].size) * obstacleSpriteScale;
+    }
+    simulation->configure(Vector2f(window.getSize()), playerSize, obstacleSize);
+    simulation->reset();
+    
+    // Start background audio
+    audio.startVoice(engineMixer, engineVoice);
+    engineVoicePlaying = true;
 }
 
-// Validates obstacle placement to prevent clustering
-bool isPositionValid(float x, float y, const vector<Obstacle>& obstacles, float minDistance = 80.0f) {
-    // Check distance to all existing obstacles
-    for (const auto& obstacle : obstacles) {
-        float dx = x - obstacle.position.x;  // X-axis distance
-        float dy = y - obstacle.position.y;  // Y-axis distance
-        float distance = sqrt(dx * dx + dy * dy);  // Euclidean distance
-        
-        if (distance < minDistance) {
-            return false; // Too close to existing obstacle
-        }
-    }
-    return true; // Position is acceptable
+//=== TRAFFIC COST MEASUREMENT ===
+// Averages per frame over each window; in stress mode the result is shown on screen, and with
+// --bench every window is written to the benchmark log
+void PlayingState3::recordTrafficCost(float deltaTime, size_t obstacles, size_t candidates, double simulationTime, double trafficTime, double broadphaseTime)
+{
+    trafficWindowTime += deltaTime;
+    trafficWindowFrames++;
+    trafficWindowCars += obstacles;
+    trafficWindowCandidates += candidates;
+    trafficWindowSimulation += simulationTime;
+    trafficWindowFlow += trafficTime;
+    trafficWindowBroadphase += broadphaseTime;
+    const SpriteBatchStats& batch = carBatch.getStats();  // Last drawn frame
+    trafficWindowQuads += batch.quads;
+    trafficWindowDraws += batch.drawCalls;
+    trafficWindowLargestBatch = max(trafficWindowLargestBatch, batch.largestBatch);
+    trafficWindowOverdraw += batch.overdraw;
+    trafficWindowCarDraw += carDrawTime;
+    trafficWindowParticles += particles->size();
+    trafficWindowParticleUpdate += particleUpdateTime;
+    trafficWindowParticleDraw += particleDrawTime;
+    if (trafficWindowTime < TRAFFIC_REPORT_SECONDS) return;
+    
+    double frames = static_cast<double>(trafficWindowFrames);
+    double averageCars = trafficWindowCars / frames;
+    double averageSimulation = trafficWindowSimulation / frames;
+    double averageFlow = trafficWindowFlow / frames;
+    double averageBroadphase = trafficWindowBroadphase / frames;
+    double averageCandidates = trafficWindowCandidates / frames;
+    double averageQuads = trafficWindowQuads / frames;
+    double averageDraws = trafficWindowDraws / frames;
+    double averageOverdraw = trafficWindowOverdraw / frames;
+    double averageCarDraw = trafficWindowCarDraw / frames;
+    double averageParticles = trafficWindowParticles / frames;
+    double averageParticleUpdate = trafficWindowParticleUpdate / frames;
+    double averageParticleDraw = trafficWindowParticleDraw / frames;
+    
+    ostringstream report;
+    report.setf(ios::fixed);
+    report.precision(1);
+    report << "Traffic x" << simulation->getTrafficDensity() << ": " << averageCars << " cars, update " << averageSimulation
+           << " us, broadphase " << averageBroadphase << " us, " << averageCandidates
+           << " candidates, " << simulation->getStressCollisions() << " collisions\n"
+           << "Flow: " << simulation->getTraffic().size() << " vehicles on " << simulation->getTraffic().getLaneCount()
+           << " lanes, step " << averageFlow << " us (" << simulation->getWorkerCount() << " workers), "
+           << simulation->getTraffic().getLaneChanges() << " lane changes\n"
+           << "Cars drawn: " << averageQuads << " quads in " << averageDraws << " draws (largest "
+           << trafficWindowLargestBatch << "), overdraw " << averageOverdraw << ", " << averageCarDraw << " us\n"
+           << "Particles: " << averageParticles << ", update " << averageParticleUpdate << " us ("
+           << particles->getWorkerCount() << " workers), draw " << averageParticleDraw << " us";
+    trafficReport = report.str();
+    
+    if (benchmarkLog.isOpen()) {
+        ostringstream json;
+        json.setf(ios::fixed);
+        json.precision(3);
+        json << "{\"type\":\"traffic\",\"density\":" << simulation->getTrafficDensity()
+             << ",\"window\":" << jsonNumber(trafficWindowTime)
+             << ",\"frames\":" << trafficWindowFrames
+             << ",\"cars\":" << jsonNumber(averageCars)
+             << ",\"update_us\":" << jsonNumber(averageSimulation)
+             << ",\"broadphase_us\":" << jsonNumber(averageBroadphase)
+             << ",\"vehicles\":" << simulation->getTraffic().size()
+             << ",\"flow_us\":" << jsonNumber(averageFlow)
+             << ",\"flow_workers\":" << simulation->getWorkerCount()
+             << ",\"lane_changes\":" << simulation->getTraffic().getLaneChanges()
+             << ",\"update_us_per_car\":" << jsonNumber(averageCars > 0.0 ? averageSimulation / averageCars : 0.0)
+             << ",\"candidates_per_frame\":" << jsonNumber(averageCandidates)
+             << ",\"collisions\":" << simulation->getStressCollisions()
+             << ",\"car_quads\":" << jsonNumber(averageQuads)
+             << ",\"car_draw_calls\":" << jsonNumber(averageDraws)
+             << ",\"largest_batch\":" << trafficWindowLargestBatch
+             << ",\"overdraw\":" << jsonNumber(averageOverdraw)
+             << ",\"car_draw_us\":" << jsonNumber(averageCarDraw)
+             << ",\"particles\":" << jsonNumber(averageParticles)
+             << ",\"particle_update_us\":" << jsonNumber(averageParticleUpdate)
+             << ",\"particle_draw_us\":" << jsonNumber(averageParticleDraw)
+             << ",\"particle_workers\":" << particles->getWorkerCount() << "}";
+        benchmarkLog.write(json.str());
+    }
+    
+    trafficWindowTime = 0.0f;
+    trafficWindowFrames = 0;
+    trafficWindowCars = 0;
+    trafficWindowCandidates = 0;
+    trafficWindowSimulation = 0.0;
+    trafficWindowFlow = 0.0;
+    trafficWindowBroadphase = 0.0;
+    trafficWindowQuads = 0;
+    trafficWindowDraws = 0;
+    trafficWindowLargestBatch = 0;
+    trafficWindowOverdraw = 0.0;
+    trafficWindowCarDraw = 0.0;
+    trafficWindowParticles = 0;
+    trafficWindowParticleUpdate = 0.0;
+    trafficWindowParticleDraw = 0.0;
 }
 
-// Calculates Euclidean distance between two 2D points
-float calculateDistance(const Vector2f& pos1, const Vector2f& pos2) {
-    float dx = pos1.x - pos2.x;  // Delta X
-    float dy = pos1.y - pos2.y;  // Delta Y
-    return sqrt(dx * dx + dy * dy);  // Pythagorean theorem
+void PlayingState3::stopObstacleSounds()
+{
+    obstacleVoices.stopAll();
 }
 
-//=== MAIN GAME LOOP FUNCTION ===
-// Handles all logic and rendering for PlayingState3
-void handlePlayingState3(RenderWindow& window, bool& running, GameState& state)
+//=== LEVEL 3 UPDATE ===
+// Keyboard -> simulation input, one simulation step, then the presentation of its result
+void PlayingState3::update(RenderWindow& window, float deltaTime, GameState& state)
 {
-    // External reference to global music volume setting
-    extern float musicVolume;
-    
-    //=== PERSISTENT STATE VARIABLES ===
-    // Static variables maintain state between function calls
-    
-    // Font loading
-    static Font font;
-    static bool fontLoaded = false;
-    
-    // Background system
-    static Texture backgroundTexture;      // Image data
-    static Sprite* backgroundSprite = nullptr;  // Display object (pointer for lazy initialization)
-    static bool backgroundLoaded = false;       // Loading status flag
-    static float backgroundOffset1 = 0.0f;      // Primary scrolling offset
-    static float backgroundOffset2 = 0.0f;      // Secondary offset for seamless loop
-    
-    // Sprite sheet system for car graphics
-    static Texture carSpriteSheet;           // Contains all car images
-    static bool carSpriteSheetLoaded = false; // Loading status
-    static vector<IntRect> carSpriteRects;   // Defines sub-rectangles for each car
-    static const int SPRITE_WIDTH = 32;      // Individual sprite dimensions
-    static const int SPRITE_HEIGHT = 64;
-    static const int SPRITES_PER_ROW = 5;    // Layout of sprite sheet
-    static const int TOTAL_CAR_SPRITES = 5;
+    //=== INPUT HANDLING ===
+    // Help system toggle (available after narrative completion)
+    if (simulation->isTextSequenceCompleted() && input.wasPressed(Keyboard::Key::H)) {
+        helpRequested = !helpRequested;
+    }
     
-    // Audio system
-    static Music engineMusic;                    // Background engine sound
-    static bool engineMusicLoaded = false;
-    static float lastGameSpeed = 200.0f;         // Previous frame's speed for audio adjustments
+    Level3Input controls;
+    controls.musicOff = musicVolume <= 0.0f;
+    bool left = input.isDown(Keyboard::Key::A) || input.isDown(Keyboard::Key::Left);
+    bool right = input.isDown(Keyboard::Key::D) || input.isDown(Keyboard::Key::Right);
+    bool up = input.isDown(Keyboard::Key::W) || input.isDown(Keyboard::Key::Up);
+    bool down = input.isDown(Keyboard::Key::S) || input.isDown(Keyboard::Key::Down);
+    controls.steering = left ? -1.0f : (right ? 1.0f : 0.0f);
+    controls.throttle = up ? 1.0f : (down ? -1.0f : 0.0f);
+    controls.walk = Vector2f((right ? 1.0f : 0.0f) - (left ? 1.0f : 0.0f), (down ? 1.0f : 0.0f) - (up ? 1.0f : 0.0f));
     
-    // Obstacle audio template
-    static SoundBuffer masterObstacleEngineBuffer;     // Template sound data
-    static bool masterObstacleEngineBufferLoaded = false;
-    static const float MAX_OBSTACLE_SOUND_DISTANCE = 800.0f; // Maximum audible range
-    static const float MIN_OBSTACLE_SOUND_DISTANCE = 100.0f; // Distance for full volume
-    
-    // Special narrative system (triggers after 10 seconds of silence)
-    static Clock musicOffTimer;            // Tracks duration of music being off
-    static bool musicWasOff = false;       // Previous frame's music state
-    static Clock textDisplayTimer;         // Controls text sequence timing
-    static bool textSequenceStarted = false;
-    static int currentTextIndex = -1;      // Index of currently displayed message
-    static bool textSequenceCompleted = false;
-    static bool levelTimersInitialized = false; // Prevents re-initialization
+    // Vehicle exit request (the simulation checks that the car stopped)
+    controls.exitCar = input.wasPressed(Keyboard::Key::F);
     
-    // User interaction system
-    static bool helpRequested = false;     // Player requested help display
-    static bool playerOutOfCar = false;    // Player exited vehicle
-    static bool hKeyPressed = false;       // Input state tracking (prevents key repeat)
-    static bool fKeyPressed = false;
-    
-    // Abandoned car visualization (when player exits)
-    static RectangleShape carShape({30, 50});        // Simple rectangle fallback
-    static std::optional<Sprite> abandonedCarSprite; // Sprite copy for abandoned car
-    static Vector2f carPosition;                     // Where car was left
-    static bool carShapeInitialized = false;
-    
-    // Narrative text content
-    static const vector<string> secretTexts = {
-		"Blah blah blah...",
-
-        /*"That's better.",
-        "That moment where everything goes quiet.",
-        "Isn't it soothing.",
-        "All the noise washed away.",
-        "Nothing to distract you anymore.",
-        "Nothing but the sound of the engine and the endless road ahead.",
-        "It does get boring after a while though.",
-        "Maybe you should turn the music back on.",
-        "Or perhaps not...",
-        "The choice is yours.",
-        "You can also keep driving in silence.",
-        "Or you can go the next level.",
-        "If there is one...",
-        "I'm sure you'll figure it out.",
-        "I'll be here if you need me."*/
-    };
-    
-    //=== GAME STATE VARIABLES ===
-    // These reset when game restarts
-    static Clock clock;                    // Frame timing
-    static Clock gameTimer;               // Total session time
-    static Car player;                    // Player's car object
-    static vector<TrackSegment> track;    // Collection of track pieces
-    static vector<Obstacle> obstacles;    // Active obstacle cars
-    static bool gameInitialized = false;  // Initialization flag
-
-    // Obstacle generation system
-    static float lastObstacleDistance = 0.0f;  // Distance when last obstacle was created
-    static float nextObstacleDistance = 300.0f; // Distance threshold for next obstacle
-
-    // Core game metrics
-    static float gameSpeed = 200.0f;       // Current scrolling speed
-    static float trackWidth = 400.0f;      // Race track width
-    static int score = 0;                  // Player score (based on distance)
-    static bool gameOver = false;          // Game state flag
-    static float totalDistance = 0.0f;     // Cumulative distance traveled
-    
-    // Random number generation system
-    static random_device rd;
-    static mt19937 gen(rd());
-    
-    //=== ONE-TIME LEVEL INITIALIZATION ===
-    // Execute only once when entering this game state
-    if (!levelTimersInitialized) {
-        musicOffTimer.restart();                    // Begin tracking music state
-        textDisplayTimer.restart();                // Initialize text timing
-        musicWasOff = (musicVolume <= 0.0f);       // Record initial music state
-        textSequenceStarted = false;
-        currentTextIndex = -1;
-        textSequenceCompleted = false;
-        helpRequested = false;
-        playerOutOfCar = false;
-        levelTimersInitialized = true;             // Prevent re-execution
-    }
+    //=== SIMULATION STEP ===
+    auto simulationStart = chrono::steady_clock::now();
+    Level3Events events;
+    simulation->step(deltaTime, controls, events);
     
-    //=== ASSET LOADING ===
-    // Car sprite sheet loading and processing
-    if (!carSpriteSheetLoaded) {
-        if (carSpriteSheet.loadFromFile("Images/Cars.png")) {
-            carSpriteSheetLoaded = true;
-            
-            // Parse sprite sheet into individual car rectangles
-            carSpriteRects.clear();
-            
-            // Calculate dimensions of each sprite
-            Vector2u textureSize = carSpriteSheet.getSize();
-            int actualSpriteWidth = textureSize.x / SPRITES_PER_ROW;
-            int actualSpriteHeight = textureSize.y;
-            
-            cout << "Texture size: " << textureSize.x << "x" << textureSize.y << endl;
-            cout << "Calculated sprite size: " << actualSpriteWidth << "x" << actualSpriteHeight << endl;
-            
-            // Create rectangle definitions for each car sprite
-            for (int i = 0; i < TOTAL_CAR_SPRITES; ++i) {
-                int col = i; // Column in sprite sheet (horizontal layout)
-                
-                // Define rectangle bounds for this sprite
-                IntRect rect({col * actualSpriteWidth, 0}, {actualSpriteWidth, actualSpriteHeight});
-                carSpriteRects.push_back(rect);
-                
-                cout << "Car " << i << " rect: (" << rect.position.x << ", " << rect.position.y 
-                     << ", " << rect.size.x << ", " << rect.size.y << ")" << endl;
-            }
-        } else {
-            cerr << "Failed to load Images/Cars.png" << endl;
-            carSpriteSheetLoaded = false;
-        }
+    // Level exit condition (exit() and unload() release the level's audio and graphics)
+    if (events.walkedAway) {
+        state = MENU;  // Transition to menu state
+        return;
     }
-    
-    // Background texture loading with scaling
-    if (!backgroundLoaded) {
-        if (backgroundTexture.loadFromFile("Images/grass.png")) {
-            // Create sprite object from loaded texture
-            backgroundSprite = new Sprite(backgroundTexture);
-            
-            // Calculate scaling to fit window
-            Vector2u windowSize = window.getSize();
-            Vector2u textureSize = backgroundTexture.getSize();
-            
-            float scaleX = static_cast<float>(windowSize.x) / textureSize.x;
-            float scaleY = static_cast<float>(windowSize.y) / textureSize.y;
-            
-            backgroundSprite->setScale(Vector2f(scaleX, scaleY));
-            backgroundLoaded = true;
-        } 
-        else {
-            cerr << "Failed to load grass.png" << endl;
-        }
+    if (events.leftCar) {
+        // Reconfigure player as pedestrian
+        playerShape.setSize(Vector2f(20, 30));
+        playerShape.setOrigin(Vector2f(10, 15));
     }
     
-    // Engine music initialization
-    if (!engineMusicLoaded) {
-        if (engineMusic.openFromFile("Sounds/Engine4.ogg")) {
-            engineMusic.setLooping(true);                    // Enable continuous loop
-            float initialVolume = (60.0f / 100.0f) * musicVolume;  // UPDATED: Increased initial volume from 30% to 60%
-            engineMusic.setVolume(initialVolume);            // Set volume based on global setting
-            engineMusicLoaded = true;
-        } else {
-            cerr << "Failed to load Engine4.ogg" << endl;
-            engineMusicLoaded = false;
-        }
-    }
-        
-    // Obstacle sound template loading
-    if (!masterObstacleEngineBufferLoaded) {
-        if (masterObstacleEngineBuffer.loadFromFile("Sounds/Engine1.2.ogg")) {
-            masterObstacleEngineBufferLoaded = true;
-        } else {
-            cerr << "Failed to load Engine1.2.ogg for obstacles" << endl;
-            masterObstacleEngineBufferLoaded = false;
-        }
-    }
-    
-    //=== GAME INITIALIZATION ===
-    // Set up game objects and initial state
-    if (!gameInitialized) {
-        // Load text font
-        if (!fontLoaded) {
-            if (!font.openFromFile("arial.ttf")) {
-                cerr << "Failed to load arial.ttf" << endl;
-            }
-            fontLoaded = true;
-        }
-        
-        // Configure player car sprite
-        if (carSpriteSheetLoaded && !carSpriteRects.empty()) {
-            player.sprite = Sprite(carSpriteSheet);
-            player.spriteIndex = 0;                          // Use first car design
-            player.sprite->setTextureRect(carSpriteRects[player.spriteIndex]);
-            
-            // Calculate appropriate scaling
-            Vector2u textureSize = carSpriteSheet.getSize();
-            int actualSpriteWidth = textureSize.x / SPRITES_PER_ROW;
-            
-            float scale = 30.0f / actualSpriteWidth;         // Target width of 30 pixels
-            player.sprite->setScale(Vector2f(scale, scale));
-            player.sprite->setOrigin(Vector2f(actualSpriteWidth / 2.0f, textureSize.y / 2.0f));
-            
-            cout << "Player sprite initialized with scale: " << scale << endl;
-        }
-        
-        // Position player at bottom-center of screen
-        player.position = Vector2f(static_cast<float>(window.getSize().x) / 2.0f, static_cast<float>(window.getSize().y) * 0.8f);
-        
-        // Initialize fallback car shape
-        if (!carShapeInitialized) {
-            carShape.setSize(Vector2f(30, 50));
-            carShape.setFillColor(Color::Red);
-            carShape.setOrigin(Vector2f(15, 25));
-            carShapeInitialized = true;
-        }
-        
-        // Generate initial track segments extending upward
-        for (int i = 0; i < 50; ++i) {
-            track.emplace_back(-i * 20.0f, trackWidth, static_cast<float>(window.getSize().x));
-        }
-        
-        // Reset obstacle generation parameters
-        lastObstacleDistance = 0.0f;
-        nextObstacleDistance = 300.0f;
-        
-        // Initialize timing systems
-        clock.restart();
-        gameTimer.restart();
-        totalDistance = 0.0f;
-        
-        // Start background audio
-        if (engineMusicLoaded && !playerOutOfCar) {
-            engineMusic.play();
-        }
-        
-        gameInitialized = true;
-    }
-
-    //=== FRAME TIMING ===
-    // Calculate time elapsed since last frame for smooth animation
-    float deltaTime = clock.restart().asSeconds();
+    bool driving = !simulation->isGameOver() && !simulation->isPlayerOutOfCar();
+    float gameSpeed = simulation->getGameSpeed();
     
     //=== BACKGROUND ANIMATION ===
-    // Implement parallax scrolling effect
-    if (backgroundLoaded && backgroundSprite && !gameOver && !playerOutOfCar) {
-        float backgroundScrollSpeed = gameSpeed * 0.3f;  // Slower than foreground for depth
-        backgroundOffset1 += backgroundScrollSpeed * deltaTime;
-        backgroundOffset2 += backgroundScrollSpeed * deltaTime;
-        
-        // Handle wrap-around for infinite scrolling
-        Vector2u textureSize = backgroundTexture.getSize();
-        Vector2f scale = backgroundSprite->getScale();
-        float scaledHeight = textureSize.y * scale.y;
-        
-        if (backgroundOffset1 >= scaledHeight) {
-            backgroundOffset1 -= scaledHeight;  // Reset to create seamless loop
-        }
-        if (backgroundOffset2 >= scaledHeight) {
-            backgroundOffset2 -= scaledHeight;
-        }
+    // Implement parallax scrolling effect (each layer wraps its own texture offset)
+    if (driving) {
+        background.scroll(gameSpeed * deltaTime);
     }
     
     //=== DYNAMIC AUDIO SYSTEM ===
     // Adjust engine sound based on vehicle speed and global volume settings
     // All engine sounds in Level 3 now respect the global musicVolume setting from settings menu
-    if (engineMusicLoaded) {
-        if (!playerOutOfCar && !gameOver) {
+    if (engineVoice != EngineMixer::InvalidId) {
+        if (driving) {
             // Normalize speed to 0-1 range for audio calculations
             float speedRatio = (gameSpeed - 50.0f) / (1000.0f - 50.0f);
             speedRatio = max(0.0f, min(1.0f, speedRatio));  // Clamp to valid range
             
             // Higher speed increases pitch (realistic engine behavior)
             float pitch = 0.8f + (speedRatio * 0.6f);       // Range: 0.8 to 1.4
-            engineMusic.setPitch(pitch);
             
             // UPDATED: Increased base volume for louder engine sound - Range: 40 to 80 (was 20 to 40)
             float baseVolume = 40.0f + (speedRatio * 40.0f);    // Range: 40 to 80
             float adjustedVolume = (baseVolume / 100.0f) * musicVolume;  // Scale by global volume
-            engineMusic.setVolume(adjustedVolume);
+            audio.setVoice(engineMixer, engineVoice, adjustedVolume / 100.0f, pitch);
             
-            // Ensure music continues playing
-            if (engineMusic.getStatus() != Music::Status::Playing) {
-                engineMusic.play();
+            // Ensure engine continues playing
+            if (!engineVoicePlaying) {
+                audio.startVoice(engineMixer, engineVoice);
+                engineVoicePlaying = true;
             }
-        } else {
+        } else if (engineVoicePlaying) {
             // Silence engine when not driving
-            if (engineMusic.getStatus() == Music::Status::Playing) {
-                engineMusic.stop();
-            }
-        }
-    }
-    
-    //=== NARRATIVE TRIGGER SYSTEM ===
-    // Special event when background music is disabled
-    bool musicCurrentlyOff = (musicVolume <= 0.0f);
-    if (musicCurrentlyOff) {
-        if (!musicWasOff) {
-            musicOffTimer.restart();  // Begin timing silence period
-        }
-        // Trigger narrative after 10 seconds of silence
-        if (!textSequenceStarted && musicOffTimer.getElapsedTime().asSeconds() >= 10.0f) {
-            textSequenceStarted = true;
-            textDisplayTimer.restart();
-            currentTextIndex = 0;
-        }
-    } else {
-        // Reset narrative if music returns
-        if (musicWasOff) {
-            textSequenceStarted = false;
-            currentTextIndex = -1;
-            textSequenceCompleted = false;
-        }
-    }
-    musicWasOff = musicCurrentlyOff;  // Store state for next frame
-    
-    //=== TEXT SEQUENCE CONTROLLER ===
-    // Manages timing of narrative messages (9 seconds display, 1 second gap)
-    if (textSequenceStarted && !textSequenceCompleted) {
-        float textElapsedTime = textDisplayTimer.getElapsedTime().asSeconds();
-        
-        int cycleIndex = static_cast<int>(textElapsedTime / 10.0f);  // 10-second cycles
-        float cycleTime = textElapsedTime - (cycleIndex * 10.0f);   // Position within cycle
-        
-        if (cycleIndex < static_cast<int>(secretTexts.size())) {
-            if (cycleTime < 9.0f) {
-                currentTextIndex = cycleIndex;  // Display message
-            } else {
-                currentTextIndex = -1;          // Gap period
-            }
-        } else {
-            textSequenceCompleted = true;
-            currentTextIndex = static_cast<int>(secretTexts.size()) - 1;  // Final message
-        }
-    }
-    
-    //=== INPUT HANDLING ===
-    // Help system toggle (available after narrative completion)
-    if (textSequenceCompleted) {
-        if (Keyboard::isKeyPressed(Keyboard::Key::H)) {
-            if (!hKeyPressed) {  // Edge detection to prevent key repeat
-                helpRequested = !helpRequested;
-                hKeyPressed = true;
-            }
-        } else {
-            hKeyPressed = false;
-        }
-    }
-    
-    // Vehicle exit system
-    if (textSequenceCompleted && gameSpeed <= 55.0f && !playerOutOfCar) {
-        if (Keyboard::isKeyPressed(Keyboard::Key::F)) {
-            if (!fKeyPressed) {
-                playerOutOfCar = true;
-                carPosition = player.position;  // Store car location
-                
-                // Preserve car sprite for abandoned vehicle rendering
-                if (carSpriteSheetLoaded && player.sprite.has_value()) {
-                    abandonedCarSprite = player.sprite;
-                }
-                
-                // Reconfigure player as pedestrian
-                player.shape.setSize(Vector2f(20, 30));
-                player.shape.setOrigin(Vector2f(10, 15));
-                fKeyPressed = true;
-            }
-        } else {
-            fKeyPressed = false;
-        }
-    }
-    
-    //=== PEDESTRIAN MOVEMENT SYSTEM ===
-    if (playerOutOfCar) {
-        // Process movement input (WASD or arrow keys)
-        if (Keyboard::isKeyPressed(Keyboard::Key::A) || Keyboard::isKeyPressed(Keyboard::Key::Left)) {
-            player.position.x -= 150.0f * deltaTime;  // Move left
-        }
-        if (Keyboard::isKeyPressed(Keyboard::Key::D) || Keyboard::isKeyPressed(Keyboard::Key::Right)) {
-            player.position.x += 150.0f * deltaTime;  // Move right
-        }
-        if (Keyboard::isKeyPressed(Keyboard::Key::W) || Keyboard::isKeyPressed(Keyboard::Key::Up)) {
-            player.position.y -= 150.0f * deltaTime;  // Move up
-        }
-        if (Keyboard::isKeyPressed(Keyboard::Key::S) || Keyboard::isKeyPressed(Keyboard::Key::Down)) {
-            player.position.y += 150.0f * deltaTime;  // Move down
-        }
-        
-        // Boundary constraints (allow slight off-screen movement)
-        player.position.x = max(0.0f - 20.0f, min(static_cast<float>(window.getSize().x) + 20.0f, player.position.x));
-        player.position.y = max(0.0f, min(static_cast<float>(window.getSize().y) - 30.0f, player.position.y));
-        
-        // Level exit condition
-        if (player.position.x < -15 || player.position.x > static_cast<float>(window.getSize().x) + 15) {
-            // Cleanup all audio systems
-            if (engineMusicLoaded && engineMusic.getStatus() == Music::Status::Playing) {
-                engineMusic.stop();
-            }
-            
-            for (auto& obstacle : obstacles) {
-                if (obstacle.soundInitialized && obstacle.engineSound && obstacle.engineSound->getStatus() == Sound::Status::Playing) {
-                    obstacle.engineSound->stop();
-                }
-            }
-            
-            // Cleanup graphics resources
-            if (backgroundSprite) {
-                delete backgroundSprite;
-                backgroundSprite = nullptr;
-                backgroundLoaded = false;
-            }
-            
-            // Transition to menu state
-            state = MENU;
-            gameInitialized = false;
-            levelTimersInitialized = false;
-            return;
+            audio.stopVoice(engineMixer, engineVoice);
+            engineVoicePlaying = false;
         }
     }
     
-    //=== DRIVING MECHANICS ===
-    if (!gameOver && !playerOutOfCar) {
-        //--- Steering Input ---
-        if (Keyboard::isKeyPressed(Keyboard::Key::A) || Keyboard::isKeyPressed(Keyboard::Key::Left)) {
-            player.velocity.x = -player.speed;  // Steer left
-        }
-        else if (Keyboard::isKeyPressed(Keyboard::Key::D) || Keyboard::isKeyPressed(Keyboard::Key::Right)) {
-            player.velocity.x = player.speed;   // Steer right
-        }
-        else {
-            player.velocity.x = 0;              // No steering input
-        }
+    if (events.drove) {
+        const CarStore& cars = simulation->getCars();
+        size_t player = simulation->getPlayerIndex();
+        float playerX = cars.x[player];
+        float playerY = cars.y[player];
         
-        //--- Speed Control ---
-        if (Keyboard::isKeyPressed(Keyboard::Key::W) || Keyboard::isKeyPressed(Keyboard::Key::Up)) {
-            gameSpeed = min(gameSpeed + 100.0f * deltaTime, 1000.0f);  // Accelerate
+        //--- Collision Effects ---
+        if (events.scrapedWall) {
+            particles->emit(events.wallContact, wallDust.style, wallDust.due(deltaTime), gen);
         }
-        else if (Keyboard::isKeyPressed(Keyboard::Key::S) || Keyboard::isKeyPressed(Keyboard::Key::Down)) {
-            gameSpeed = max(gameSpeed - 100.0f * deltaTime, 50.0f);    // Decelerate
-        }
-
-        //--- Score Calculation ---
-        totalDistance += gameSpeed * deltaTime;           // Accumulate distance
-        score = static_cast<int>(totalDistance / 10.0f);  // Convert to score units
-
-        //--- Player Movement ---
-        player.position.x += player.velocity.x * deltaTime;  // Apply horizontal movement
-        
-        // Track boundary enforcement
-        float trackLeft = static_cast<float>(window.getSize().x) / 2.0f - trackWidth / 2.0f;
-        float trackRight = static_cast<float>(window.getSize().x) / 2.0f + trackWidth / 2.0f;
-        player.position.x = max(trackLeft + 15, min(trackRight - 15, player.position.x));
-        
-        //--- Track Animation System ---
-        // Move track segments downward to simulate forward motion
-        for (auto& segment : track) {
-            segment.position.y += gameSpeed * deltaTime;
-            // Update visual component positions
-            segment.road.setPosition(Vector2f(segment.position.x - segment.width/2, segment.position.y));
-            segment.leftWall.setPosition(Vector2f(segment.position.x - segment.width/2 - 10, segment.position.y));
-            segment.rightWall.setPosition(Vector2f(segment.position.x + segment.width/2, segment.position.y));
-        }
-        
-        //--- Track Segment Management ---
-        // Remove segments that have scrolled off screen
-        track.erase(remove_if(track.begin(), track.end(), 
-            [&](const TrackSegment& seg) { return seg.position.y > static_cast<float>(window.getSize().y) + 50; }), track.end());
-        
-        // Add new segments at the top to maintain continuous track
-        while (track.size() < 50) {
-            float newY = track.empty() ? -20 : track.front().position.y - 20;
-            track.insert(track.begin(), TrackSegment(newY, trackWidth, static_cast<float>(window.getSize().x)));
-        }
-        
-        //=== OBSTACLE GENERATION SYSTEM ===
-        float distanceSinceLastObstacle = totalDistance - lastObstacleDistance;
-
-        // Spawn new obstacles based on distance traveled
-        if (distanceSinceLastObstacle >= nextObstacleDistance) {
-            // Randomize next spawn distance
-            uniform_real_distribution<float> distanceDist(200.0f, 500.0f);
-            nextObstacleDistance = distanceDist(gen);
-            lastObstacleDistance = totalDistance;
-            
-            // Determine number of obstacles to spawn
-            uniform_int_distribution<int> countDist(1, 2);
-            int numObstacles = countDist(gen);
-            
-            // Define spawn area within track bounds
-            uniform_real_distribution<float> xDist(trackLeft + 30, trackRight - 30);
-            
-            // Attempt to place each obstacle
-            for (int i = 0; i < numObstacles; ++i) {
-                int attempts = 0;
-                const int maxAttempts = 10;  // Prevent infinite loops
-                
-                while (attempts < maxAttempts) {
-                    float newX = xDist(gen);   // Random X position
-                    float newY = -50.0f;       // Spawn above screen
-                    
-                    // Validate position doesn't conflict with existing obstacles
-                    if (isPositionValid(newX, newY, obstacles, 80.0f)) {
-                        obstacles.emplace_back(newX, newY);
-                        
-                        // Configure obstacle sprite
-                        if (carSpriteSheetLoaded && !carSpriteRects.empty()) {
-                            Obstacle& newObstacle = obstacles.back();
-                            
-                            // Validate sprite index bounds
-                            if (newObstacle.spriteIndex >= 0 && newObstacle.spriteIndex < static_cast<int>(carSpriteRects.size())) {
-                                newObstacle.sprite = Sprite(carSpriteSheet);
-                                newObstacle.sprite->setTextureRect(carSpriteRects[newObstacle.spriteIndex]);
-                                
-                                // Calculate scaling for obstacle size
-                                Vector2u textureSize = carSpriteSheet.getSize();
-                                int actualSpriteWidth = textureSize.x / SPRITES_PER_ROW;
-                                
-                                float scale = 40.0f / actualSpriteWidth;  // Target 40px width
-                                newObstacle.sprite->setScale(Vector2f(scale, scale));
-                                newObstacle.sprite->setOrigin(Vector2f(actualSpriteWidth / 2.0f, textureSize.y / 2.0f));
-                                
-                                cout << "Obstacle sprite " << newObstacle.spriteIndex << " initialized with scale: " << scale << endl;
-                            } else {
-                                cerr << "Invalid sprite index: " << newObstacle.spriteIndex << endl;
-                            }
-                        }
-                        break;  // Successfully placed obstacle
-                    }
-                    attempts++;
-                }
-            }
+        if (events.collided) {
+            particles->emit(events.impact, crashSparks, 80, gen);
+            particles->emit(events.impact, crashSmoke, 40, gen);
         }
         
-        //=== OBSTACLE UPDATE SYSTEM ===
-        for (auto& obstacle : obstacles) {
-            // Move obstacle with combined speed (game speed + obstacle speed)
-            obstacle.position.y += (gameSpeed + obstacle.velocity.y) * deltaTime;
-            
-            // Update visual representation
-            if (carSpriteSheetLoaded && obstacle.sprite.has_value()) {
-                obstacle.sprite->setPosition(obstacle.position);
-            } else {
-                obstacle.shape.setPosition(obstacle.position);
-            }
-            
-            //--- Obstacle Audio Initialization ---
-            if (masterObstacleEngineBufferLoaded && !obstacle.soundInitialized) {
-                // Create personal copy of sound data (prevents interference)
-                obstacle.personalSoundBuffer = new SoundBuffer(masterObstacleEngineBuffer);
-                obstacle.engineSound = new Sound(*obstacle.personalSoundBuffer);
-                obstacle.engineSound->setLooping(true);
-                
-                // Add random pitch variation for audio diversity
-                float pitchVariation = 0.9f + static_cast<float>(rand()) / RAND_MAX * 0.4f;
-                obstacle.engineSound->setPitch(pitchVariation);
-                
-                // Add random volume variation
-                float volumeVariation = 0.8f + static_cast<float>(rand()) / RAND_MAX * 0.4f;
-                obstacle.soundVolume = volumeVariation;
-                
-                obstacle.soundInitialized = true;
-            }
-            
-            //--- Spatial Audio System ---
-            if (obstacle.soundInitialized && obstacle.engineSound) {
-                float distance = calculateDistance(obstacle.position, player.position);
+        //--- Spatial Audio System ---
+        // Audible obstacles are submitted to the voice pool; only the loudest get a real voice
+        if (obstacleEngineLoaded) {
+            for (size_t i = 0; i < cars.size(); ++i) {
+                if (cars.kind[i] != CarKind::Obstacle) continue;
+                float distance = calculateDistance(cars.x[i], cars.y[i], playerX, playerY);
                 
                 if (distance <= MAX_OBSTACLE_SOUND_DISTANCE) {
                     // Calculate volume based on distance (inverse relationship)
@@ -818,191 +625,154 @@ void handlePlayingState3(RenderWindow& window, bool& running, GameState& state)
                     volumeRatio = max(0.0f, min(1.0f, volumeRatio));
                     
                     // UPDATED: Increased base volume for louder obstacle engines - from 20.0f to 40.0f
-                    float baseVolume = volumeRatio * 40.0f * obstacle.soundVolume;  // Base volume calculation (doubled)
+                    float baseVolume = volumeRatio * 40.0f * cars.soundVolume[i];  // Base volume calculation (doubled)
                     float adjustedVolume = (baseVolume / 100.0f) * musicVolume;     // Scale by global volume
-                    obstacle.engineSound->setVolume(adjustedVolume);
-                    
-                    // Start playback if volume is sufficient (adjusted threshold for global volume)
-                    float minimumThreshold = (2.0f / 100.0f) * musicVolume;  // UPDATED: Increased threshold from 1.0f to 2.0f
-                    if (obstacle.engineSound->getStatus() != Sound::Status::Playing && adjustedVolume > minimumThreshold) {
-                        obstacle.engineSound->play();
-                    }
                     
                     // Dynamic pitch based on relative speed
-                    float relativeSpeed = (gameSpeed + obstacle.velocity.y) / 400.0f;
-                    float basePitch = 0.9f + static_cast<float>(rand()) / RAND_MAX * 0.4f;
-                    float speedPitch = basePitch + (relativeSpeed * 0.3f);
-                    obstacle.engineSound->setPitch(speedPitch);
+                    float relativeSpeed = (gameSpeed + cars.velocityY[i]) / 400.0f;
+                    float speedPitch = cars.pitchVariation[i] + (relativeSpeed * 0.3f);
                     
-                } else {
-                    // Stop audio when too distant
-                    if (obstacle.engineSound->getStatus() == Sound::Status::Playing) {
-                        obstacle.engineSound->stop();
+                    // Only play if volume is sufficient (adjusted threshold for global volume)
+                    float minimumThreshold = (2.0f / 100.0f) * musicVolume;  // UPDATED: Increased threshold from 1.0f to 2.0f
+                    if (adjustedVolume > minimumThreshold) {
+                        obstacleVoices.submit(cars.audioId[i], adjustedVolume, speedPitch);
                     }
                 }
             }
         }
         
-        //--- Obstacle Cleanup ---
-        // Remove obstacles that have moved off-screen
-        obstacles.erase(remove_if(obstacles.begin(), obstacles.end(),
-            [&](Obstacle& obs) { 
-                bool shouldRemove = obs.position.y > static_cast<float>(window.getSize().y) + 50;
-                if (shouldRemove && obs.soundInitialized && obs.engineSound && obs.engineSound->getStatus() == Sound::Status::Playing) {
-                    obs.engineSound->stop();  // Stop audio before removal
-                }
-                return shouldRemove;
-            }), obstacles.end());
+        // Assign voices; obstacles that were not submitted (out of range or removed) lose theirs
+        obstacleVoices.apply();
         
-        //=== ENHANCED COLLISION DETECTION SYSTEM ===
-        // Update player's collision bounds
-        if (carSpriteSheetLoaded && player.sprite.has_value()) {
-            player.sprite->setPosition(player.position);
-        } else {
-            player.shape.setPosition(player.position);
+        //--- Exhaust Emission ---
+        // At the rear of the player's car, and of the obstacles one after another
+        particles->emit(Vector2f(playerX, playerY + cars.halfHeight[player] / Level3Simulation::PLAYER_HITBOX_SIZE),
+                       playerExhaust.style, playerExhaust.due(deltaTime), gen);
+        size_t obstacles = cars.size() - 1;
+        size_t trafficPuffs = obstacles > 0 ? trafficExhaust.due(deltaTime * static_cast<float>(obstacles)) : 0;
+        for (size_t k = 0; k < trafficPuffs; ++k) {
+            do {
+                exhaustCursor = (exhaustCursor + 1) % cars.size();
+            } while (cars.kind[exhaustCursor] != CarKind::Obstacle);
+            particles->emit(Vector2f(cars.x[exhaustCursor], cars.y[exhaustCursor] + cars.halfHeight[exhaustCursor] / Level3Simulation::OBSTACLE_HITBOX_SIZE),
+                           trafficExhaust.style, 1, gen);
         }
         
-        // Check collision with each obstacle using smaller hitboxes
-        for (const auto& obstacle : obstacles) {
-            bool collision = false;
-            
-            // Use appropriate collision method based on available graphics with reduced hitbox size
-            if (carSpriteSheetLoaded && player.sprite.has_value() && obstacle.sprite.has_value()) {
-                // Both use sprites - use enhanced sprite collision with smaller hitboxes
-                collision = checkSpriteCollision(*player.sprite, *obstacle.sprite, 
-                                               player.hitboxSizeMultiplier, obstacle.hitboxSizeMultiplier);
-            } else if (carSpriteSheetLoaded && player.sprite.has_value() && !obstacle.sprite.has_value()) {
-                // Player has sprite, obstacle uses shape - mixed collision
-                collision = checkMixedCollision(*player.sprite, obstacle.shape, 
-                                              player.hitboxSizeMultiplier, obstacle.hitboxSizeMultiplier);
-            } else if (!player.sprite.has_value() && carSpriteSheetLoaded && obstacle.sprite.has_value()) {
-                // Player uses shape, obstacle has sprite - mixed collision (reversed parameters)
-                collision = checkMixedCollision(*obstacle.sprite, player.shape, 
-                                              obstacle.hitboxSizeMultiplier, player.hitboxSizeMultiplier);
-            } else {
-                // Both use shapes - enhanced shape collision with smaller hitboxes
-                collision = checkCollision(player.shape, obstacle.shape, 
-                                         player.hitboxSizeMultiplier, obstacle.hitboxSizeMultiplier);
-            }
-            
-            if (collision) {
-                gameOver = true;
-                break;  // Exit collision loop early
-            }
-        }
+        //--- Cost Measurement ---
+        recordTrafficCost(deltaTime, obstacles, events.candidates,
+            chrono::duration<double, micro>(chrono::steady_clock::now() - simulationStart).count(),
+            events.trafficTime, events.broadphaseTime);
     }
     
+    //=== PARTICLE EFFECTS ===
+    // Particles lie on the road: they drift with it while driving and settle once it stops
+    auto particleStart = chrono::steady_clock::now();
+    particles->update(deltaTime, driving ? gameSpeed : 0.0f);
+    particleUpdateTime = chrono::duration<double, micro>(chrono::steady_clock::now() - particleStart).count();
+    
     //=== AUDIO CLEANUP ===
     // Silence obstacle sounds during game over or pedestrian mode
-    if (gameOver || playerOutOfCar) {
-        for (auto& obstacle : obstacles) {
-            if (obstacle.soundInitialized && obstacle.engineSound && obstacle.engineSound->getStatus() == Sound::Status::Playing) {
-                obstacle.engineSound->stop();
-            }
-        }
+    if (!driving) {
+        stopObstacleSounds();
     }
     
     // Store speed for next frame's audio calculations
     lastGameSpeed = gameSpeed;
     
-    //=== RENDERING PIPELINE ===
-    // Clear screen with black background
-    window.clear(Color::Black);
+    //=== RESTART SYSTEM ===
+    if (simulation->isGameOver() && input.isDown(Keyboard::Key::R)) {
+        resetRun(window);
+    }
     
-    //--- Background Layer ---
-    if (backgroundLoaded && backgroundSprite) {
-        // Primary background instance
-        backgroundSprite->setPosition(Vector2f(0.0f, backgroundOffset1));
-        window.draw(*backgroundSprite);
-        
-        // Secondary instance for seamless scrolling
-        Vector2u textureSize = backgroundTexture.getSize();
-        Vector2f scale = backgroundSprite->getScale();
-        float scaledHeight = textureSize.y * scale.y;
-        
-        backgroundSprite->setPosition(Vector2f(0.0f, backgroundOffset1 - scaledHeight));
-        window.draw(*backgroundSprite);
+    //=== NAVIGATION CONTROLS ===
+    // Return to pre-level screen (ESC key) - the level stays loaded for a quick restart
+    if (input.wasPressed(Keyboard::Key::Escape)) {
+        state = PRELEVEL3;              // Return to Level 3 pre-level screen
     }
     
-    //--- Track Layer ---
-    static RectangleShape fullRoad({trackWidth, static_cast<float>(window.getSize().y) + 100});
-    static RectangleShape leftWall({10, static_cast<float>(window.getSize().y) + 100});
-    static RectangleShape rightWall({10, static_cast<float>(window.getSize().y) + 100});
-    static bool roadInitialized = false;
-    
-    // Initialize road graphics (one-time setup)
-    if (!roadInitialized) {
-        fullRoad.setSize(Vector2f(trackWidth, static_cast<float>(window.getSize().y) + 100));
-        if (backgroundLoaded) {
-            fullRoad.setFillColor(Color(102, 102, 102, 255));  // Gray road surface
-        }
-        
-        leftWall.setSize(Vector2f(10, static_cast<float>(window.getSize().y) + 100));
-        leftWall.setFillColor(Color::White);
-        
-        rightWall.setSize(Vector2f(10, static_cast<float>(window.getSize().y) + 100));
-        rightWall.setFillColor(Color::White);
-        
-        roadInitialized = true;
+    // Return to main menu (M key)
+    if (input.wasPressed(Keyboard::Key::M)) {
+        state = MENU;
     }
     
-    // Animate road surface for speed illusion
-    static float roadOffset = 0;
-    if (!gameOver && !playerOutOfCar && gameSpeed > 55.0f) {
-        roadOffset += gameSpeed * deltaTime;
-        if (roadOffset >= 50) roadOffset -= 50;  // Reset for continuous animation
+    // Access settings menu (F1 key)
+    if (input.wasPressed(Keyboard::Key::F1)) {
+        previousState = PLAYING3;
+        state = SETTINGS;
     }
+}
+
+//=== LEVEL 3 RENDERING ===
+void PlayingState3::draw(RenderWindow& window)
+{
+    const Font& font = resources.get(fontHandle);
     
-    // Position and render track elements
-    float centerX = static_cast<float>(window.getSize().x) / 2.0f;
-    fullRoad.setPosition(Vector2f(centerX - trackWidth/2, -50 + roadOffset));
-    leftWall.setPosition(Vector2f(centerX - trackWidth/2 - 10, -50 + roadOffset));
-    rightWall.setPosition(Vector2f(centerX + trackWidth/2, -50 + roadOffset));
+    //=== RENDERING PIPELINE ===
+    // Clear screen with black background
+    window.clear(Color::Black);
     
-    window.draw(fullRoad);
-    window.draw(leftWall);
-    window.draw(rightWall);
+    //--- Background Layer ---
+    background.draw(window, Vector2f(window.getSize()));
     
-    //--- Obstacle Layer ---
-    for (const auto& obstacle : obstacles) {
-        if (carSpriteSheetLoaded && obstacle.sprite.has_value()) {
-            window.draw(*obstacle.sprite);  // Render sprite
+    //--- Track Layer ---
+    // Road surface (gray over the grass, plain without it), walls and lane markings in one draw
+    // call; stress traffic spreads over the whole window, so its lanes are not marked
+    int markedLanes = simulation->getTrafficDensity() > 1 ? 0 : simulation->getTraffic().getLaneCount();
+    Color roadColor = backgroundLoaded ? Color(102, 102, 102, 255) : Color::White;
+    Color markingColor = backgroundLoaded ? Color::White : Color(102, 102, 102, 255);
+    simulation->getRoad().buildMesh(roadMesh, roadColor, Color::White, WALL_WIDTH, markedLanes, markingColor);
+    window.draw(roadMesh);
+    
+    //--- Particle Layer ---
+    // Under the cars: exhaust and dust come from beneath them
+    auto particleDrawStart = chrono::steady_clock::now();
+    particles->draw(window);
+    particleDrawTime = chrono::duration<double, micro>(chrono::steady_clock::now() - particleDrawStart).count();
+    
+    //--- Car Layer ---
+    // Traffic, the abandoned car and the player as quads of one batch: a single draw call while
+    // the sprite sheet is loaded (the pedestrian rectangle adds one), fallback rectangles likewise
+    auto carDrawStart = chrono::steady_clock::now();
+    const CarStore& cars = simulation->getCars();
+    carBatch.begin(window);
+    const Texture* carSpriteSheet = carSpriteSheetLoaded ? carSheetRegion.texture : nullptr;
+    Vector2f obstacleScale(obstacleSpriteScale, obstacleSpriteScale);
+    Vector2f playerScale(playerSpriteScale, playerSpriteScale);
+    for (size_t i = 0; i < cars.size(); ++i) {
+        if (cars.kind[i] != CarKind::Obstacle) continue;
+        Vector2f position(cars.x[i], cars.y[i]);
+        if (carSpriteSheet && cars.spriteIndex[i] < carSpriteRects.size()) {
+            carBatch.draw(*carSpriteSheet, carSpriteRects[cars.spriteIndex[i]], position, carSpriteOrigin, obstacleScale);
         } else {
-            window.draw(obstacle.shape);   // Render fallback rectangle
+            carBatch.drawRect(position, obstacleShape.getSize(), obstacleShape.getOrigin(), obstacleShape.getFillColor());
         }
     }
     
-    //--- Player/Vehicle Layer ---
-    if (playerOutOfCar) {
-        // Render abandoned vehicle at stored location
-        if (carSpriteSheetLoaded && abandonedCarSprite.has_value()) {
-            abandonedCarSprite->setPosition(carPosition);
-            window.draw(*abandonedCarSprite);
+    size_t player = simulation->getPlayerIndex();
+    Vector2f playerPosition(cars.x[player], cars.y[player]);
+    if (simulation->isPlayerOutOfCar()) {
+        // Abandoned vehicle at its stored location, then the pedestrian player
+        size_t abandoned = simulation->getAbandonedIndex();
+        Vector2f carPosition(cars.x[abandoned], cars.y[abandoned]);
+        if (carSpriteSheet && !carSpriteRects.empty()) {
+            carBatch.draw(*carSpriteSheet, carSpriteRects[0], carPosition, carSpriteOrigin, playerScale);
         } else {
-            carShape.setPosition(carPosition);
-            window.draw(carShape);
+            carBatch.drawRect(carPosition, carShape.getSize(), carShape.getOrigin(), carShape.getFillColor());
         }
-        
-        // Render pedestrian player
-        player.shape.setFillColor(Color::Blue);
-        player.shape.setPosition(player.position);
-        window.draw(player.shape);
+        carBatch.drawRect(playerPosition, playerShape.getSize(), playerShape.getOrigin(), Color::Blue);
+    } else if (carSpriteSheet && !carSpriteRects.empty()) {
+        carBatch.draw(*carSpriteSheet, carSpriteRects[0], playerPosition, carSpriteOrigin, playerScale);
     } else {
-        // Render player in vehicle
-        if (carSpriteSheetLoaded && player.sprite.has_value()) {
-            player.sprite->setPosition(player.position);
-            window.draw(*player.sprite);
-        } else {
-            player.shape.setFillColor(Color::Red);
-            player.shape.setPosition(player.position);
-            window.draw(player.shape);
-        }
+        carBatch.drawRect(playerPosition, playerShape.getSize(), playerShape.getOrigin(), Color::Red);
     }
+    carBatch.end();
+    carDrawTime = chrono::duration<double, micro>(chrono::steady_clock::now() - carDrawStart).count();
     
     //--- UI Text Layer ---
     // Render narrative text sequence
-    if (textSequenceStarted && currentTextIndex >= 0 && currentTextIndex < static_cast<int>(secretTexts.size())) {
-        Text secretText(font, secretTexts[currentTextIndex], 32);
+    int textIndex = simulation->getCurrentTextIndex();
+    if (simulation->isTextSequenceStarted() && textIndex >= 0 && textIndex < static_cast<int>(Level3Simulation::getTextCount())) {
+        Text secretText(font, Level3Simulation::getText(textIndex), 32);
         secretText.setFillColor(Color::Cyan);
         secretText.setOutlineColor(Color::Black);
         secretText.setOutlineThickness(2.f);
@@ -1015,7 +785,7 @@ void handlePlayingState3(RenderWindow& window, bool& running, GameState& state)
     }
     
     // Render help system hint
-    if (textSequenceCompleted && !helpRequested) {
+    if (simulation->isTextSequenceCompleted() && !helpRequested) {
         Text helpHint(font, "H - Help", 20);
         helpHint.setFillColor(Color::White);
         helpHint.setOutlineColor(Color::Black);
@@ -1067,7 +837,7 @@ void handlePlayingState3(RenderWindow& window, bool& running, GameState& state)
         window.draw(helpText4);
         
         // Dynamic status feedback
-        if (gameSpeed <= 55.0f && !playerOutOfCar) {
+        if (simulation->isStopped() && !simulation->isPlayerOutOfCar()) {
             Text statusText(font, "Car stopped! Press F to get out", 20);
             statusText.setFillColor(Color::Green);
             statusText.setOutlineColor(Color::Black);
@@ -1076,7 +846,7 @@ void handlePlayingState3(RenderWindow& window, bool& running, GameState& state)
             statusText.setOrigin(Vector2f(statusBounds.size.x / 2.f, statusBounds.size.y / 2.f));
             statusText.setPosition(Vector2f(static_cast<float>(window.getSize().x) / 2.f, static_cast<float>(window.getSize().y) / 2.f + 80));
             window.draw(statusText);
-        } else if (playerOutOfCar) {
+        } else if (simulation->isPlayerOutOfCar()) {
             Text statusText(font, "Be free from this nightmare", 20);
             statusText.setFillColor(Color::Cyan);
             statusText.setOutlineColor(Color::Black);
@@ -1095,7 +865,7 @@ void handlePlayingState3(RenderWindow& window, bool& running, GameState& state)
     }
     
     // Vehicle exit prompt
-    if (textSequenceCompleted && !helpRequested && gameSpeed <= 55.0f && !playerOutOfCar) {
+    if (simulation->isTextSequenceCompleted() && !helpRequested && simulation->isStopped() && !simulation->isPlayerOutOfCar()) {
         Text exitHint(font, "Press F to exit car", 20);
         exitHint.setFillColor(Color::Green);
         exitHint.setOutlineColor(Color::Black);
@@ -1107,24 +877,34 @@ void handlePlayingState3(RenderWindow& window, bool& running, GameState& state)
     }
     
     // Core game UI elements
-    Text scoreText(font, "Distance: " + to_string(score) + "m", 36);
+    Text scoreText(font, "Distance: " + to_string(simulation->getScore()) + "m", 36);
     scoreText.setFillColor(Color::White);
     scoreText.setOutlineColor(Color::Black);
     scoreText.setOutlineThickness(2.f);
     scoreText.setPosition(Vector2f(20, 20));
     window.draw(scoreText);
     
-    Text speedText(font, "Speed: " + to_string(static_cast<int>(gameSpeed)) + " px/s", 24);
+    Text speedText(font, "Speed: " + to_string(static_cast<int>(simulation->getGameSpeed())) + " px/s", 24);
     speedText.setFillColor(Color::White);
     speedText.setOutlineColor(Color::Black);
     speedText.setOutlineThickness(2.f);
     speedText.setPosition(Vector2f(20, 70));
     window.draw(speedText);
     
+    // Stress mode cost readout
+    if (simulation->getTrafficDensity() > 1 && !trafficReport.empty()) {
+        Text trafficText(font, trafficReport, 20);
+        trafficText.setFillColor(Color::Yellow);
+        trafficText.setOutlineColor(Color::Black);
+        trafficText.setOutlineThickness(2.f);
+        trafficText.setPosition(Vector2f(20, 110));
+        window.draw(trafficText);
+    }
+    
     //=== GAME OVER INTERFACE ===
-    if (gameOver) {
+    if (simulation->isGameOver()) {
         // Game over message
-        Text gameOverText(font, "GAME OVER! Distance: " + to_string(score) + "m", 36);
+        Text gameOverText(font, "GAME OVER! Distance: " + to_string(simulation->getScore()) + "m", 36);
         gameOverText.setFillColor(Color::Red);
         gameOverText.setOutlineColor(Color::Black);
         gameOverText.setOutlineThickness(3.f);
@@ -1142,113 +922,10 @@ void handlePlayingState3(RenderWindow& window, bool& running, GameState& state)
         restartText.setOrigin(Vector2f(restartBounds.size.x / 2.f, restartBounds.size.y / 2.f));
         restartText.setPosition(Vector2f(static_cast<float>(window.getSize().x) / 2.f, static_cast<float>(window.getSize().y) / 2.f + 20));
         window.draw(restartText);
-        
-        //=== RESTART SYSTEM ===
-        if (Keyboard::isKeyPressed(Keyboard::Key::R)) {
-            // Audio cleanup before reset
-            for (auto& obstacle : obstacles) {
-                if (obstacle.soundInitialized && obstacle.engineSound && obstacle.engineSound->getStatus() == Sound::Status::Playing) {
-                    obstacle.engineSound->stop();
-                }
-            }
-            
-            // Reset all game state to initial values
-            gameOver = false;
-            obstacles.clear();
-            track.clear();
-            score = 0;
-            totalDistance = 0.0f;
-            gameSpeed = 200.0f;
-            player.position = Vector2f(static_cast<float>(window.getSize().x) / 2.0f, static_cast<float>(window.getSize().y) * 0.8f);
-            player.shape.setSize(Vector2f(30, 50));
-            player.shape.setOrigin(Vector2f(15, 25));
-            gameTimer.restart();
-            roadInitialized = false;
-            gameInitialized = false;
-            helpRequested = false;
-            playerOutOfCar = false;
-            
-            // Clear abandoned car reference
-            abandonedCarSprite.reset();
-        }
     }
+}
 
-    //=== NAVIGATION CONTROLS ===
-    // Static variables for input state tracking to prevent key repeat
-    static bool mPressed = false;        // M key state
-    static bool f1Pressed = false;      // F1 key state
-    static bool escPressed = false;     // ESC key state (NEW)
-    
-    // NEW: Return to pre-level screen (ESC key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::Escape)) {
-        if (!escPressed) {  // Edge detection to prevent key repeat
-            // Complete cleanup before state transition
-            if (engineMusicLoaded && engineMusic.getStatus() == Music::Status::Playing) {
-                engineMusic.stop();
-            }
-            
-            for (auto& obstacle : obstacles) {
-                if (obstacle.soundInitialized && obstacle.engineSound && obstacle.engineSound->getStatus() == Sound::Status::Playing) {
-                    obstacle.engineSound->stop();
-                }
-            }
-            
-            if (backgroundSprite) {
-                delete backgroundSprite;
-                backgroundSprite = nullptr;
-                backgroundLoaded = false;
-            }
-            
-            state = PRELEVEL3;              // Return to Level 3 pre-level screen
-            gameInitialized = false;        // Reset for potential restart
-            levelTimersInitialized = false; // Reset level timers
-            escPressed = true;              // Mark key as pressed
-        }
-    }
-    else {
-        escPressed = false;  // Reset when key released
-    }
-    
-    // Return to main menu (M key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::M)) {
-        if (!mPressed) {  // Edge detection to prevent key repeat
-            // Complete cleanup before state transition
-            if (engineMusicLoaded && engineMusic.getStatus() == Music::Status::Playing) {
-                engineMusic.stop();
-            }
-            
-            for (auto& obstacle : obstacles) {
-                if (obstacle.soundInitialized && obstacle.engineSound && obstacle.engineSound->getStatus() == Sound::Status::Playing) {
-                    obstacle.engineSound->stop();
-                }
-            }
-            
-            if (backgroundSprite) {
-                delete backgroundSprite;
-                backgroundSprite = nullptr;
-                backgroundLoaded = false;
-            }
-            
-            state = MENU;
-            gameInitialized = false;
-            levelTimersInitialized = false;
-            mPressed = true;                // Mark key as pressed
-        }
-    }
-    else {
-        mPressed = false;  // Reset when key released
-    }
-    
-    // Access settings menu (F1 key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::F1)) {
-        if (!f1Pressed) {  // Edge detection to prevent key repeat
-            extern GameState previousState;
-            previousState = PLAYING3;
-            state = SETTINGS;
-            f1Pressed = true;              // Mark key as pressed
-        }
-    }
-    else {
-        f1Pressed = false;  // Reset when key released
-    }
+//=== FACTORY ===
+unique_ptr<GameStateHandler> createPlayingState3(int trafficDensity) {
+    return make_unique<PlayingState3>(trafficDensity);
 }
\ No newline at end of file
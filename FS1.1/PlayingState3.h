@@ -1,13 +1,17 @@
 #pragma once
 #include <SFML/Graphics.hpp>
-#include "GameState.h"
+#include "GameStateHandler.h"
 #include <SFML/Audio.hpp>
 #include <random>
 #include <vector>
 #include <algorithm>
 #include <iostream>
+#include <memory>
 
 using namespace sf;
 using namespace std;
 
-void handlePlayingState3(RenderWindow& window, bool& running, GameState& state);
\ No newline at end of file
+// Creates the endless road state (Level 3).
+// trafficDensity > 1 is the traffic stress mode: that many times more obstacles, packed
+// across the whole window; collisions are counted instead of ending the run
+unique_ptr<GameStateHandler> createPlayingState3(int trafficDensity = 1);
\ No newline at end of file
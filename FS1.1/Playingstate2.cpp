@@ -1,4 +1,8 @@
 #include "Playingstate2.h"
+#include "ResourceManager.h"
+#include "Input.h"
+
+extern GameState previousState;  // Return target for the settings menu
 
 using namespace sf;
 using namespace std;
@@ -7,12 +11,8 @@ using namespace std;
 // Calculates optimal maze dimensions based on current display resolution
 // This ensures the maze scales appropriately for different screen sizes
 Vector2u getMazeDimensions() {
-    // Access global resolution settings
-    extern int resolutionIndex;            // Current resolution selection index
-    extern vector<Vector2u> resolutionOptions;  // Available resolution options
-    
-    // Retrieve selected resolution from settings
-    auto mazeSize = resolutionOptions[resolutionIndex];
+    // Retrieve selected resolution from the current settings snapshot
+    Vector2u mazeSize = settings.get()->getMazeResolution();
     
     // Convert screen resolution to maze cell count
     // Scaling factors determine maze complexity relative to screen size
@@ -27,161 +27,148 @@ Vector2u getMazeDimensions() {
     return Vector2u(mazeCellsX, mazeCellsY);
 }
 
-//=== MAIN GAME LOOP FUNCTION ===
+//=== LEVEL 2 STATE CLASS ===
 // Handles all logic and rendering for PlayingState2 (Level 2: Dark Maze)
 // Features smooth player movement and dynamic maze generation
-void handlePlayingState2(RenderWindow& window, bool& running, GameState& state)
-{
-    //=== DYNAMIC MAZE SIZING SYSTEM ===
-    // Track maze dimension changes to trigger regeneration when needed
-    static Vector2u lastMazeDims = getMazeDimensions();  // Previous frame's dimensions
-    Vector2u currentMazeDims = getMazeDimensions();      // Current frame's dimensions
-    
-    // Calculate cell size to fit maze optimally within window bounds
-    // Ensures maze uses available screen space efficiently
-    static int cellSize = min(window.getSize().x / currentMazeDims.x, window.getSize().y / currentMazeDims.y);
-    
-    //=== MAZE MANAGEMENT SYSTEM ===
-    // Static maze object maintains state between function calls
-    static Maze maze(currentMazeDims.x * cellSize, currentMazeDims.y * cellSize, cellSize);
-    static bool generated = false;     // Has maze been generated this session?
-    static Clock clock;               // Frame timing for smooth movement
-    extern bool mazeNeedsRegeneration; // External flag for settings-triggered regeneration
-    
-    //=== INPUT STATE TRACKING FOR EDGE DETECTION ===
-    // Static variables to track key press states and prevent key repeat
-    static bool mPressed = false;        // M key state
-    static bool f1Pressed = false;      // F1 key state
-    static bool enterPressed = false;   // ENTER key state
-    static bool hPressed = false;       // H key state (shortcut)
-    static bool escPressed = false;     // ESC key state (NEW)
-    
-    //=== MAZE REGENERATION LOGIC ===
-    // Recreate maze when resolution changes or settings request regeneration
-    if (mazeNeedsRegeneration || currentMazeDims.x != lastMazeDims.x || currentMazeDims.y != lastMazeDims.y) {
-        // Recalculate optimal cell size for new dimensions
-        cellSize = min(window.getSize().x / currentMazeDims.x, window.getSize().y / currentMazeDims.y);
+class PlayingState2 : public GameStateHandler {
+public:
+    //=== RESOURCE LIFECYCLE ===
+    void queueAssets(AssetLoader& loader) override {
+        loader.addTexture("Images/maze_background.jpg");  // Larger than a page and repeated
+        loader.addAtlasImage("Images/maze_wall.jpg");
+    }
+
+    void load(RenderWindow& window) override {
+        // Maze acquires its textures on construction (cache hits after the preload)
+        fitMaze(window);
+        maze.emplace(mazeDims.x * cellSize, mazeDims.y * cellSize, cellSize);
+        fontHandle = resources.acquireFont("arial.ttf");
         
-        // Safely resize existing maze instance with updated parameters
-        maze.resize(currentMazeDims.x * cellSize, currentMazeDims.y * cellSize, cellSize);
-        generated = true;             // Mark as generated
-        clock.restart();              // Reset timing
-        mazeNeedsRegeneration = false; // Clear regeneration flag
-        lastMazeDims = currentMazeDims; // Update dimension tracking
+        // Wall brightness follows the gamma setting; an applied maze size rebuilds on the next update
+        settingsSubscription = settings.subscribe(SETTING_GAMMA | SETTING_MAZE_SIZE,
+            [this](const SettingsSnapshot& current, uint32_t changed) {
+                if (changed & SETTING_GAMMA) maze->setWallGamma(current.gamma);
+                if (changed & SETTING_MAZE_SIZE) mazeNeedsRegeneration = true;
+            });
+    }
+
+    void unload() override {
+        settingsSubscription.reset();
+        maze.reset();  // Releases the maze textures
+        resources.release(fontHandle);
+    }
+
+    //=== ACTIVATION LIFECYCLE ===
+    // Every visit starts on a fresh maze with the player at the entrance
+    void enter(RenderWindow& window) override {
+        regenerate(window);
     }
+
+    //=== FRAME HOOKS ===
+    void update(RenderWindow& window, float deltaTime, GameState& state) override;
+    void draw(RenderWindow& window) override;
+
+private:
+    //=== MAZE MANAGEMENT SYSTEM ===
+    optional<Maze> maze;                 // Exists while the state is loaded
+    Vector2u mazeDims;                   // Cell counts the maze was built for
+    int cellSize = 1;                    // Pixel size of one cell
+    FontHandle fontHandle;               // Shared UI font
+    SettingsSubscription settingsSubscription;  // Gamma and maze size (while loaded)
+    bool mazeNeedsRegeneration = false;  // Maze size setting changed since the last build
     
-    //=== INITIAL MAZE GENERATION ===
-    // Generate maze on first run if not already created
-    if (!generated) {
-        maze.generate();    // Create maze layout
-        generated = true;   // Mark as generated
-        clock.restart();    // Initialize timing
+    // Calculate cell size to fit maze optimally within window bounds
+    void fitMaze(RenderWindow& window) {
+        mazeDims = getMazeDimensions();
+        cellSize = min(window.getSize().x / mazeDims.x, window.getSize().y / mazeDims.y);
     }
     
-    //=== FRAME TIMING SYSTEM ===
-    // Calculate time elapsed since last frame for smooth movement
-    float deltaTime = clock.restart().asSeconds();
+    // Rebuild the grid for the current resolution and generate a new layout
+    void regenerate(RenderWindow& window) {
+        fitMaze(window);
+        maze->resize(mazeDims.x * cellSize, mazeDims.y * cellSize, cellSize);
+        mazeNeedsRegeneration = false;   // Clear regeneration flag
+    }
+};
+
+//=== LEVEL 2 UPDATE ===
+void PlayingState2::update(RenderWindow& window, float deltaTime, GameState& state)
+{
+    //=== MAZE REGENERATION LOGIC ===
+    // Recreate maze when the maze size setting changed (flagged by the settings subscription)
+    if (mazeNeedsRegeneration) {
+        regenerate(window);
+    }
     
     //=== INPUT PROCESSING SYSTEM ===
     // Capture continuous input states for smooth player movement
     // Supports both WASD and arrow key layouts
-    bool up = Keyboard::isKeyPressed(Keyboard::Key::W) || Keyboard::isKeyPressed(Keyboard::Key::Up);
-    bool down = Keyboard::isKeyPressed(Keyboard::Key::S) || Keyboard::isKeyPressed(Keyboard::Key::Down);
-    bool left = Keyboard::isKeyPressed(Keyboard::Key::A) || Keyboard::isKeyPressed(Keyboard::Key::Left);
-    bool right = Keyboard::isKeyPressed(Keyboard::Key::D) || Keyboard::isKeyPressed(Keyboard::Key::Right);
+    bool up = input.isDown(Keyboard::Key::W) || input.isDown(Keyboard::Key::Up);
+    bool down = input.isDown(Keyboard::Key::S) || input.isDown(Keyboard::Key::Down);
+    bool left = input.isDown(Keyboard::Key::A) || input.isDown(Keyboard::Key::Left);
+    bool right = input.isDown(Keyboard::Key::D) || input.isDown(Keyboard::Key::Right);
     
     //=== PLAYER MOVEMENT SYSTEM ===
     // Update player position based on input and collision detection
     // Maze handles movement validation and wall collision internally
-    maze.updatePlayer(deltaTime, up, down, left, right);
-    
-    //=== RENDERING PIPELINE ===
-    window.clear(Color::Black);  // Clear screen with black background
-    maze.draw(window);           // Render maze walls and passages
-    maze.drawPlayer(window);     // Render player sprite/shape
-    
-    //=== UI AND WIN CONDITION SYSTEM ===
-    // Font loading for UI text display
-    static Font font;
-    static bool fontLoaded = false;
-    if (!fontLoaded) {
-        font.openFromFile("arial.ttf");  // Load standard font
-        fontLoaded = true;               // Mark as loaded
-    }
-    
-    // Display victory message when player reaches maze exit
-    if (maze.isAtExit()) {
-        Text winText(font, "You Win! Press ENTER for next level", 50);
-        winText.setFillColor(Color::Red);           // Red text for visibility
-        winText.setOutlineColor(Color::Black);      // Black outline for contrast
-        winText.setOutlineThickness(2.f);           // Outline thickness
-        
-        // Center text on screen
-        auto bounds = winText.getLocalBounds();
-        winText.setOrigin(Vector2f(bounds.size.x / 2.f, bounds.size.y / 2.f));
-        winText.setPosition(Vector2f(window.getSize().x / 2.f, window.getSize().y / 2.f));
-        
-        window.draw(winText);  // Render victory message
-    }
+    maze->updatePlayer(deltaTime, up, down, left, right);
     
     //=== NAVIGATION CONTROL SYSTEM ===
-    // Handle state transitions and menu navigation with proper edge detection
+    // Handle state transitions and menu navigation (pressed this frame, see Input.h)
     
-    // NEW: Return to pre-level screen (ESC key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::Escape)) {
-        if (!escPressed) {  // Edge detection to prevent key repeat
-            state = PRELEVEL2;     // Return to Level 2 pre-level screen
-            generated = false;     // Reset maze generation for restart
-            escPressed = true;     // Mark key as pressed
-        }
-    }
-    else {
-        escPressed = false;  // Reset when key released
+    // Return to pre-level screen (ESC key)
+    if (input.wasPressed(Keyboard::Key::Escape)) {
+        state = PRELEVEL2;         // Return to Level 2 pre-level screen
     }
     
     // Return to main menu (M key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::M)) {
-        if (!mPressed) {  // Edge detection to prevent key repeat
-            state = MENU;
-            mPressed = true;     // Mark key as pressed
-        }
-    }
-    else {
-        mPressed = false;  // Reset when key released
+    if (input.wasPressed(Keyboard::Key::M)) {
+        state = MENU;
     }
     
     // Access settings menu (F1 key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::F1)) {
-        if (!f1Pressed) {  // Edge detection to prevent key repeat
-            extern GameState previousState;
-            previousState = PLAYING2;  // Store current state for return
-            state = SETTINGS;          // Open settings menu
-            f1Pressed = true;          // Mark key as pressed
-        }
-    }
-    else {
-        f1Pressed = false;  // Reset when key released
+    if (input.wasPressed(Keyboard::Key::F1)) {
+        previousState = PLAYING2;  // Store current state for return
+        state = SETTINGS;          // Open settings menu
     }
     
     // Level progression - advance to next level when at exit (ENTER key)
-    if (maze.isAtExit() && Keyboard::isKeyPressed(Keyboard::Key::Enter)) {
-        if (!enterPressed) {  // Edge detection to prevent key repeat
-            state = PRELEVEL3;       // Go to pre-level screen before level 3
-            enterPressed = true;     // Mark key as pressed
-        }
-    }
-    else {
-        enterPressed = false;  // Reset when key released
+    if (maze->isAtExit() && input.wasPressed(Keyboard::Key::Enter)) {
+        state = PRELEVEL3;         // Go to pre-level screen before level 3
     }
     
     // Alternative progression method (shortcut H key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::H)) {
-        if (!hPressed) {  // Edge detection to prevent key repeat
-            state = PRELEVEL3;      // Also advance to pre-level screen
-            hPressed = true;        // Mark key as pressed
-        }
+    if (input.wasPressed(Keyboard::Key::H)) {
+        state = PRELEVEL3;         // Also advance to pre-level screen
     }
-    else {
-        hPressed = false;  // Reset when key released
+}
+
+//=== LEVEL 2 RENDERING ===
+void PlayingState2::draw(RenderWindow& window)
+{
+    //=== RENDERING PIPELINE ===
+    window.clear(Color::Black);  // Clear screen with black background
+    maze->draw(window);          // Render maze walls and passages
+    maze->drawPlayer(window);    // Render player sprite/shape
+    
+    //=== UI AND WIN CONDITION SYSTEM ===
+    // Display victory message when player reaches maze exit
+    if (maze->isAtExit()) {
+        Text winText(resources.get(fontHandle), "You Win! Press ENTER for next level", 50);
+        winText.setFillColor(Color::Red);           // Red text for visibility
+        winText.setOutlineColor(Color::Black);      // Black outline for contrast
+        winText.setOutlineThickness(2.f);           // Outline thickness
+        
+        // Center text on screen
+        auto bounds = winText.getLocalBounds();
+        winText.setOrigin(Vector2f(bounds.size.x / 2.f, bounds.size.y / 2.f));
+        winText.setPosition(Vector2f(window.getSize().x / 2.f, window.getSize().y / 2.f));
+        
+        window.draw(winText);  // Render victory message
     }
+}
+
+//=== FACTORY ===
+unique_ptr<GameStateHandler> createPlayingState2() {
+    return make_unique<PlayingState2>();
 }
\ No newline at end of file
@@ -1,11 +1,12 @@
 #pragma once
 #include <SFML/Graphics.hpp>
-#include "GameState.h"
+#include "GameStateHandler.h"
 #include "Maze.h"
 #include "SettingsState.h"
+#include <memory>
 
 using namespace sf;
 using namespace std;
 
-// Handles the main game loop and rendering for the maze game mode.
-void handlePlayingState2(RenderWindow& window, bool& running, GameState& state);
\ No newline at end of file
+// Creates the maze game mode state (Level 2: Dark Maze).
+unique_ptr<GameStateHandler> createPlayingState2();
\ No newline at end of file
@@ -1,47 +1,45 @@
 #include "PreLevelState.h"
 #include "NavigationSounds.h"
+#include "ResourceManager.h"
+#include "Input.h"
 
-//=== MAIN PRE-LEVEL STATE HANDLER ===
+extern GameState previousState;  // Return target for the settings menu
+
+//=== PRE-LEVEL STATE CLASS ===
 // Displays level introduction screen with controls and navigation options
 // Serves as transition between levels and provides player orientation
-void handlePreLevelState(RenderWindow& window, bool& running, GameState& currentState, GameState nextLevel)
-{
-    //=== PERSISTENT STATE VARIABLES ===
-    // Static variables maintain state between function calls
-    static Font font;              // Text rendering font
-    static bool fontLoaded = false; // Font loading status flag
-    
-    // Input state tracking to prevent key repeat issues
-    static bool enterPressed = false;  // ENTER key state
-    static bool mPressed = false;      // M key (menu) state  
-    static bool f1Pressed = false;     // F1 key (settings) state
-    static bool initialFrame = true;   // First frame detection flag
-    
-    //=== FONT INITIALIZATION ===
-    // One-time font loading for text rendering
-    if (!fontLoaded) {
-        font.openFromFile("arial.ttf");  // Load standard font
-        fontLoaded = true;               // Mark as successfully loaded
+// The level's assets decode in the background while the player reads the controls
+class PreLevelState : public GameStateHandler {
+public:
+    explicit PreLevelState(GameState nextLevel);
+
+    //=== RESOURCE LIFECYCLE ===
+    void load(RenderWindow& window) override {
+        fontHandle = resources.acquireFont("arial.ttf");  // Cache hit - already opened by main
     }
-    
-    //=== INPUT STATE INITIALIZATION ===
-    // Reset input states on first frame to prevent carried-over key presses
-    // This prevents immediate state transitions when entering from another level
-    if (initialFrame) {
-        enterPressed = Keyboard::isKeyPressed(Keyboard::Key::Enter); // Capture current state
-        mPressed = Keyboard::isKeyPressed(Keyboard::Key::M);         // Capture current state
-        f1Pressed = Keyboard::isKeyPressed(Keyboard::Key::F1);       // Capture current state
-        initialFrame = false;  // Mark initialization as complete
+
+    void unload() override {
+        resources.release(fontHandle);
     }
-    
-    //=== RENDERING SETUP ===
-    window.clear(Color::Black);  // Clear screen with black background
-    
-    //=== LEVEL-SPECIFIC CONTENT GENERATION ===
-    // Generate appropriate title and control instructions based on target level
+
+    //=== FRAME HOOKS ===
+    void update(RenderWindow& window, float deltaTime, GameState& state) override;
+    void draw(RenderWindow& window) override;
+
+    // Decode the level while this screen is shown
+    optional<GameState> getPreloadTarget() const override { return nextLevel; }
+
+private:
+    GameState nextLevel;                  // Level started with ENTER
+    FontHandle fontHandle;                // Shared text rendering font
     string levelTitle;                    // Display title for the level
     vector<string> controlInstructions;   // List of control instructions
-    
+};
+
+//=== LEVEL-SPECIFIC CONTENT GENERATION ===
+// Generate appropriate title and control instructions based on target level
+PreLevelState::PreLevelState(GameState nextLevel) : nextLevel(nextLevel)
+{
     // Configure content based on next level destination
     switch (nextLevel) {
     case PLAYING:  // Level 1: Text scrolling game
@@ -101,6 +99,39 @@ void handlePreLevelState(RenderWindow& window, bool& running, GameState& current
         };
         break;
     }
+}
+
+//=== PRE-LEVEL INPUT HANDLER ===
+// Process user input with sound effects and state transitions
+void PreLevelState::update(RenderWindow& window, float deltaTime, GameState& state)
+{
+    // Level start input (ENTER key)
+    // Keys still held on entry (e.g. ESC or Enter used to get here from the level) do not press
+    if (input.wasPressed(Keyboard::Key::Enter)) {
+        navSounds.playSelect();         // Play selection sound effect
+        state = nextLevel;              // Transition to target level (assets already preloaded)
+    }
+    
+    // Menu navigation input (M key)
+    if (input.wasPressed(Keyboard::Key::M)) {
+        navSounds.playBack();           // Play back navigation sound
+        state = MENU;                   // Return to main menu
+    }
+    
+    // Settings access input (F1 key)
+    if (input.wasPressed(Keyboard::Key::F1)) {
+        navSounds.playSelect();         // Play selection sound effect
+        previousState = state;          // Store current state for return
+        state = SETTINGS;               // Open settings menu
+    }
+}
+
+//=== PRE-LEVEL RENDERING ===
+void PreLevelState::draw(RenderWindow& window)
+{
+    const Font& font = resources.get(fontHandle);
+    
+    window.clear(Color::Black);  // Clear screen with black background
     
     //=== TITLE RENDERING ===
     // Create and display level title
@@ -156,48 +187,9 @@ void handlePreLevelState(RenderWindow& window, bool& running, GameState& current
     continueText.setOrigin(Vector2f(continueBounds.size.x / 2.f, continueBounds.size.y / 2.f));
     continueText.setPosition(Vector2f(window.getSize().x / 2.f, window.getSize().y * 0.85f));
     window.draw(continueText);
-    
-    //=== INPUT HANDLING SYSTEM ===
-    // Process user input with sound effects and state transitions
-    
-    // Level start input (ENTER key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::Enter)) {
-        if (!enterPressed) {  // Edge detection to prevent key repeat
-            navSounds.playSelect();     // Play selection sound effect
-            currentState = nextLevel;   // Transition to target level
-            enterPressed = true;        // Mark key as pressed
-            initialFrame = true;        // Reset for next state entry
-        }
-    }
-    else {
-        enterPressed = false;  // Reset when key released
-    }
-    
-    // Menu navigation input (M key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::M)) {
-        if (!mPressed) {  // Edge detection to prevent key repeat
-            navSounds.playBack();    // Play back navigation sound
-            currentState = MENU;     // Return to main menu
-            initialFrame = true;     // Reset for next state entry
-            mPressed = true;         // Mark key as pressed
-        }
-    }
-    else {
-        mPressed = false;  // Reset when key released
-    }
-    
-    // Settings access input (F1 key)
-    if (Keyboard::isKeyPressed(Keyboard::Key::F1)) {
-        if (!f1Pressed) {  // Edge detection to prevent key repeat
-            navSounds.playSelect();        // Play selection sound effect
-            extern GameState previousState;
-            previousState = currentState;  // Store current state for return
-            currentState = SETTINGS;       // Open settings menu
-            initialFrame = true;           // Reset for next state entry
-            f1Pressed = true;              // Mark key as pressed
-        }
-    }
-    else {
-        f1Pressed = false;  // Reset when key released
-    }
+}
+
+//=== FACTORY ===
+unique_ptr<GameStateHandler> createPreLevelState(GameState nextLevel) {
+    return make_unique<PreLevelState>(nextLevel);
 }
\ No newline at end of file
@@ -1,8 +1,12 @@
 #pragma once
 #include <SFML/Graphics.hpp>
-#include "GameState.h"
+#include <memory>
+#include "GameStateHandler.h"
 
 using namespace sf;
 using namespace std;
 
-void handlePreLevelState(RenderWindow& window, bool& running, GameState& currentState, GameState nextLevel);
\ No newline at end of file
+//=== PRE-LEVEL STATE FACTORY ===
+// Creates the introduction screen shown before nextLevel (PLAYING, PLAYING2 or PLAYING3)
+// While it is displayed the level's assets are preloaded in the background
+unique_ptr<GameStateHandler> createPreLevelState(GameState nextLevel);
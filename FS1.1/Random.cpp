@@ -0,0 +1,24 @@
+#include "Random.h"
+
+using namespace std;
+
+//=== CONSTRUCTOR ===
+// The only random_device read of the game: 64 bits of entropy for the master seed
+RandomService::RandomService() {
+    random_device device;
+    setMasterSeed((static_cast<uint64_t>(device()) << 32) | device());
+}
+
+//=== SEEDING ===
+
+// Every stream gets its own sequence (PCG stream id) and a seed scrambled from the master
+// seed (splitmix64), so nearby master seeds still start far apart
+void RandomService::setMasterSeed(uint64_t seed) {
+    masterSeed = seed;
+    for (size_t i = 0; i < static_cast<size_t>(RandomStream::Count); ++i) {
+        uint64_t mixed = seed + (i + 1) * 0x9e3779b97f4a7c15ULL;
+        mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+        streams[i].seed(mixed ^ (mixed >> 31), i);
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+using namespace std;
+
+//=== PCG32 GENERATOR ===
+// Small fast random generator (PCG-XSH-RR: 64-bit state, 32-bit output)
+// - 16 bytes of state and a multiply-add per number, versus mt19937's 5 KB state and
+//   costly seeding; good enough statistically for gameplay and effects
+// - Each stream id gives an independent sequence for the same seed
+// - Works with the standard distributions (uniform_int_distribution etc.)
+// Not thread safe: every thread or subsystem uses its own generator
+class Pcg32 {
+public:
+    using result_type = uint32_t;
+
+    explicit Pcg32(uint64_t seed = 0x853c49e6748fea9bULL, uint64_t stream = 0) { this->seed(seed, stream); }
+
+    void seed(uint64_t seed, uint64_t stream = 0) {
+        state = 0;
+        increment = (stream << 1) | 1u;  // Must be odd
+        (*this)();
+        state += seed;
+        (*this)();
+    }
+
+    result_type operator()() {
+        uint64_t old = state;
+        state = old * 6364136223846793005ULL + increment;
+        uint32_t shifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+        uint32_t rotation = static_cast<uint32_t>(old >> 59);
+        return (shifted >> rotation) | (shifted << ((0u - rotation) & 31));
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_MAX; }
+
+private:
+    uint64_t state = 0;
+    uint64_t increment = 1;
+};
+
+//=== RANDOM STREAMS ===
+// One generator per subsystem, so one subsystem drawing more numbers (a longer maze, more
+// particles) does not change what another one gets
+enum class RandomStream : uint32_t {
+    Maze,               // Level 2 layouts
+    LevelKeys,          // Level 1 exit key
+    Level3,             // Seeds Level 3 simulations (road and traffic)
+    Effects,            // Particles and other cosmetic randomness
+    Autopilot,          // Scripted driver of headless runs
+    Count
+};
+
+//=== RANDOM SERVICE CLASS DECLARATION ===
+// Owns the master seed and every subsystem's random stream
+// - The master seed comes from random_device once at startup, or from --seed on the command
+//   line; the same seed and the same inputs reproduce a run (and its benchmark numbers)
+// - stream() returns the subsystem's generator, which keeps running across calls: no
+//   per-call seeding, and a level entered twice gets a new layout
+// Main thread only; threads that need randomness take a seed from a stream and own a Pcg32
+class RandomService {
+public:
+    RandomService();
+
+    RandomService(const RandomService&) = delete;
+    RandomService& operator=(const RandomService&) = delete;
+
+    // Restart every stream from a new master seed
+    void setMasterSeed(uint64_t seed);
+    uint64_t getMasterSeed() const { return masterSeed; }
+
+    Pcg32& stream(RandomStream id) { return streams[static_cast<size_t>(id)]; }
+
+private:
+    uint64_t masterSeed = 0;
+    Pcg32 streams[static_cast<size_t>(RandomStream::Count)];
+};
+
+//=== GLOBAL INSTANCE DECLARATION ===
+// Defined in: FS1.1.cpp (seeded by main() when --seed is given)
+extern RandomService randomService;
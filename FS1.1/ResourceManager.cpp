@@ -0,0 +1,254 @@
+#include "ResourceManager.h"
+#include "AssetArchive.h"
+#include "DecodeCache.h"
+#include <filesystem>
+#include <iostream>
+
+using namespace sf;
+using namespace std;
+
+//=== GENERIC POOL OPERATIONS ===
+
+// Looks up an already resident asset by path and adds a reference to it
+// Returns: invalid handle if the path has not been loaded yet
+template <typename T>
+ResourceHandle<T> ResourceManager::findExisting(Pool<T>& pool, const string& path) {
+    auto it = pool.lookup.find(path);
+    if (it == pool.lookup.end()) {
+        return ResourceHandle<T>();
+    }
+
+    Entry<T>& entry = pool.entries[it->second];
+    entry.refCount++;  // New holder of the shared asset
+    return ResourceHandle<T>{ it->second, entry.generation };
+}
+
+// Stores a freshly loaded asset in a free (or new) slot with one reference
+template <typename T>
+ResourceHandle<T> ResourceManager::insert(Pool<T>& pool, const string& path, unique_ptr<T> resource, size_t bytes) {
+    uint32_t index;
+    if (!pool.freeSlots.empty()) {
+        index = pool.freeSlots.back();  // Recycle a released slot
+        pool.freeSlots.pop_back();
+    } else {
+        index = static_cast<uint32_t>(pool.entries.size());
+        pool.entries.emplace_back();
+    }
+
+    Entry<T>& entry = pool.entries[index];
+    entry.path = path;
+    entry.resource = std::move(resource);
+    entry.bytes = bytes;
+    entry.refCount = 1;
+    pool.lookup[path] = index;
+
+    return ResourceHandle<T>{ index, entry.generation };
+}
+
+// Drops one reference; frees the asset and recycles the slot on the last release
+template <typename T>
+void ResourceManager::releaseFrom(Pool<T>& pool, ResourceHandle<T>& handle) {
+    if (!resolve(pool, handle)) {
+        handle = ResourceHandle<T>();  // Stale or invalid handle - nothing to release
+        return;
+    }
+
+    Entry<T>& entry = pool.entries[handle.index];
+    if (--entry.refCount == 0) {
+        pool.lookup.erase(entry.path);
+        entry.resource.reset();      // Free the asset memory
+        entry.path.clear();
+        entry.bytes = 0;
+        entry.generation++;          // Invalidate any remaining copies of the handle
+        pool.freeSlots.push_back(handle.index);
+    }
+
+    handle = ResourceHandle<T>();
+}
+
+// Validates a handle against the pool (index range, generation and loaded state)
+template <typename T>
+const ResourceManager::Entry<T>* ResourceManager::resolve(const Pool<T>& pool, ResourceHandle<T> handle) const {
+    if (!handle.isValid() || handle.index >= pool.entries.size()) {
+        return nullptr;
+    }
+    const Entry<T>& entry = pool.entries[handle.index];
+    if (entry.generation != handle.generation || !entry.resource) {
+        return nullptr;
+    }
+    return &entry;
+}
+
+//=== ACQUISITION SYSTEM ===
+
+// Opens a font once and shares it; fonts stream glyphs from the file (or the mapped
+// archive) on demand, so the file size is used as the resident size estimate
+FontHandle ResourceManager::acquireFont(const string& path) {
+    FontHandle existing = findExisting(fonts, path);
+    if (existing.isValid()) {
+        return existing;
+    }
+
+    // Packed fonts are read in place from the archive mapping (no copy)
+    AssetView packed = assetArchive.find(path);
+    auto font = make_unique<Font>();
+    bool opened = packed ? font->openFromMemory(packed.data, packed.size) : font->openFromFile(path);
+    if (!opened) {
+        cerr << "Failed to load font " << path << endl;
+        return FontHandle();
+    }
+
+    error_code ec;
+    size_t bytes = packed ? packed.size : static_cast<size_t>(filesystem::file_size(path, ec));
+    return insert(fonts, path, std::move(font), ec ? 0 : bytes);
+}
+
+// Decodes an image file once into a GPU texture (RGBA8 = 4 bytes per pixel)
+// Pixels come from the decode cache when the source is unchanged since the last run
+TextureHandle ResourceManager::acquireTexture(const string& path) {
+    TextureHandle existing = findExisting(textures, path);
+    if (existing.isValid()) {
+        return existing;
+    }
+
+    Image image;
+    auto texture = make_unique<Texture>();
+    if (!decodeCache.loadImage(path, image) || !texture->loadFromImage(image)) {
+        cerr << "Failed to load texture " << path << endl;
+        return TextureHandle();
+    }
+
+    Vector2u size = texture->getSize();
+    size_t bytes = static_cast<size_t>(size.x) * size.y * 4;
+    return insert(textures, path, std::move(texture), bytes);
+}
+
+// Decodes an audio file once into 16-bit PCM samples
+SoundBufferHandle ResourceManager::acquireSoundBuffer(const string& path) {
+    SoundBufferHandle existing = findExisting(soundBuffers, path);
+    if (existing.isValid()) {
+        return existing;
+    }
+
+    auto buffer = make_unique<SoundBuffer>();
+    if (!decodeCache.loadSoundBuffer(path, *buffer)) {
+        cerr << "Failed to load sound " << path << endl;
+        return SoundBufferHandle();
+    }
+
+    size_t bytes = static_cast<size_t>(buffer->getSampleCount()) * sizeof(int16_t);
+    return insert(soundBuffers, path, std::move(buffer), bytes);
+}
+
+//=== ADOPTION SYSTEM ===
+
+// Uploads a pre-decoded image as a texture (GPU upload only, no file decode)
+TextureHandle ResourceManager::adoptTexture(const string& path, const Image& image) {
+    TextureHandle existing = findExisting(textures, path);
+    if (existing.isValid()) {
+        return existing;
+    }
+
+    auto texture = make_unique<Texture>();
+    if (!texture->loadFromImage(image)) {
+        cerr << "Failed to upload texture " << path << endl;
+        return TextureHandle();
+    }
+
+    Vector2u size = texture->getSize();
+    size_t bytes = static_cast<size_t>(size.x) * size.y * 4;
+    return insert(textures, path, std::move(texture), bytes);
+}
+
+// Takes ownership of a sound buffer decoded on another thread
+SoundBufferHandle ResourceManager::adoptSoundBuffer(const string& path, unique_ptr<SoundBuffer> buffer) {
+    SoundBufferHandle existing = findExisting(soundBuffers, path);
+    if (existing.isValid() || !buffer) {
+        return existing;
+    }
+
+    size_t bytes = static_cast<size_t>(buffer->getSampleCount()) * sizeof(int16_t);
+    return insert(soundBuffers, path, std::move(buffer), bytes);
+}
+
+//=== RELEASE SYSTEM ===
+
+void ResourceManager::release(FontHandle& handle) { releaseFrom(fonts, handle); }
+void ResourceManager::release(TextureHandle& handle) { releaseFrom(textures, handle); }
+void ResourceManager::release(SoundBufferHandle& handle) { releaseFrom(soundBuffers, handle); }
+
+//=== ACCESS SYSTEM ===
+
+Font& ResourceManager::get(FontHandle handle) {
+    const Entry<Font>* entry = resolve(fonts, handle);
+    return entry ? *entry->resource : fonts.fallback;
+}
+
+Texture& ResourceManager::get(TextureHandle handle) {
+    const Entry<Texture>* entry = resolve(textures, handle);
+    return entry ? *entry->resource : textures.fallback;
+}
+
+SoundBuffer& ResourceManager::get(SoundBufferHandle handle) {
+    const Entry<SoundBuffer>* entry = resolve(soundBuffers, handle);
+    return entry ? *entry->resource : soundBuffers.fallback;
+}
+
+bool ResourceManager::isLoaded(FontHandle handle) const { return resolve(fonts, handle) != nullptr; }
+bool ResourceManager::isLoaded(TextureHandle handle) const { return resolve(textures, handle) != nullptr; }
+bool ResourceManager::isLoaded(SoundBufferHandle handle) const { return resolve(soundBuffers, handle) != nullptr; }
+
+//=== STATISTICS SYSTEM ===
+
+size_t ResourceManager::getTotalBytes() const {
+    size_t total = 0;
+    for (const auto& entry : fonts.entries) total += entry.bytes;
+    for (const auto& entry : textures.entries) total += entry.bytes;
+    for (const auto& entry : soundBuffers.entries) total += entry.bytes;
+    return total;
+}
+
+size_t ResourceManager::getResourceCount() const {
+    return fonts.lookup.size() + textures.lookup.size() + soundBuffers.lookup.size();
+}
+
+uint32_t ResourceManager::getRefCount(FontHandle handle) const {
+    const Entry<Font>* entry = resolve(fonts, handle);
+    return entry ? entry->refCount : 0;
+}
+
+uint32_t ResourceManager::getRefCount(TextureHandle handle) const {
+    const Entry<Texture>* entry = resolve(textures, handle);
+    return entry ? entry->refCount : 0;
+}
+
+uint32_t ResourceManager::getRefCount(SoundBufferHandle handle) const {
+    const Entry<SoundBuffer>* entry = resolve(soundBuffers, handle);
+    return entry ? entry->refCount : 0;
+}
+
+void ResourceManager::printReport() const {
+    auto printPool = [](const char* type, const auto& pool) {
+        for (const auto& entry : pool.entries) {
+            if (entry.resource) {
+                cout << "  [" << type << "] " << entry.path << ": " << entry.bytes / 1024
+                     << " KB, refs=" << entry.refCount << endl;
+            }
+        }
+    };
+
+    cout << "Resident assets: " << getResourceCount() << " (" << getTotalBytes() / 1024 << " KB)" << endl;
+    printPool("font", fonts);
+    printPool("texture", textures);
+    printPool("sound", soundBuffers);
+}
+
+//=== MUSIC STREAMING ===
+
+// Music is streamed rather than cached: packed tracks decode straight from the mapped
+// archive pages, loose files are opened from disk
+// Safe on any thread: the archive mapping is read-only once opened
+bool openMusicStream(InputSoundFile& file, const string& path) {
+    AssetView packed = assetArchive.find(path);
+    return packed ? file.openFromMemory(packed.data, packed.size) : file.openFromFile(path);
+}
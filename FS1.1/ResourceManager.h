@@ -0,0 +1,135 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+//=== RESOURCE HANDLE ===
+// Lightweight reference to an asset owned by the ResourceManager
+// Handles are cheap to copy and never dangle: a stale handle (asset already evicted)
+// fails the generation check and resolves to an empty fallback object instead
+template <typename T>
+struct ResourceHandle {
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    uint32_t index = InvalidIndex;  // Slot in the manager's pool for this asset type
+    uint32_t generation = 0;        // Slot generation at acquisition time (detects reuse)
+
+    bool isValid() const { return index != InvalidIndex; }
+};
+
+using FontHandle = ResourceHandle<Font>;
+using TextureHandle = ResourceHandle<Texture>;
+using SoundBufferHandle = ResourceHandle<SoundBuffer>;
+
+//=== RESOURCE MANAGER CLASS DECLARATION ===
+// Central cache for all fonts, textures and sound buffers used by the game
+// - Each file path is loaded exactly once and shared by every state that acquires it
+// - Reference counting: an asset is freed as soon as its last holder releases it
+// - Per-asset byte size tracking for resident memory reporting
+// Assets are heap-allocated individually so their addresses stay stable while the pool
+// grows (Sprites and Texts keep raw pointers to their Texture/Font)
+class ResourceManager {
+public:
+    ResourceManager() = default;
+    ResourceManager(const ResourceManager&) = delete;
+    ResourceManager& operator=(const ResourceManager&) = delete;
+
+    //=== ACQUISITION SYSTEM ===
+    // Return a handle to the asset at the given path, loading it on first request
+    // Every successful call adds one reference that must be balanced by release()
+    // Returns: invalid handle if the file could not be loaded (error is logged)
+    FontHandle acquireFont(const string& path);
+    TextureHandle acquireTexture(const string& path);
+    SoundBufferHandle acquireSoundBuffer(const string& path);
+
+    //=== ADOPTION SYSTEM ===
+    // Register an asset that was decoded elsewhere (e.g. on a loader worker thread)
+    // Textures are uploaded to the GPU here, so these must be called from the main thread
+    // If the path is already resident the existing asset gains a reference instead
+    TextureHandle adoptTexture(const string& path, const Image& image);
+    SoundBufferHandle adoptSoundBuffer(const string& path, unique_ptr<SoundBuffer> buffer);
+
+    //=== RELEASE SYSTEM ===
+    // Drop one reference and reset the handle; the asset is freed when no references remain
+    // Releasing an invalid or stale handle is a no-op
+    void release(FontHandle& handle);
+    void release(TextureHandle& handle);
+    void release(SoundBufferHandle& handle);
+
+    //=== ACCESS SYSTEM ===
+    // Resolve a handle to the loaded asset
+    // Invalid or stale handles resolve to a default-constructed fallback object
+    Font& get(FontHandle handle);
+    Texture& get(TextureHandle handle);
+    SoundBuffer& get(SoundBufferHandle handle);
+
+    // Check whether a handle currently refers to a loaded asset
+    bool isLoaded(FontHandle handle) const;
+    bool isLoaded(TextureHandle handle) const;
+    bool isLoaded(SoundBufferHandle handle) const;
+
+    //=== STATISTICS SYSTEM ===
+    // Resident memory and usage figures for profiling and debugging
+    size_t getTotalBytes() const;      // Sum of the byte sizes of all resident assets
+    size_t getResourceCount() const;   // Number of resident assets across all types
+    uint32_t getRefCount(FontHandle handle) const;
+    uint32_t getRefCount(TextureHandle handle) const;
+    uint32_t getRefCount(SoundBufferHandle handle) const;
+
+    // Print one line per resident asset (path, size, references) to the console
+    void printReport() const;
+
+private:
+    //=== POOL STORAGE ===
+    // One entry per slot; empty slots are recycled through the free list
+    template <typename T>
+    struct Entry {
+        string path;                 // Source file path (cache key)
+        unique_ptr<T> resource;      // Loaded asset (null when the slot is free)
+        size_t bytes = 0;            // Approximate resident size of the asset
+        uint32_t refCount = 0;       // Number of outstanding handles
+        uint32_t generation = 0;     // Incremented each time the slot is freed
+    };
+
+    template <typename T>
+    struct Pool {
+        vector<Entry<T>> entries;                 // Slot storage indexed by handle.index
+        unordered_map<string, uint32_t> lookup;   // Path -> slot index for deduplication
+        vector<uint32_t> freeSlots;               // Recycled slot indices
+        T fallback;                               // Returned for invalid handles
+    };
+
+    Pool<Font> fonts;
+    Pool<Texture> textures;
+    Pool<SoundBuffer> soundBuffers;
+
+    //=== GENERIC POOL OPERATIONS ===
+    template <typename T>
+    ResourceHandle<T> insert(Pool<T>& pool, const string& path, unique_ptr<T> resource, size_t bytes);
+
+    template <typename T>
+    ResourceHandle<T> findExisting(Pool<T>& pool, const string& path);
+
+    template <typename T>
+    void releaseFrom(Pool<T>& pool, ResourceHandle<T>& handle);
+
+    template <typename T>
+    const Entry<T>* resolve(const Pool<T>& pool, ResourceHandle<T> handle) const;
+};
+
+//=== MUSIC STREAMING HELPER ===
+// Open a music decoder from the asset archive when packed, otherwise from the loose file
+// Music is not cached: each stream keeps its own decoder and reads on demand
+bool openMusicStream(InputSoundFile& file, const string& path);
+
+//=== GLOBAL INSTANCE DECLARATION ===
+// Defined in: FS1.1.cpp (before navSounds so that sound buffers outlive the UI sounds)
+// Thread Safety: Single-threaded access only
+extern ResourceManager resources;
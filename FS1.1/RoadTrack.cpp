@@ -0,0 +1,198 @@
+#include "RoadTrack.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace sf;
+using namespace std;
+
+//=== ROAD SHAPE TUNING ===
+static const int STRAIGHT_START_CONTROLS = 2;     // Straight spans after a reset (the player starts there)
+static const float MAX_CENTER_SHIFT = 100.0f;     // Largest sideways move between control points
+static const float MIN_WIDTH_SCALE = 0.8f;        // Width range relative to the nominal width
+static const float MAX_WIDTH_SCALE = 1.1f;
+static const float SCREEN_MARGIN = 40.0f;         // Grass kept visible beside the road
+
+//=== LANE MARKING TUNING ===
+static const float MARKING_WIDTH = 4.0f;          // Dash width (pixels)
+static const size_t DASH_SAMPLES = 2;             // Dash length in sample spacings (40px)
+static const size_t GAP_SAMPLES = 2;              // Gap between dashes in sample spacings
+
+// Catmull-Rom interpolation between p1 (t = 0) and p2 (t = 1)
+static float catmullRom(float p0, float p1, float p2, float p3, float t) {
+    float t2 = t * t;
+    float t3 = t2 * t;
+    return 0.5f * (2.0f * p1 + (p2 - p0) * t + (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 + (3.0f * p1 - p0 - 3.0f * p2 + p3) * t3);
+}
+
+//=== CONSTRUCTOR ===
+RoadTrack::RoadTrack(size_t capacity) : sampleCenters(capacity), sampleWidths(capacity) {}
+
+//=== STREAMING ===
+
+void RoadTrack::reset(float width, float roadWidth, float bottom) {
+    screenWidth = width;
+    nominalWidth = roadWidth;
+    firstSample = 0;
+    sampleCount = 0;
+    scrolled = bottom;  // Sample 0 starts at the bottom edge of the streamed area
+    controlCenters.fill(screenWidth / 2.0f);
+    controlWidths.fill(nominalWidth);
+    straightControls = STRAIGHT_START_CONTROLS;
+}
+
+void RoadTrack::scroll(float distance) {
+    scrolled += distance;
+}
+
+void RoadTrack::stream(float top, float bottom, Pcg32& gen) {
+    // Drop samples that left the screen (one stays below bottom so queries there interpolate)
+    while (sampleCount > 2 && sampleY(firstSample + 1) > bottom) {
+        firstSample++;
+        sampleCount--;
+    }
+
+    // Generate ahead of the camera until the newest sample is above top
+    size_t capacity = sampleCenters.size();
+    while (sampleCount < capacity && (sampleCount == 0 || sampleY(firstSample + sampleCount - 1) > top)) {
+        size_t sample = firstSample + sampleCount;
+        if (sample > 0 && sample % SAMPLES_PER_CONTROL == 0) {
+            addControlPoint(gen);  // Entering the next span
+        }
+        float t = static_cast<float>(sample % SAMPLES_PER_CONTROL) / SAMPLES_PER_CONTROL;
+        sampleCenters[sample % capacity] = catmullRom(controlCenters[0], controlCenters[1], controlCenters[2], controlCenters[3], t);
+        sampleWidths[sample % capacity] = catmullRom(controlWidths[0], controlWidths[1], controlWidths[2], controlWidths[3], t);
+        sampleCount++;
+    }
+}
+
+// Shift the spline window by one control point and place a new one at the far end
+void RoadTrack::addControlPoint(Pcg32& gen) {
+    for (int i = 0; i < 3; ++i) {
+        controlCenters[i] = controlCenters[i + 1];
+        controlWidths[i] = controlWidths[i + 1];
+    }
+
+    if (straightControls > 0) {
+        straightControls--;
+        controlCenters[3] = screenWidth / 2.0f;
+        controlWidths[3] = nominalWidth;
+        return;
+    }
+
+    uniform_real_distribution<float> widthDist(MIN_WIDTH_SCALE, MAX_WIDTH_SCALE);
+    uniform_real_distribution<float> shiftDist(-MAX_CENTER_SHIFT, MAX_CENTER_SHIFT);
+    float width = nominalWidth * widthDist(gen);
+    float lowest = SCREEN_MARGIN + width / 2.0f;
+    float highest = screenWidth - SCREEN_MARGIN - width / 2.0f;
+    float center = controlCenters[2] + shiftDist(gen);
+    controlCenters[3] = lowest < highest ? max(lowest, min(highest, center)) : screenWidth / 2.0f;
+    controlWidths[3] = width;
+}
+
+//=== QUERIES ===
+
+float RoadTrack::sampleY(size_t sample) const {
+    return static_cast<float>(scrolled - static_cast<double>(sample) * SAMPLE_SPACING);
+}
+
+void RoadTrack::sampleAt(float y, float& center, float& width) const {
+    if (sampleCount == 0) {
+        center = screenWidth / 2.0f;
+        width = nominalWidth;
+        return;
+    }
+
+    // Fractional absolute sample index, clamped to the streamed range
+    double position = (scrolled - y) / SAMPLE_SPACING;
+    double first = static_cast<double>(firstSample);
+    double last = static_cast<double>(firstSample + sampleCount - 1);
+    position = max(first, min(last, position));
+    size_t sample = min(static_cast<size_t>(position), firstSample + sampleCount - 1);
+    size_t next = min(sample + 1, firstSample + sampleCount - 1);
+    float t = static_cast<float>(position - static_cast<double>(sample));
+
+    size_t capacity = sampleCenters.size();
+    center = sampleCenters[sample % capacity] + (sampleCenters[next % capacity] - sampleCenters[sample % capacity]) * t;
+    width = sampleWidths[sample % capacity] + (sampleWidths[next % capacity] - sampleWidths[sample % capacity]) * t;
+}
+
+float RoadTrack::centerAt(float y) const {
+    float center, width;
+    sampleAt(y, center, width);
+    return center;
+}
+
+void RoadTrack::boundsAt(float y, float& left, float& right) const {
+    float center, width;
+    sampleAt(y, center, width);
+    left = center - width / 2.0f;
+    right = center + width / 2.0f;
+}
+
+//=== RENDERING ===
+
+void RoadTrack::buildMesh(VertexArray& strip, Color roadColor, Color wallColor, float wallWidth,
+                          int lanes, Color markingColor) const {
+    strip.setPrimitiveType(PrimitiveType::TriangleStrip);
+    strip.clear();
+    if (sampleCount < 2) return;
+
+    // Join runs with two repeated vertices: the triangles between them have no area
+    auto joinRun = [&strip](const Vertex& first) {
+        Vertex previous = strip[strip.getVertexCount() - 1];  // Copy: append may reallocate
+        strip.append(previous);
+        strip.append(first);
+    };
+
+    // Three bands across the road, drawn in turn: left wall, surface, right wall
+    const Color bandColors[] = { wallColor, roadColor, wallColor };
+    size_t capacity = sampleCenters.size();
+    for (size_t band = 0; band < 3; ++band) {
+        for (size_t i = 0; i < sampleCount; ++i) {
+            size_t sample = firstSample + i;
+            float halfWidth = sampleWidths[sample % capacity] / 2.0f;
+            float left = sampleCenters[sample % capacity] - halfWidth;
+            float right = sampleCenters[sample % capacity] + halfWidth;
+            float y = sampleY(sample);
+            float fromX = band == 0 ? left - wallWidth : (band == 1 ? left : right);
+            float toX = band == 0 ? left : (band == 1 ? right : right + wallWidth);
+            Vertex from{ Vector2f(fromX, y), bandColors[band] };
+            Vertex to{ Vector2f(toX, y), bandColors[band] };
+
+            if (i == 0 && band > 0) {
+                joinRun(from);
+            }
+            strip.append(from);
+            strip.append(to);
+        }
+    }
+
+    //=== LANE MARKINGS ===
+    // One dash per DASH_SAMPLES + GAP_SAMPLES samples on each lane boundary, following the
+    // curve; dashes belong to absolute samples, so they scroll with the road
+    size_t last = firstSample + sampleCount - 1;
+    for (int boundary = 1; boundary < lanes; ++boundary) {
+        float across = static_cast<float>(boundary) / lanes - 0.5f;  // Of the width, from the center
+        size_t start = firstSample;
+        while (start < last) {
+            size_t phase = start % (DASH_SAMPLES + GAP_SAMPLES);
+            if (phase >= DASH_SAMPLES) {
+                start += DASH_SAMPLES + GAP_SAMPLES - phase;  // Inside a gap: skip to the next dash
+                continue;
+            }
+            size_t end = min(start + DASH_SAMPLES - phase, last);
+            for (size_t sample = start; sample <= end; ++sample) {
+                float x = sampleCenters[sample % capacity] + sampleWidths[sample % capacity] * across;
+                float y = sampleY(sample);
+                Vertex from{ Vector2f(x - MARKING_WIDTH / 2.0f, y), markingColor };
+                Vertex to{ Vector2f(x + MARKING_WIDTH / 2.0f, y), markingColor };
+                if (sample == start) {
+                    joinRun(from);
+                }
+                strip.append(from);
+                strip.append(to);
+            }
+            start = end + GAP_SAMPLES;
+        }
+    }
+}
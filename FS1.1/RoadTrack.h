@@ -0,0 +1,65 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "Random.h"
+
+using namespace sf;
+using namespace std;
+
+//=== ROAD TRACK CLASS DECLARATION ===
+// Level 3's procedural road, streamed ahead of the camera
+// - The road is a Catmull-Rom spline through random control points (center and width) placed
+//   every CONTROL_SPACING pixels of road; it is sampled every SAMPLE_SPACING pixels
+// - Samples live in a fixed-capacity ring buffer: scrolling moves no data, samples that left
+//   the bottom of the screen are dropped and new ones are generated above the top
+// - Queries take screen y and interpolate between the two nearest samples
+// Nothing allocates after the constructor
+class RoadTrack {
+public:
+    static constexpr float SAMPLE_SPACING = 20.0f;      // Road length between samples (pixels)
+    static constexpr int SAMPLES_PER_CONTROL = 20;      // Samples per spline span
+    static constexpr float CONTROL_SPACING = SAMPLE_SPACING * SAMPLES_PER_CONTROL;
+
+    // capacity: samples held at once; must cover the streamed height / SAMPLE_SPACING
+    explicit RoadTrack(size_t capacity);
+
+    //=== STREAMING ===
+    // Start a new road: straight and centered for the first spans, nominal width on average
+    void reset(float screenWidth, float nominalWidth, float bottom);
+    // Move the road down the screen by distance pixels
+    void scroll(float distance);
+    // Drop samples below bottom and generate samples up to top (top < bottom, screen y)
+    void stream(float top, float bottom, Pcg32& gen);
+
+    //=== QUERIES (screen y) ===
+    float centerAt(float y) const;
+    void boundsAt(float y, float& left, float& right) const;    // Road edges, walls excluded
+
+    //=== RENDERING ===
+    // Road surface, both walls and dashed markings between lanes (lanes < 2: none) as one
+    // triangle strip (bands and dashes joined by degenerate triangles), written into strip
+    // without reallocating once it reached its size
+    void buildMesh(VertexArray& strip, Color roadColor, Color wallColor, float wallWidth,
+                   int lanes, Color markingColor) const;
+
+private:
+    float sampleY(size_t sample) const;                 // Screen y of an absolute sample index
+    void sampleAt(float y, float& center, float& width) const;
+    void addControlPoint(Pcg32& gen);
+
+    //=== SAMPLE RING ===
+    vector<float> sampleCenters;        // Indexed by absolute sample % capacity
+    vector<float> sampleWidths;
+    size_t firstSample = 0;             // Absolute index of the oldest sample
+    size_t sampleCount = 0;
+    double scrolled = 0.0;              // Screen y of sample 0 (double: runs last for hours)
+
+    //=== SPLINE ===
+    array<float, 4> controlCenters{};   // Span being sampled is [1] -> [2]
+    array<float, 4> controlWidths{};
+    int straightControls = 0;           // Control points still placed on the straight start
+    float screenWidth = 0.0f;
+    float nominalWidth = 0.0f;
+};
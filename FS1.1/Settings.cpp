@@ -0,0 +1,109 @@
+#include "Settings.h"
+#include <algorithm>
+#include <iterator>
+
+using namespace sf;
+using namespace std;
+
+//=== SETTING OPTION TABLES ===
+int framerateOptions[] = { 30, 60, 120, 144, 240 };  // Available framerate options for text speed
+const int framerateOptionCount = static_cast<int>(size(framerateOptions));
+
+// Available maze size options (repurposed from resolution settings)
+// Each resolution corresponds to a different maze complexity level
+vector<Vector2u> resolutionOptions = {
+    {1280, 720},                        // Small maze size
+    {1600, 900},                        // Medium-small maze size
+    {1920, 1080},                       // Medium maze size (default)
+    {2560, 1440},                       // Large maze size
+    {3840, 2160}                        // Extra large maze size
+};
+
+//=== SNAPSHOT COMPARISON ===
+uint32_t SettingsSnapshot::diff(const SettingsSnapshot& other) const {
+    uint32_t changed = 0;
+    if (vsyncEnabled != other.vsyncEnabled) changed |= SETTING_VSYNC;
+    if (framerateIndex != other.framerateIndex) changed |= SETTING_FRAMERATE;
+    if (gamma != other.gamma) changed |= SETTING_GAMMA;
+    if (resolutionIndex != other.resolutionIndex) changed |= SETTING_MAZE_SIZE_CHOICE;
+    if (appliedResolutionIndex != other.appliedResolutionIndex) changed |= SETTING_MAZE_SIZE;
+    if (musicVolume != other.musicVolume) changed |= SETTING_MUSIC_VOLUME;
+    return changed;
+}
+
+//=== SUBSCRIPTION HANDLE ===
+
+SettingsSubscription::SettingsSubscription(SettingsSubscription&& other) noexcept
+    : store(other.store), id(other.id) {
+    other.store = nullptr;
+    other.id = 0;
+}
+
+SettingsSubscription& SettingsSubscription::operator=(SettingsSubscription&& other) noexcept {
+    if (this != &other) {
+        reset();
+        store = other.store;
+        id = other.id;
+        other.store = nullptr;
+        other.id = 0;
+    }
+    return *this;
+}
+
+void SettingsSubscription::reset() {
+    if (store) {
+        store->unsubscribe(id);
+    }
+    store = nullptr;
+    id = 0;
+}
+
+//=== SETTINGS STORE ===
+
+// Version 1 holds the defaults
+SettingsStore::SettingsStore() {
+    SettingsSnapshot defaults;
+    defaults.version = 1;
+    atomic_store(&current, shared_ptr<const SettingsSnapshot>(make_shared<SettingsSnapshot>(defaults)));
+    version.store(1);
+}
+
+uint32_t SettingsStore::publish(const SettingsSnapshot& edited) {
+    shared_ptr<const SettingsSnapshot> previous = get();
+    uint32_t changed = edited.diff(*previous);
+    if (changed == 0) {
+        return 0;
+    }
+
+    auto next = make_shared<SettingsSnapshot>(edited);
+    next->version = previous->version + 1;
+    shared_ptr<const SettingsSnapshot> published = next;
+    atomic_store(&current, published);
+    version.store(published->version, memory_order_release);
+
+    //=== NOTIFICATION ===
+    // Iterate over a copy: a listener may subscribe or unsubscribe while being notified
+    // (the alive flag skips subscribers removed by an earlier listener of this publish)
+    vector<Subscriber> notified = subscribers;
+    for (const Subscriber& subscriber : notified) {
+        if ((subscriber.fields & changed) && *subscriber.alive) {
+            subscriber.listener(*published, subscriber.fields & changed);
+        }
+    }
+    return changed;
+}
+
+SettingsSubscription SettingsStore::subscribe(uint32_t fields, Listener listener) {
+    uint32_t id = nextSubscriberId++;
+    subscribers.push_back({ id, fields, listener, make_shared<bool>(true) });
+    listener(*get(), fields);
+    return SettingsSubscription(this, id);
+}
+
+void SettingsStore::unsubscribe(uint32_t id) {
+    for (Subscriber& subscriber : subscribers) {
+        if (subscriber.id == id) *subscriber.alive = false;
+    }
+    subscribers.erase(remove_if(subscribers.begin(), subscribers.end(),
+        [id](const Subscriber& subscriber) { return subscriber.id == id; }), subscribers.end());
+}
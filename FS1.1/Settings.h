@@ -0,0 +1,132 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+//=== SETTING OPTION TABLES ===
+// Constant choices the settings menu cycles through (defined in Settings.cpp)
+extern int framerateOptions[];              // Available framerate options for text speed calculation
+extern const int framerateOptionCount;
+extern vector<Vector2u> resolutionOptions;  // Available maze size options (width x height)
+
+//=== SETTING FIELDS ===
+// Bit flags naming the values of a snapshot, used for subscriptions and change masks
+enum SettingField : uint32_t {
+    SETTING_VSYNC = 1u << 0,
+    SETTING_FRAMERATE = 1u << 1,
+    SETTING_GAMMA = 1u << 2,
+    SETTING_MAZE_SIZE = 1u << 3,            // Applied maze size (changes on "Apply Changes")
+    SETTING_MUSIC_VOLUME = 1u << 4,
+    SETTING_MAZE_SIZE_CHOICE = 1u << 5,     // Maze size selected in the menu, not applied yet
+    SETTING_ALL = (1u << 6) - 1
+};
+
+//=== SETTINGS SNAPSHOT ===
+// One immutable set of user settings; a change publishes a new snapshot with a higher version
+struct SettingsSnapshot {
+    uint64_t version = 0;           // Assigned by SettingsStore::publish
+
+    //=== PERFORMANCE SETTINGS ===
+    bool vsyncEnabled = true;       // Vertical sync (applied by "Apply Changes")
+    int framerateIndex = 4;         // Index into framerateOptions (default 240)
+
+    //=== VISUAL SETTINGS ===
+    float gamma = 0.0f;             // Maze wall brightness (0.0f = invisible, 2.0f = full brightness)
+
+    //=== MAZE CONFIGURATION SETTINGS ===
+    int resolutionIndex = 2;        // Menu choice, index into resolutionOptions (default 1920x1080 equivalent)
+    int appliedResolutionIndex = 2; // Maze size in effect; "Apply Changes" copies the choice here
+
+    //=== AUDIO SETTINGS ===
+    float musicVolume = 40.0f;      // Music and sound volume (0.0f to 100.0f)
+
+    int getFramerate() const { return framerateOptions[framerateIndex]; }
+    Vector2u getMazeResolution() const { return resolutionOptions[appliedResolutionIndex]; }
+    Vector2u getMazeResolutionChoice() const { return resolutionOptions[resolutionIndex]; }
+
+    // Fields whose values differ from another snapshot (version excluded)
+    uint32_t diff(const SettingsSnapshot& other) const;
+};
+
+class SettingsStore;
+
+//=== SETTINGS SUBSCRIPTION ===
+// Keeps a listener registered for as long as it lives (move-only, unsubscribes on destruction)
+class SettingsSubscription {
+public:
+    SettingsSubscription() = default;
+    SettingsSubscription(SettingsSubscription&& other) noexcept;
+    SettingsSubscription& operator=(SettingsSubscription&& other) noexcept;
+    ~SettingsSubscription() { reset(); }
+
+    SettingsSubscription(const SettingsSubscription&) = delete;
+    SettingsSubscription& operator=(const SettingsSubscription&) = delete;
+
+    void reset();
+
+private:
+    friend class SettingsStore;
+    SettingsSubscription(SettingsStore* store, uint32_t id) : store(store), id(id) {}
+
+    SettingsStore* store = nullptr;
+    uint32_t id = 0;
+};
+
+//=== SETTINGS STORE CLASS DECLARATION ===
+// Owns the current settings snapshot and notifies subscribers when values change
+// - get() returns a shared immutable snapshot; it is safe on any thread (audio, workers),
+//   and a snapshot stays valid for as long as the caller holds it
+// - getVersion() is a cheap change check for code that cannot subscribe (worker threads)
+// - publish() and subscriptions are main-thread only; listeners run inside publish() and
+//   only for the fields they subscribed to
+// - A listener unsubscribed during a publish (by another listener) is not called afterwards
+class SettingsStore {
+public:
+    using Listener = function<void(const SettingsSnapshot& settings, uint32_t changedFields)>;
+
+    SettingsStore();
+
+    SettingsStore(const SettingsStore&) = delete;
+    SettingsStore& operator=(const SettingsStore&) = delete;
+
+    //=== READ ACCESS (any thread) ===
+    shared_ptr<const SettingsSnapshot> get() const { return atomic_load(&current); }
+    uint64_t getVersion() const { return version.load(memory_order_acquire); }
+
+    //=== CHANGES (main thread) ===
+    // Publish an edited copy of the current snapshot
+    // Returns: the changed fields (0 if nothing changed; no new version is published then)
+    uint32_t publish(const SettingsSnapshot& edited);
+
+    // Register a listener for the given fields; it is called once right away with the
+    // current snapshot (changedFields = fields) so subscribers initialize on the same path
+    [[nodiscard]] SettingsSubscription subscribe(uint32_t fields, Listener listener);
+
+private:
+    friend class SettingsSubscription;
+
+    //=== SUBSCRIBER STRUCTURE ===
+    struct Subscriber {
+        uint32_t id;
+        uint32_t fields;
+        Listener listener;
+        shared_ptr<bool> alive;         // Cleared by unsubscribe (seen by a publish in progress)
+    };
+
+    shared_ptr<const SettingsSnapshot> current;  // Replaced atomically (atomic_load/atomic_store)
+    atomic<uint64_t> version{ 0 };
+    vector<Subscriber> subscribers;
+    uint32_t nextSubscriberId = 1;
+
+    void unsubscribe(uint32_t id);
+};
+
+//=== GLOBAL INSTANCE DECLARATION ===
+// Defined in FS1.1.cpp before every subsystem that subscribes to it
+extern SettingsStore settings;
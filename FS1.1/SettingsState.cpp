@@ -1,147 +1,92 @@
 #include "SettingsState.h"
 #include "NavigationSounds.h"
+#include "ResourceManager.h"
+#include "Input.h"
+
+extern GameState previousState;  // Return target when exiting settings
 
 using namespace sf;
 using namespace std;
 
-//=== GLOBAL SETTINGS VARIABLES DEFINITIONS ===
-// Global settings variables that persist throughout application lifetime
-// These control various aspects of gameplay, performance, and user experience
-
-//=== PERFORMANCE CONFIGURATION ===
-int framerateIndex = 4;                 // Default to 240
-int framerateOptions[] = { 30, 60, 120, 144, 240 };  // Available framerate options for text speed
-bool vsyncEnabled = true;               // Vertical sync enabled by default for smooth rendering
-
-//=== VISUAL CONFIGURATION ===
-float gamma = 0.0f;                     // Maze wall brightness (0.0f = invisible, 2.0f = full brightness)
-
-//=== MAZE SIZE CONFIGURATION ===
-int resolutionIndex = 2;                // Default to 1920x1080 equivalent maze size (index 2)
-float musicVolume = 40.0f;              // Default music volume at 40% (0-100 range)
-
-// Available maze size options (repurposed from resolution settings)
-// Each resolution corresponds to a different maze complexity level
-vector<Vector2u> resolutionOptions = {
-    {1280, 720},                        // Small maze size
-    {1600, 900},                        // Medium-small maze size
-    {1920, 1080},                       // Medium maze size (default)
-    {2560, 1440},                       // Large maze size
-    {3840, 2160}                        // Extra large maze size
-};
-
 //=== STATE FLAGS ===
-bool mazeNeedsRegeneration = false;     // Flag to trigger maze regeneration
 bool settingsChanged = false;           // Flag indicating settings have been modified
 
 //=== SETTINGS APPLICATION SYSTEM ===
 // Applies all pending settings changes to the application systems
 // Handles window properties, maze regeneration, and other system updates
-void applySettings(RenderWindow& window) {
-    // Static variables to track previous settings for change detection
-    static int lastResolutionIndex = resolutionIndex;
-    static bool lastVsyncEnabled = vsyncEnabled;
-
-    //=== MAZE SIZE CHANGE DETECTION ===
-    // Check if maze size setting has changed since last application
-    bool mazeSizeChanged = (resolutionIndex != lastResolutionIndex);
-
-    if (mazeSizeChanged) {
-        // Trigger maze regeneration without changing window size
-        // The maze system will pick up this flag and regenerate accordingly
-        mazeNeedsRegeneration = true;
-        lastResolutionIndex = resolutionIndex;  // Update tracking variable
-    }
+void applySettings(RenderWindow& window, SettingsSnapshot& edited) {
+    // Static variable to track the previously applied value for change detection
+    static bool lastVsyncEnabled = edited.vsyncEnabled;
+
+    //=== MAZE SIZE APPLICATION ===
+    // The maze subscribes to the applied size: publishing it regenerates Level 2's maze
+    edited.appliedResolutionIndex = edited.resolutionIndex;
 
     //=== VSYNC SETTING APPLICATION ===
     // Apply VSync setting only if it has changed (avoids unnecessary API calls)
-    if (vsyncEnabled != lastVsyncEnabled) {
-        window.setVerticalSyncEnabled(vsyncEnabled);  // Apply VSync to window
-        lastVsyncEnabled = vsyncEnabled;              // Update tracking variable
+    if (edited.vsyncEnabled != lastVsyncEnabled) {
+        window.setVerticalSyncEnabled(edited.vsyncEnabled);  // Apply VSync to window
+        lastVsyncEnabled = edited.vsyncEnabled;              // Update tracking variable
     }
 
-    // Note: Framerate setting is not applied to window directly
-    // It's used for text speed calculation in PlayingState instead
-    
-    // Note: Music volume is applied directly in main loop when music changes
-    // This allows for real-time volume adjustment without settings application
+    // Note: Framerate, wall visibility and volume are not applied here
+    // Their subscribers (text speed, maze walls, audio) react as soon as a new snapshot is published
 
     settingsChanged = true;  // Mark that settings have been processed
 }
 
-//=== MAIN SETTINGS MENU HANDLER ===
+//=== MENU STRUCTURE DEFINITION ===
+// Define all available settings options in display order
+static const vector<string> options = { 
+    "VSync: ",           // Toggle vertical synchronization
+    "Text Speed: ",      // Adjust text scrolling speed via framerate
+    "Wall Visibility: ", // Control maze wall brightness
+    "Maze Size: ",       // Select maze complexity/size
+    "Volume: ",          // Adjust music and sound volume
+    "Apply Changes",     // Apply all pending settings
+    "Back"              // Return to previous menu
+};
+
+//=== SETTINGS STATE CLASS ===
 // Handles the complete settings menu interface including rendering and input processing
 // Provides comprehensive control over all game settings with visual and audio feedback
-void handleSettingsState(RenderWindow& window, bool& running, GameState& state)
-{
-    //=== MENU STATE VARIABLES ===
-    // Static variables maintain menu state between function calls
-    static int selected = 0;           // Currently selected menu item index
-    static int previousSelected = -1;  // Previous selection for hover sound detection
-    static bool initialized = false;   // **NEW: Initialization flag to prevent flashing**
-    
-    // Input state tracking to prevent key repeat issues
-    static bool upPressed = false, downPressed = false;           // Vertical navigation
-    static bool leftPressed = false, rightPressed = false;       // Horizontal value adjustment
-    static bool enterPressed = false, escapePressed = false;     // Confirmation and cancellation
-    static bool mouseLeftPressed = false, mouseRightPressed = false;  // Mouse interaction
-
-    //=== EXTERNAL STATE ACCESS ===
-    extern GameState previousState;  // Access to return state when exiting settings
-
-    //=== INITIALIZATION ===
-    // **NEW: One-time setup when entering the state**
-    if (!initialized) {
-        // Reset input states to prevent carried-over key presses from previous state
-        upPressed = Keyboard::isKeyPressed(Keyboard::Key::W);
-        downPressed = Keyboard::isKeyPressed(Keyboard::Key::S);
-        leftPressed = Keyboard::isKeyPressed(Keyboard::Key::A);
-        rightPressed = Keyboard::isKeyPressed(Keyboard::Key::D);
-        enterPressed = Keyboard::isKeyPressed(Keyboard::Key::Enter);
-        escapePressed = Keyboard::isKeyPressed(Keyboard::Key::Escape);
-        mouseLeftPressed = Mouse::isButtonPressed(Mouse::Button::Left);
-        mouseRightPressed = Mouse::isButtonPressed(Mouse::Button::Right);
-        
+// Runs as an overlay: the state that opened it stays loaded and resumes when it closes
+class SettingsState : public GameStateHandler {
+public:
+    //=== RESOURCE LIFECYCLE ===
+    // A failed load yields an invalid handle, which resolves to an empty fallback font
+    void load(RenderWindow& window) override {
+        fontHandle = resources.acquireFont("arial.ttf");  // Cache hit - already opened by main
+    }
+
+    void unload() override {
+        resources.release(fontHandle);
+    }
+
+    //=== ACTIVATION LIFECYCLE ===
+    void enter(RenderWindow& window) override {
         // Reset selection to first item for consistency
         selected = 0;
-        previousSelected = -1;
-        
-        initialized = true;
     }
 
-    //=== MENU STRUCTURE DEFINITION ===
-    // Define all available settings options in display order
-    const vector<string> options = { 
-        "VSync: ",           // Toggle vertical synchronization
-        "Text Speed: ",      // Adjust text scrolling speed via framerate
-        "Wall Visibility: ", // Control maze wall brightness
-        "Maze Size: ",       // Select maze complexity/size
-        "Volume: ",          // Adjust music and sound volume
-        "Apply Changes",     // Apply all pending settings
-        "Back"              // Return to previous menu
-    };
-
-    //=== FONT SYSTEM INITIALIZATION ===
-    // One-time font loading for settings menu text
-    static Font font;
-    static bool fontLoaded = false;
-    if (!fontLoaded) {
-        if (font.openFromFile("arial.ttf")) {  // **IMPROVED: Check if font loading succeeded**
-            fontLoaded = true;               // Mark as loaded only on success
-        } else {
-            // Fallback: try to use default font or handle gracefully
-            font = Font();  // Use default font if available
-            fontLoaded = true;  // Still mark as loaded to prevent repeated attempts
-        }
-    }
+    //=== FRAME HOOKS ===
+    void update(RenderWindow& window, float deltaTime, GameState& state) override;
+    void draw(RenderWindow& window) override;
 
-    //=== RENDERING PREPARATION ===
-    // **IMPROVED: Clear with same background as other states for consistency**
-    window.clear(Color::Black);  // Clear screen with black background
+private:
+    //=== MENU STATE VARIABLES ===
+    FontHandle fontHandle;        // Shared menu font
+    int selected = 0;             // Currently selected menu item index
+
+    // Builds the option texts with current values (used for hover tests and rendering)
+    vector<Text> buildOptionTexts(const Font& font) const;
+};
 
-    //=== MENU TEXT RENDERING SYSTEM ===
-    // Store text objects for mouse interaction detection
+//=== MENU TEXT SYSTEM ===
+vector<Text> SettingsState::buildOptionTexts(const Font& font) const
+{
     vector<Text> textObjects;
+    shared_ptr<const SettingsSnapshot> current = settings.get();
 
     // Render each menu option with current values and appropriate styling
     for (size_t i = 0; i < options.size(); ++i) {
@@ -155,39 +100,55 @@ void handleSettingsState(RenderWindow& window, bool& running, GameState& state)
         // Update text content based on current setting values
         if (i == 0) {
             // VSync setting display
-            text.setString(options[i] + (vsyncEnabled ? "On" : "Off"));
+            text.setString(options[i] + (current->vsyncEnabled ? "On" : "Off"));
         }
         else if (i == 1) {
             // Text speed (framerate) setting display
-            text.setString(options[i] + to_string(framerateOptions[framerateIndex]));
+            text.setString(options[i] + to_string(current->getFramerate()));
         }
         else if (i == 2) {
             // Wall visibility (gamma) setting display as percentage
-            int gammaPercent = static_cast<int>((gamma / 2.0f) * 100.0f);
+            int gammaPercent = static_cast<int>((current->gamma / 2.0f) * 100.0f);
             text.setString(options[i] + to_string(gammaPercent) + "%");
         }
         else if (i == 3) {
             // Maze size setting display
-            text.setString(options[i] + to_string(resolutionOptions[resolutionIndex].x) + 
-                          "x" + to_string(resolutionOptions[resolutionIndex].y));
+            Vector2u mazeResolution = current->getMazeResolutionChoice();
+            text.setString(options[i] + to_string(mazeResolution.x) + 
+                          "x" + to_string(mazeResolution.y));
         }
         else if (i == 4) {
             // Music volume setting display as percentage
-            int volumePercent = static_cast<int>(musicVolume);
+            int volumePercent = static_cast<int>(current->musicVolume);
             text.setString(options[i] + to_string(volumePercent) + "%");
         }
         // Options 5 (Apply Changes) and 6 (Back) use their default text
 
-        textObjects.push_back(text);  // Store for mouse interaction
-        window.draw(text);            // Render to screen
+        textObjects.push_back(text);  // Store for mouse interaction and rendering
     }
 
+    return textObjects;
+}
+
+//=== SETTINGS UPDATE ===
+void SettingsState::update(RenderWindow& window, float deltaTime, GameState& state)
+{
+    //=== SETTINGS EDIT COPY ===
+    // Input edits a copy of the current snapshot; it is published once at the end of the
+    // frame, and subscribers are only notified about the values that actually changed
+    SettingsSnapshot edited = *settings.get();
+    bool& vsyncEnabled = edited.vsyncEnabled;
+    int& framerateIndex = edited.framerateIndex;
+    float& gamma = edited.gamma;
+    int& resolutionIndex = edited.resolutionIndex;
+    float& musicVolume = edited.musicVolume;
+
     //=== MOUSE INTERACTION SYSTEM ===
     // Handle mouse hover detection for menu selection with audio feedback
-    Vector2i mousePosition = Mouse::getPosition(window);
-    Vector2f mousePos = window.mapPixelToCoords(mousePosition);
+    Vector2f mousePos = window.mapPixelToCoords(input.getMousePosition());
 
     // Check if mouse is hovering over any menu item
+    vector<Text> textObjects = buildOptionTexts(resources.get(fontHandle));
     for (size_t i = 0; i < textObjects.size(); ++i) {
         if (textObjects[i].getGlobalBounds().contains(mousePos)) {
             if (selected != static_cast<int>(i)) {
@@ -200,12 +161,7 @@ void handleSettingsState(RenderWindow& window, bool& running, GameState& state)
 
     //=== MOUSE CLICK HANDLING SYSTEM ===
     // Process left mouse button clicks for setting adjustments and navigation
-    bool isMouseLeftButtonPressed = Mouse::isButtonPressed(Mouse::Button::Left);
-    bool isMouseRightButtonPressed = Mouse::isButtonPressed(Mouse::Button::Right);
-
-    if (isMouseLeftButtonPressed && !mouseLeftPressed) {
-        mouseLeftPressed = true;  // Mark button as pressed
-
+    if (input.wasPressed(Mouse::Button::Left)) {
         //=== LEFT CLICK ACTIONS ===
         // Handle left click actions for each menu item
         if (selected == 0) {
@@ -215,7 +171,7 @@ void handleSettingsState(RenderWindow& window, bool& running, GameState& state)
         }
         else if (selected == 1) {
             // Increase framerate setting with boundary checking
-            if (framerateIndex < static_cast<int>(size(framerateOptions)) - 1) {
+            if (framerateIndex < framerateOptionCount - 1) {
                 framerateIndex++;
                 navSounds.playSelect();
             } else {
@@ -251,25 +207,19 @@ void handleSettingsState(RenderWindow& window, bool& running, GameState& state)
         }
         else if (selected == 5) {
             // Apply all settings changes
-            applySettings(window);
+            applySettings(window, edited);
             navSounds.playSelect();
         }
         else if (selected == 6) {
             // Return to previous menu
             navSounds.playBack();
             state = previousState;
-            initialized = false;  // **NEW: Reset for potential re-entry**
         }
     }
-    else if (!isMouseLeftButtonPressed) {
-        mouseLeftPressed = false;  // Reset when button released
-    }
 
     //=== RIGHT CLICK HANDLING SYSTEM ===
     // Process right mouse button clicks for decreasing values
-    if (isMouseRightButtonPressed && !mouseRightPressed) {
-        mouseRightPressed = true;  // Mark button as pressed
-
+    if (input.wasPressed(Mouse::Button::Right)) {
         //=== RIGHT CLICK ACTIONS ===
         // Handle right click actions for decreasing setting values
         if (selected == 1) {
@@ -309,160 +259,146 @@ void handleSettingsState(RenderWindow& window, bool& running, GameState& state)
             }
         }
     }
-    else if (!isMouseRightButtonPressed) {
-        mouseRightPressed = false;  // Reset when button released
-    }
 
     //=== KEYBOARD NAVIGATION SYSTEM ===
     // Handle keyboard input for menu navigation with sound feedback
     
     // W key - Move selection up
-    if (Keyboard::isKeyPressed(Keyboard::Key::W)) {
-        if (!upPressed) {  // Edge detection to prevent key repeat
-            selected = (selected - 1 + static_cast<int>(options.size())) % static_cast<int>(options.size());
-            navSounds.playHover();  // Play hover sound for navigation
-            upPressed = true;       // Mark key as pressed
-        }
+    if (input.wasPressed(Keyboard::Key::W)) {
+        selected = (selected - 1 + static_cast<int>(options.size())) % static_cast<int>(options.size());
+        navSounds.playHover();  // Play hover sound for navigation
     }
-    else upPressed = false;  // Reset when key released
 
     // S key - Move selection down
-    if (Keyboard::isKeyPressed(Keyboard::Key::S)) {
-        if (!downPressed) {  // Edge detection to prevent key repeat
-            selected = (selected + 1) % static_cast<int>(options.size());
-            navSounds.playHover();  // Play hover sound for navigation
-            downPressed = true;     // Mark key as pressed
-        }
+    if (input.wasPressed(Keyboard::Key::S)) {
+        selected = (selected + 1) % static_cast<int>(options.size());
+        navSounds.playHover();  // Play hover sound for navigation
     }
-    else downPressed = false;  // Reset when key released
 
     //=== KEYBOARD VALUE ADJUSTMENT SYSTEM ===
     // A key - Decrease values (left direction)
-    if (Keyboard::isKeyPressed(Keyboard::Key::A)) {
-        if (!leftPressed) {  // Edge detection to prevent key repeat
-            //=== DECREASE VALUE LOGIC ===
-            if (selected == 1 && framerateIndex > 0) {
-                // Decrease framerate
-                framerateIndex--;
+    if (input.wasPressed(Keyboard::Key::A)) {
+        //=== DECREASE VALUE LOGIC ===
+        if (selected == 1 && framerateIndex > 0) {
+            // Decrease framerate
+            framerateIndex--;
+            navSounds.playSelect();
+        }
+        else if (selected == 2) {
+            // Decrease gamma (wall visibility)
+            if (gamma > 0.0f) {
+                gamma -= 0.1f;
+                if (gamma < 0.0f) gamma = 0.0f;
                 navSounds.playSelect();
+            } else {
+                navSounds.playError();  // Already at minimum
             }
-            else if (selected == 2) {
-                // Decrease gamma (wall visibility)
-                if (gamma > 0.0f) {
-                    gamma -= 0.1f;
-                    if (gamma < 0.0f) gamma = 0.0f;
-                    navSounds.playSelect();
-                } else {
-                    navSounds.playError();  // Already at minimum
-                }
-            }
-            else if (selected == 3) {
-                // Cycle backwards through maze sizes
-                resolutionIndex--;
-                if (resolutionIndex < 0) 
-                    resolutionIndex = static_cast<int>(size(resolutionOptions)) - 1;
+        }
+        else if (selected == 3) {
+            // Cycle backwards through maze sizes
+            resolutionIndex--;
+            if (resolutionIndex < 0) 
+                resolutionIndex = static_cast<int>(size(resolutionOptions)) - 1;
+            navSounds.playSelect();
+        }
+        else if (selected == 4) {
+            // Decrease music volume
+            if (musicVolume > 0.0f) {
+                musicVolume -= 10.0f;
+                if (musicVolume < 0.0f) musicVolume = 0.0f;
                 navSounds.playSelect();
+            } else {
+                navSounds.playError();  // Already at minimum
             }
-            else if (selected == 4) {
-                // Decrease music volume
-                if (musicVolume > 0.0f) {
-                    musicVolume -= 10.0f;
-                    if (musicVolume < 0.0f) musicVolume = 0.0f;
-                    navSounds.playSelect();
-                } else {
-                    navSounds.playError();  // Already at minimum
-                }
-            }
-            else if (selected == 1 && framerateIndex <= 0) {
-                navSounds.playError(); // Can't decrease framerate further
-            }
-            leftPressed = true;  // Mark key as pressed
+        }
+        else if (selected == 1 && framerateIndex <= 0) {
+            navSounds.playError(); // Can't decrease framerate further
         }
     }
-    else leftPressed = false;  // Reset when key released
 
     // D key - Increase values (right direction)
-    if (Keyboard::isKeyPressed(Keyboard::Key::D)) {
-        if (!rightPressed) {  // Edge detection to prevent key repeat
-            //=== INCREASE VALUE LOGIC ===
-            if (selected == 1 && framerateIndex < static_cast<int>(size(framerateOptions)) - 1) {
-                // Increase framerate
-                framerateIndex++;
+    if (input.wasPressed(Keyboard::Key::D)) {
+        //=== INCREASE VALUE LOGIC ===
+        if (selected == 1 && framerateIndex < framerateOptionCount - 1) {
+            // Increase framerate
+            framerateIndex++;
+            navSounds.playSelect();
+        }
+        else if (selected == 2) {
+            // Increase gamma (wall visibility)
+            if (gamma < 2.0f) {
+                gamma += 0.1f;
+                if (gamma > 2.0f) gamma = 2.0f;
                 navSounds.playSelect();
+            } else {
+                navSounds.playError();  // Already at maximum
             }
-            else if (selected == 2) {
-                // Increase gamma (wall visibility)
-                if (gamma < 2.0f) {
-                    gamma += 0.1f;
-                    if (gamma > 2.0f) gamma = 2.0f;
-                    navSounds.playSelect();
-                } else {
-                    navSounds.playError();  // Already at maximum
-                }
-            }
-            else if (selected == 3) {
-                // Cycle forward through maze sizes
-                resolutionIndex++;
-                if (resolutionIndex >= static_cast<int>(size(resolutionOptions))) 
-                    resolutionIndex = 0;
+        }
+        else if (selected == 3) {
+            // Cycle forward through maze sizes
+            resolutionIndex++;
+            if (resolutionIndex >= static_cast<int>(size(resolutionOptions))) 
+                resolutionIndex = 0;
+            navSounds.playSelect();
+        }
+        else if (selected == 4) {
+            // Increase music volume
+            if (musicVolume < 100.0f) {
+                musicVolume += 10.0f;
+                if (musicVolume > 100.0f) musicVolume = 100.0f;
                 navSounds.playSelect();
+            } else {
+                navSounds.playError();  // Already at maximum
             }
-            else if (selected == 4) {
-                // Increase music volume
-                if (musicVolume < 100.0f) {
-                    musicVolume += 10.0f;
-                    if (musicVolume > 100.0f) musicVolume = 100.0f;
-                    navSounds.playSelect();
-                } else {
-                    navSounds.playError();  // Already at maximum
-                }
-            }
-            else if (selected == 1 && framerateIndex >= static_cast<int>(size(framerateOptions)) - 1) {
-                navSounds.playError(); // Can't increase framerate further
-            }
-            rightPressed = true;  // Mark key as pressed
+        }
+        else if (selected == 1 && framerateIndex >= framerateOptionCount - 1) {
+            navSounds.playError(); // Can't increase framerate further
         }
     }
-    else rightPressed = false;  // Reset when key released
 
     //=== KEYBOARD CONFIRMATION SYSTEM ===
     // ENTER key - Activate selected menu item
-    if (Keyboard::isKeyPressed(Keyboard::Key::Enter)) {
-        if (!enterPressed) {  // Edge detection to prevent key repeat
-            if (selected == 0) {
-                // Toggle VSync setting
-                vsyncEnabled = !vsyncEnabled;
-                navSounds.playSelect();
-            }
-            else if (selected == 5) {
-                // Apply all settings changes
-                applySettings(window);
-                navSounds.playSelect();
-            }
-            else if (selected == 6) {
-                // Return to previous menu
-                navSounds.playBack();
-                state = previousState;
-                initialized = false;  // **NEW: Reset for potential re-entry**
-            }
-            enterPressed = true;  // Mark key as pressed
+    if (input.wasPressed(Keyboard::Key::Enter)) {
+        if (selected == 0) {
+            // Toggle VSync setting
+            vsyncEnabled = !vsyncEnabled;
+            navSounds.playSelect();
+        }
+        else if (selected == 5) {
+            // Apply all settings changes
+            applySettings(window, edited);
+            navSounds.playSelect();
+        }
+        else if (selected == 6) {
+            // Return to previous menu
+            navSounds.playBack();
+            state = previousState;
         }
     }
-    else enterPressed = false;  // Reset when key released
 
     //=== KEYBOARD CANCELLATION SYSTEM ===
     // ESCAPE key - Return to previous menu
-    if (Keyboard::isKeyPressed(Keyboard::Key::Escape)) {
-        if (!escapePressed) {  // Edge detection to prevent key repeat
-            navSounds.playBack();       // Play back navigation sound
-            state = previousState;      // Return to calling state
-            initialized = false;        // **NEW: Reset for potential re-entry**
-            escapePressed = true;       // Mark key as pressed
-        }
+    if (input.wasPressed(Keyboard::Key::Escape)) {
+        navSounds.playBack();       // Play back navigation sound
+        state = previousState;      // Return to calling state
+    }
+
+    //=== SETTINGS PUBLICATION ===
+    settings.publish(edited);
+}
+
+//=== SETTINGS RENDERING ===
+void SettingsState::draw(RenderWindow& window)
+{
+    // Clear with same background as other states for consistency
+    window.clear(Color::Black);
+
+    for (const Text& text : buildOptionTexts(resources.get(fontHandle))) {
+        window.draw(text);
     }
-    else escapePressed = false;  // Reset when key released
+}
 
-    //=== FRAME PRESENTATION ===
-    // **MOVED: Display at the end after all rendering is complete**
-    window.display();  // Present completed settings menu frame
+//=== FACTORY ===
+unique_ptr<GameStateHandler> createSettingsState() {
+    return make_unique<SettingsState>();
 }
\ No newline at end of file
@@ -1,44 +1,30 @@
 #pragma once
 #include <SFML/Graphics.hpp>
-#include "GameState.h"
+#include "GameStateHandler.h"
+#include "Settings.h"
+#include <memory>
+#include <vector>
 
 using namespace sf;
 using namespace std;
 
-//=== GLOBAL SETTINGS DECLARATIONS ===
-// External declarations for global settings variables
-// These variables are defined in SettingsState.cpp and used throughout the application
-
-//=== PERFORMANCE SETTINGS ===
-extern int framerateIndex;              // Index into framerateOptions array
-extern int framerateOptions[];          // Available framerate options for text speed calculation
-extern bool vsyncEnabled;               // Vertical sync setting for smooth rendering
-
-//=== VISUAL SETTINGS ===
-extern float gamma;                     // Fake gamma value controlling wall brightness in maze (0.0f-2.0f)
-
-//=== MAZE CONFIGURATION SETTINGS ===
-extern int resolutionIndex;             // Index for maze size selection (repurposed from resolution)
-extern vector<Vector2u> resolutionOptions;  // Available maze size options (width x height in cells)
-extern bool mazeNeedsRegeneration;      // Flag indicating maze should be regenerated
+//=== SETTINGS ACCESS ===
+// Setting values live in immutable snapshots owned by the global SettingsStore (Settings.h)
+// Read them with settings.get(), or subscribe to react only when a value changes
 
 //=== SYSTEM STATE TRACKING ===
 extern bool settingsChanged;            // Flag indicating settings have been modified
 
-//=== AUDIO SETTINGS ===
-extern float musicVolume;               // Music and sound volume setting (0.0f to 100.0f)
-
 //=== FUNCTION DECLARATIONS ===
 
-// Main settings menu handler - processes input and renders settings interface
-// Parameters:
-//   window - SFML render window for drawing UI
-//   running - application running state (for potential exit conditions)
-//   state - current game state (modified when exiting settings)
-void handleSettingsState(RenderWindow& window, bool& running, GameState& state);
+// Creates the settings menu state
+// Input and rendering only; the main loop presents the frame
+unique_ptr<GameStateHandler> createSettingsState();
 
 // Applies all pending settings changes to the application
 // Parameters:
 //   window - SFML render window for applying window-related settings
-// Note: This function handles VSync, maze regeneration, and other system changes
-void applySettings(RenderWindow& window);
\ No newline at end of file
+//   edited - the menu's snapshot copy; the maze size choice becomes the applied size in it
+// Note: Only VSync and maze size wait for this; every other setting takes effect through
+// its subscribers as soon as it is published
+void applySettings(RenderWindow& window, SettingsSnapshot& edited);
\ No newline at end of file
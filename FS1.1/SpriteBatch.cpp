@@ -0,0 +1,84 @@
+#include "SpriteBatch.h"
+#include <algorithm>
+
+using namespace sf;
+using namespace std;
+
+//=== CONSTRUCTOR ===
+SpriteBatch::SpriteBatch(size_t quadCapacity) {
+    vertices.reserve(quadCapacity * 6);
+}
+
+//=== PASS ===
+
+void SpriteBatch::begin(RenderTarget& renderTarget) {
+    target = &renderTarget;
+    texture = nullptr;
+    vertices.clear();
+    coveredArea = 0.0f;
+    current = SpriteBatchStats();
+}
+
+void SpriteBatch::end() {
+    flush();
+    Vector2u size = target->getSize();
+    float targetArea = static_cast<float>(size.x) * static_cast<float>(size.y);
+    current.overdraw = targetArea > 0.0f ? coveredArea / targetArea : 0.0f;
+    stats = current;
+    target = nullptr;
+}
+
+// One draw for every pending quad
+void SpriteBatch::flush() {
+    if (vertices.empty()) return;
+    size_t quads = vertices.size() / 6;
+    RenderStates states;
+    states.texture = texture;
+    target->draw(vertices.data(), vertices.size(), PrimitiveType::Triangles, states);
+    current.drawCalls++;
+    current.largestBatch = max(current.largestBatch, quads);
+    vertices.clear();
+}
+
+//=== SUBMISSION ===
+
+void SpriteBatch::draw(const Texture& quadTexture, const IntRect& rect, Vector2f position, Vector2f origin, Vector2f scale) {
+    if (texture != &quadTexture) {
+        flush();
+        texture = &quadTexture;
+    }
+    float left = position.x - origin.x * scale.x;
+    float top = position.y - origin.y * scale.y;
+    addQuad(left, top, left + rect.size.x * scale.x, top + rect.size.y * scale.y, rect, Color::White);
+}
+
+void SpriteBatch::drawRect(Vector2f position, Vector2f size, Vector2f origin, Color color) {
+    if (texture != nullptr) {
+        flush();
+        texture = nullptr;
+    }
+    float left = position.x - origin.x;
+    float top = position.y - origin.y;
+    addQuad(left, top, left + size.x, top + size.y, IntRect(), color);
+}
+
+void SpriteBatch::addQuad(float left, float top, float right, float bottom, const IntRect& rect, Color color) {
+    float u0 = static_cast<float>(rect.position.x);
+    float v0 = static_cast<float>(rect.position.y);
+    float u1 = u0 + rect.size.x;
+    float v1 = v0 + rect.size.y;
+    Vertex topLeft{ Vector2f(left, top), color, Vector2f(u0, v0) };
+    Vertex topRight{ Vector2f(right, top), color, Vector2f(u1, v0) };
+    Vertex bottomLeft{ Vector2f(left, bottom), color, Vector2f(u0, v1) };
+    Vertex bottomRight{ Vector2f(right, bottom), color, Vector2f(u1, v1) };
+
+    vertices.push_back(topLeft);
+    vertices.push_back(topRight);
+    vertices.push_back(bottomLeft);
+    vertices.push_back(bottomLeft);
+    vertices.push_back(topRight);
+    vertices.push_back(bottomRight);
+
+    current.quads++;
+    coveredArea += (right - left) * (bottom - top);
+}
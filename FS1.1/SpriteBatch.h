@@ -0,0 +1,54 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+//=== SPRITE BATCH STATISTICS ===
+// Counters for one begin()/end() pass
+struct SpriteBatchStats {
+    size_t quads = 0;               // Quads submitted
+    size_t drawCalls = 0;           // Draws issued (one per texture run)
+    size_t largestBatch = 0;        // Most quads in one draw
+    float overdraw = 0.0f;          // Quad pixels per target pixel (0.1 = a tenth of the screen covered once)
+};
+
+//=== SPRITE BATCH CLASS DECLARATION ===
+// Gathers quads into one vertex array and draws them together
+// - Quads that share a texture (or are all untextured) become a single draw call; switching
+//   texture flushes the pending quads, so draw order is kept exactly
+// - No transforms or rotation: a quad is a texture rect scaled around its origin, which is
+//   all Level 3 cars need, and it keeps submitting a quad to a few float operations
+// - The vertex storage is reserved up front and reused every frame
+// Usage: begin(target), draw/drawRect per quad, end()
+class SpriteBatch {
+public:
+    explicit SpriteBatch(size_t quadCapacity);
+
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+    void begin(RenderTarget& target);
+    void end();                             // Flush and close the statistics
+
+    // Texture rect at position, scaled around origin (origin in texture pixels, like Sprite)
+    void draw(const Texture& texture, const IntRect& rect, Vector2f position, Vector2f origin, Vector2f scale);
+    // Untextured rectangle at position (origin in pixels, like RectangleShape)
+    void drawRect(Vector2f position, Vector2f size, Vector2f origin, Color color);
+
+    // Statistics of the last completed pass
+    const SpriteBatchStats& getStats() const { return stats; }
+
+private:
+    void flush();
+    void addQuad(float left, float top, float right, float bottom, const IntRect& rect, Color color);
+
+    vector<Vertex> vertices;                // Pending quads, six vertices each (two triangles)
+    const Texture* texture = nullptr;       // Texture of the pending quads (nullptr: untextured)
+    RenderTarget* target = nullptr;         // Set between begin() and end()
+    float coveredArea = 0.0f;
+    SpriteBatchStats current;               // Pass in progress
+    SpriteBatchStats stats;                 // Last completed pass
+};
@@ -0,0 +1,77 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+//=== SINGLE-PRODUCER / SINGLE-CONSUMER QUEUE ===
+// Fixed-capacity lock-free ring buffer for passing small trivially copyable items between
+// exactly two threads (one only pushes, the other only pops)
+// - push() and pop() never block and never allocate
+// - Head and tail live on separate cache lines so the two threads do not false-share
+// - Bulk write()/read() move runs of items (e.g. audio samples) with one synchronization
+// Capacity must be a power of two; storage is allocated once, on the heap
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    SpscQueue() : slots(Capacity) {}
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer thread: returns false (item not queued) when the queue is full
+    bool push(const T& item) {
+        size_t tailIndex = tail.load(memory_order_relaxed);
+        if (tailIndex - head.load(memory_order_acquire) == Capacity) {
+            return false;
+        }
+        slots[tailIndex & (Capacity - 1)] = item;
+        tail.store(tailIndex + 1, memory_order_release);
+        return true;
+    }
+
+    // Consumer thread: returns false when the queue is empty
+    bool pop(T& item) {
+        size_t headIndex = head.load(memory_order_relaxed);
+        if (headIndex == tail.load(memory_order_acquire)) {
+            return false;
+        }
+        item = slots[headIndex & (Capacity - 1)];
+        head.store(headIndex + 1, memory_order_release);
+        return true;
+    }
+
+    // Producer thread: queue as many items as fit, returns how many were queued
+    size_t write(const T* items, size_t count) {
+        size_t tailIndex = tail.load(memory_order_relaxed);
+        count = min(count, Capacity - (tailIndex - head.load(memory_order_acquire)));
+        for (size_t i = 0; i < count; ++i) {
+            slots[(tailIndex + i) & (Capacity - 1)] = items[i];
+        }
+        tail.store(tailIndex + count, memory_order_release);
+        return count;
+    }
+
+    // Consumer thread: take up to count items, returns how many were taken
+    size_t read(T* items, size_t count) {
+        size_t headIndex = head.load(memory_order_relaxed);
+        count = min(count, tail.load(memory_order_acquire) - headIndex);
+        for (size_t i = 0; i < count; ++i) {
+            items[i] = slots[(headIndex + i) & (Capacity - 1)];
+        }
+        head.store(headIndex + count, memory_order_release);
+        return count;
+    }
+
+    // Approximate when called while the other thread is active
+    size_t size() const { return tail.load(memory_order_acquire) - head.load(memory_order_acquire); }
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    alignas(64) atomic<size_t> head{ 0 };   // Next slot to pop (written by the consumer)
+    alignas(64) atomic<size_t> tail{ 0 };   // Next slot to push (written by the producer)
+    vector<T> slots;
+};
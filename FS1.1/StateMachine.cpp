@@ -0,0 +1,136 @@
+#include "StateMachine.h"
+
+using namespace sf;
+using namespace std;
+
+//=== SETUP ===
+
+void StateMachine::registerState(GameState id, unique_ptr<GameStateHandler> handler) {
+    handlers[static_cast<size_t>(id)] = std::move(handler);
+}
+
+void StateMachine::start(GameState initial, RenderWindow& window) {
+    current = initial;
+    activate(initial, window);
+    updatePreload();
+}
+
+//=== FRAME HOOKS ===
+
+void StateMachine::update(RenderWindow& window, float deltaTime) {
+    // Register assets the preload workers finished since the last frame (main thread)
+    if (preloader) {
+        preloader->update();
+    }
+
+    GameStateHandler* handler = handlerFor(current);
+    if (!handler) {
+        return;
+    }
+
+    GameState requested = current;
+    handler->update(window, deltaTime, requested);
+    if (requested != current) {
+        changeState(requested, window);
+    }
+}
+
+void StateMachine::draw(RenderWindow& window) {
+    if (GameStateHandler* handler = handlerFor(current)) {
+        handler->draw(window);
+    }
+}
+
+//=== TRANSITION SYSTEM ===
+
+void StateMachine::changeState(GameState next, RenderWindow& window) {
+    GameState previous = current;
+
+    //=== SETTINGS OVERLAY ===
+    // Opening settings pauses the current state without exiting or unloading it
+    if (next == SETTINGS) {
+        overlaidState = previous;
+        current = next;
+        activate(next, window);
+        return;
+    }
+
+    if (GameStateHandler* handler = handlerFor(previous)) {
+        handler->exit();
+    }
+
+    if (previous == SETTINGS) {
+        if (next == overlaidState) {
+            // Resume the paused state exactly where it was
+            current = next;
+            unloadInactive();
+            return;
+        }
+        // Settings closed to a different state - the paused state ends as well
+        if (GameStateHandler* paused = handlerFor(overlaidState)) {
+            paused->exit();
+        }
+    }
+
+    //=== REGULAR TRANSITION ===
+    current = next;
+    activate(next, window);
+    unloadInactive();
+    updatePreload();
+}
+
+// Loads the state if needed (finishing its preload first) and enters it
+void StateMachine::activate(GameState id, RenderWindow& window) {
+    GameStateHandler* handler = handlerFor(id);
+    if (!handler) {
+        return;
+    }
+
+    size_t index = static_cast<size_t>(id);
+    if (!loaded[index]) {
+        if (preloader && preloadTarget == id) {
+            preloader->finish();  // Normally already complete; blocks only if the player was faster
+        }
+        handler->load(window);
+        loaded[index] = true;
+    }
+    handler->enter(window);
+}
+
+// Releases every state that is not active, paused under the settings overlay, or the
+// active state's preload target (returning from a level to its pre-level screen keeps it)
+void StateMachine::unloadInactive() {
+    GameStateHandler* handler = handlerFor(current);
+    optional<GameState> target = handler ? handler->getPreloadTarget() : nullopt;
+
+    for (size_t index = 0; index < StateCount; ++index) {
+        GameState id = static_cast<GameState>(index);
+        bool keep = id == current || (current == SETTINGS && id == overlaidState) || (target && id == *target);
+        if (loaded[index] && !keep) {
+            handlers[index]->unload();
+            loaded[index] = false;
+        }
+    }
+}
+
+// Starts decoding the active state's preload target, or drops a preload that is no longer needed
+// Destroying the loader releases its references, so abandoned preloads free their memory
+void StateMachine::updatePreload() {
+    GameStateHandler* handler = handlerFor(current);
+    optional<GameState> target = handler ? handler->getPreloadTarget() : nullopt;
+
+    if (!target || loaded[static_cast<size_t>(*target)] || !handlerFor(*target)) {
+        preloader.reset();
+        preloadTarget = EXIT;
+        return;
+    }
+
+    if (preloader && preloadTarget == *target) {
+        return;  // Already decoding
+    }
+
+    preloader = make_unique<AssetLoader>();
+    handlerFor(*target)->queueAssets(*preloader);
+    preloader->start();
+    preloadTarget = *target;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <memory>
+#include "GameState.h"
+#include "GameStateHandler.h"
+#include "AssetLoader.h"
+
+using namespace sf;
+using namespace std;
+
+//=== STATE MACHINE CLASS DECLARATION ===
+// Owns one GameStateHandler per GameState and runs their lifecycle hooks on transitions
+// Residency policy:
+// - Only the active state (and the level a pre-level screen leads to) stays loaded;
+//   every other state is unloaded after a transition
+// - SETTINGS is an overlay: the state that opened it stays entered and loaded, and
+//   resumes where it left off when settings closes
+// - While a state with a preload target is shown (PRELEVELn), the target's assets decode
+//   on worker threads; entering the target then only takes cache hits
+class StateMachine {
+public:
+    StateMachine() = default;
+
+    StateMachine(const StateMachine&) = delete;
+    StateMachine& operator=(const StateMachine&) = delete;
+
+    //=== SETUP ===
+    void registerState(GameState id, unique_ptr<GameStateHandler> handler);
+
+    // Load and enter the initial state
+    void start(GameState initial, RenderWindow& window);
+
+    //=== FRAME HOOKS ===
+    // Uploads finished preloads, updates the active state and applies a requested transition
+    void update(RenderWindow& window, float deltaTime);
+
+    // Draws the active state
+    void draw(RenderWindow& window);
+
+    GameState getCurrent() const { return current; }
+
+    // The state the active one leads to (its preload target), if known in advance
+    optional<GameState> getUpcoming() const {
+        GameStateHandler* handler = handlerFor(current);
+        return handler ? handler->getPreloadTarget() : nullopt;
+    }
+
+private:
+    static constexpr size_t StateCount = static_cast<size_t>(EXIT) + 1;
+
+    array<unique_ptr<GameStateHandler>, StateCount> handlers;   // Indexed by GameState (EXIT has none)
+    array<bool, StateCount> loaded{};                           // load() has run without unload()
+    GameState current = LOADING;
+    GameState overlaidState = MENU;         // State paused underneath SETTINGS
+
+    unique_ptr<AssetLoader> preloader;      // Background decode for preloadTarget
+    GameState preloadTarget = EXIT;
+
+    void changeState(GameState next, RenderWindow& window);
+    void activate(GameState id, RenderWindow& window);
+    void unloadInactive();
+    void updatePreload();
+
+    GameStateHandler* handlerFor(GameState id) const { return handlers[static_cast<size_t>(id)].get(); }
+};
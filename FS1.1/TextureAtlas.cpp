@@ -0,0 +1,200 @@
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <iostream>
+
+using namespace sf;
+using namespace std;
+
+//=== SKYLINE PACKER ===
+// The page's filled area seen from above as a list of horizontal segments; a new rectangle
+// rests on the segments below it at the lowest possible position (bottom-left rule)
+class SkylinePacker {
+public:
+    SkylinePacker(int width, int height) : width(width), height(height) {
+        skyline.push_back({ 0, 0, width });
+    }
+
+    // Returns: false if the rectangle does not fit (position is left unchanged)
+    bool insert(int rectWidth, int rectHeight, Vector2i& position) {
+        int bestTop = height + 1;       // Lowest resulting top edge wins...
+        int bestWidth = width + 1;      // ...then the narrowest segment
+        size_t bestIndex = skyline.size();
+        int bestY = 0;
+        for (size_t i = 0; i < skyline.size(); ++i) {
+            int y;
+            if (!fits(i, rectWidth, rectHeight, y)) continue;
+            if (y + rectHeight < bestTop || (y + rectHeight == bestTop && skyline[i].width < bestWidth)) {
+                bestTop = y + rectHeight;
+                bestWidth = skyline[i].width;
+                bestIndex = i;
+                bestY = y;
+            }
+        }
+        if (bestIndex == skyline.size()) return false;
+
+        position = Vector2i(skyline[bestIndex].x, bestY);
+        place(bestIndex, position.x, bestY + rectHeight, rectWidth);
+        usedHeight = max(usedHeight, bestY + rectHeight);
+        return true;
+    }
+
+    int getUsedHeight() const { return usedHeight; }
+
+private:
+    struct Segment {
+        int x, y, width;
+    };
+
+    // Resting height of a rectangle whose left edge starts at segment index
+    bool fits(size_t index, int rectWidth, int rectHeight, int& y) const {
+        int x = skyline[index].x;
+        if (x + rectWidth > width) return false;
+        y = 0;
+        int remaining = rectWidth;
+        for (size_t i = index; remaining > 0; ++i) {
+            y = max(y, skyline[i].y);
+            if (y + rectHeight > height) return false;
+            remaining -= skyline[i].width;
+        }
+        return true;
+    }
+
+    // New segment on top of the rectangle; the segments it covers are cut back or removed
+    void place(size_t index, int x, int top, int rectWidth) {
+        skyline.insert(skyline.begin() + index, { x, top, rectWidth });
+        for (size_t i = index + 1; i < skyline.size();) {
+            int coveredTo = skyline[i - 1].x + skyline[i - 1].width;
+            if (skyline[i].x >= coveredTo) break;
+            int overlap = coveredTo - skyline[i].x;
+            skyline[i].x += overlap;
+            skyline[i].width -= overlap;
+            if (skyline[i].width > 0) break;
+            skyline.erase(skyline.begin() + i);
+        }
+        // Merge neighbours at the same height
+        for (size_t i = 0; i + 1 < skyline.size();) {
+            if (skyline[i].y == skyline[i + 1].y) {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + i + 1);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    int width;
+    int height;
+    int usedHeight = 0;
+    vector<Segment> skyline;            // Left to right, covering the page width exactly
+};
+
+//=== CONSTRUCTOR ===
+TextureAtlas::TextureAtlas(unsigned pageSize, unsigned padding) : pageSize(pageSize), padding(padding) {}
+
+//=== BUILDING ===
+
+AtlasPacking TextureAtlas::pack(const vector<AtlasImage>& images) const {
+    AtlasPacking packing;
+
+    //--- Pack (tallest first) ---
+    vector<const AtlasImage*> order;
+    for (const AtlasImage& image : images) {
+        if (image.image) order.push_back(&image);
+    }
+    sort(order.begin(), order.end(), [](const AtlasImage* a, const AtlasImage* b) {
+        return a->image->getSize().y > b->image->getSize().y;
+    });
+    int size = static_cast<int>(pageSize);
+    int border = static_cast<int>(padding);
+    vector<SkylinePacker> packers;
+    vector<Vector2i> positions;                     // Padded rectangle within the page, per placement
+    vector<const Image*> placed;
+    for (const AtlasImage* source : order) {
+        Vector2u imageSize = source->image->getSize();
+        int paddedWidth = static_cast<int>(imageSize.x) + 2 * border;
+        int paddedHeight = static_cast<int>(imageSize.y) + 2 * border;
+        if (paddedWidth > size || paddedHeight > size) {
+            packing.oversized.push_back(source->name);
+            continue;
+        }
+        Vector2i position;
+        size_t page = 0;
+        while (page < packers.size() && !packers[page].insert(paddedWidth, paddedHeight, position)) {
+            page++;
+        }
+        if (page == packers.size()) {
+            packers.emplace_back(size, size);
+            packers.back().insert(paddedWidth, paddedHeight, position);
+        }
+        packing.placements.push_back({ source->name, page, IntRect(position + Vector2i(border, border), Vector2i(imageSize)) });
+        positions.push_back(position);
+        placed.push_back(source->image);
+    }
+
+    //--- Compose pages (cropped to the used height) ---
+    packing.pages.resize(packers.size());
+    for (size_t i = 0; i < packers.size(); ++i) {
+        packing.pages[i].resize(Vector2u(pageSize, static_cast<unsigned>(packers[i].getUsedHeight())), Color::Transparent);
+    }
+    for (size_t p = 0; p < placed.size(); ++p) {
+        // Every padded pixel takes the nearest image pixel (edge extrusion)
+        const Image& image = *placed[p];
+        Image& page = packing.pages[packing.placements[p].page];
+        int imageWidth = static_cast<int>(image.getSize().x);
+        int imageHeight = static_cast<int>(image.getSize().y);
+        for (int y = -border; y < imageHeight + border; ++y) {
+            unsigned sourceY = static_cast<unsigned>(max(0, min(imageHeight - 1, y)));
+            for (int x = -border; x < imageWidth + border; ++x) {
+                unsigned sourceX = static_cast<unsigned>(max(0, min(imageWidth - 1, x)));
+                Vector2u target(static_cast<unsigned>(positions[p].x + border + x), static_cast<unsigned>(positions[p].y + border + y));
+                page.setPixel(target, image.getPixel(Vector2u(sourceX, sourceY)));
+            }
+        }
+    }
+    return packing;
+}
+
+vector<TextureHandle> TextureAtlas::upload(AtlasPacking& packing) {
+    for (const string& name : packing.oversized) {
+        cout << "Atlas: " << name << " is larger than a page, kept standalone" << endl;
+    }
+
+    vector<TextureHandle> pages;
+    vector<string> pageNames;
+    for (Image& image : packing.pages) {
+        pageNames.push_back("atlas/page" + to_string(nextPage++));
+        pages.push_back(resources.adoptTexture(pageNames.back(), image));
+        image = Image();  // Pixels now live on the GPU
+    }
+    for (const AtlasPacking::Placement& placement : packing.placements) {
+        regions[placement.name] = Region{ pageNames[placement.page], pages[placement.page], placement.rect };
+    }
+
+    cout << "Atlas: packed " << packing.placements.size() << " images into " << pages.size() << " pages" << endl;
+    return pages;
+}
+
+//=== LOOKUP ===
+
+bool TextureAtlas::acquire(const string& name, AtlasRegion& region, TextureHandle& handle) {
+    auto it = regions.find(name);
+    if (it != regions.end()) {
+        if (resources.isLoaded(it->second.page)) {
+            handle = resources.acquireTexture(it->second.pageName);  // Resident: only adds a reference
+            region.texture = &resources.get(handle);
+            region.rect = it->second.rect;
+            return true;
+        }
+        regions.erase(it);  // Page freed with the level that preloaded it
+    }
+
+    handle = resources.acquireTexture(name);
+    if (!handle.isValid()) {
+        region = AtlasRegion();
+        return false;
+    }
+    const Texture& texture = resources.get(handle);
+    region.texture = &texture;
+    region.rect = IntRect({ 0, 0 }, Vector2i(texture.getSize()));
+    return true;
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ResourceManager.h"
+
+using namespace sf;
+using namespace std;
+
+//=== ATLAS REGION ===
+// Where an image lives: a texture (atlas page or standalone) and its pixels within it
+struct AtlasRegion {
+    const Texture* texture = nullptr;
+    IntRect rect;                       // Image pixels (padding excluded)
+};
+
+//=== ATLAS PACKING ===
+// One decoded image handed to TextureAtlas::pack()
+struct AtlasImage {
+    string name;                        // Region name (the image path)
+    const Image* image = nullptr;
+};
+
+// CPU side of an atlas build: composed page pixels and where each image went
+struct AtlasPacking {
+    struct Placement {
+        string name;
+        size_t page = 0;                // Index into pages
+        IntRect rect;                   // Image pixels within the page (padding excluded)
+    };
+    vector<Image> pages;
+    vector<Placement> placements;
+    vector<string> oversized;           // Images larger than a page (left standalone)
+};
+
+//=== TEXTURE ATLAS CLASS DECLARATION ===
+// Packs small and medium game images into shared textures (pages), so sprites from
+// different images can be drawn with the same texture and batch together
+// - Skyline bottom-left packing, tallest images first; each page is cropped to its used height
+// - Every image is surrounded by padding filled with copies of its edge pixels, so
+//   filtering and rounding at region edges never pick up a neighbour's pixels
+// - Images that do not fit a page stay standalone textures (acquire() falls back to them)
+// Built in two steps by the AssetLoader that preloads a level (see addAtlasImage):
+// - pack() decodes nothing and touches no GPU state, so it runs on a loader worker
+// - upload() adopts the pages into the resource manager on the main thread
+// The atlas keeps no references of its own: pages live while the loader or a state holds
+// them (acquire() adds one), so a level's pages are freed with the level's other handles
+// Regions do not repeat: texture rects must stay inside the region (no setRepeated tiling)
+class TextureAtlas {
+public:
+    TextureAtlas(unsigned pageSize, unsigned padding);
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    //=== BUILDING ===
+    // Any thread: pack decoded images into page images (reads only the page settings)
+    AtlasPacking pack(const vector<AtlasImage>& images) const;
+
+    // Main thread: upload packed pages and register their regions
+    // Returns: one reference per page, owned by the caller (release them as usual)
+    vector<TextureHandle> upload(AtlasPacking& packing);
+
+    //=== LOOKUP (main thread) ===
+    // The image's region: from the atlas while its page is resident, otherwise the whole
+    // standalone texture. Either way handle receives one reference to the texture, which the
+    // caller releases as usual (the page stays resident until then)
+    // Returns: false if the image is in neither (region is left empty)
+    bool acquire(const string& name, AtlasRegion& region, TextureHandle& handle);
+
+private:
+    //=== REGION STRUCTURE ===
+    struct Region {
+        string pageName;                // Resource manager path of the page
+        TextureHandle page;             // Not a reference: only checks the page is resident
+        IntRect rect;
+    };
+
+    unsigned pageSize;
+    unsigned padding;
+    size_t nextPage = 0;                // Page names are never reused ("atlas/page<N>")
+    unordered_map<string, Region> regions;
+};
+
+//=== GLOBAL INSTANCE DECLARATION ===
+// Defined in: FS1.1.cpp (built by the level preloads)
+extern TextureAtlas textureAtlas;
@@ -0,0 +1,102 @@
+#include "TrafficBenchmark.h"
+#include "TrafficFlow.h"
+#include "BenchmarkTable.h"
+#include "Random.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+//=== SETUP ===
+
+static const int LANES = 32;
+static const float SPACING = 150.0f;            // Stress traffic spacing
+static const float ROAD_SPEED = 300.0f;
+static const float STEP = 1.0f / 60.0f;
+
+// Fixed seed: every flow of the same size starts with the same traffic
+static void fill(TrafficFlow& traffic, size_t vehicles, Pcg32& gen) {
+    TrafficFlowSetup setup;
+    setup.lanes = LANES;
+    setup.start = -500.0f;
+    setup.top = setup.start - static_cast<float>(vehicles) / LANES * SPACING;
+    setup.exit = 1180.0f;
+    setup.spacing = SPACING;
+    traffic.reset(setup, gen);
+}
+
+//=== TIMING ===
+
+// Microseconds per step (repeated for 0.2 seconds)
+static double timePerStep(TrafficFlow& traffic, Pcg32& gen) {
+    return timeRepeated([&]() { traffic.step(STEP, ROAD_SPEED, gen); }) * 1.0e6;
+}
+
+// Same traffic after 10 simulated seconds with and without workers (bit for bit)
+static bool compareWorkers(size_t vehicles, unsigned workers) {
+    TrafficFlow single, threaded;
+    Pcg32 singleGen(1234), threadedGen(1234);
+    fill(single, vehicles, singleGen);
+    fill(threaded, vehicles, threadedGen);
+    threaded.setWorkerCount(workers);
+    for (int frame = 0; frame < 600; ++frame) {
+        single.step(STEP, ROAD_SPEED, singleGen);
+        threaded.step(STEP, ROAD_SPEED, threadedGen);
+    }
+    return single.y == threaded.y && single.lane == threaded.lane && single.getLaneChanges() == threaded.getLaneChanges();
+}
+
+//=== BENCHMARK ===
+
+int runTrafficBenchmark() {
+    const size_t sizes[] = { 1000, 10000, 100000 };
+    unsigned maxWorkers = max(2u, thread::hardware_concurrency()) - 1;  // Every other hardware thread
+    vector<unsigned> workerCounts = { 0, 1, 3 };
+    if (maxWorkers > 3) workerCounts.push_back(maxWorkers);
+    bool agreed = true;
+
+    cout << "Traffic flow micro-benchmark (" << LANES << " lanes, up to " << maxWorkers << " workers)" << endl;
+    cout << "  vehicles   workers   step us   ns/vehicle   speedup   lane changes/s" << endl;
+
+    for (size_t count : sizes) {
+        double baseline = 0.0;
+        for (unsigned workers : workerCounts) {
+            if (workers > maxWorkers) continue;
+            Pcg32 gen(1234);
+            TrafficFlow traffic;
+            fill(traffic, count, gen);
+            traffic.setWorkerCount(workers);
+            for (int frame = 0; frame < 120; ++frame) {
+                traffic.step(STEP, ROAD_SPEED, gen);  // Let platoons and lane changes settle in
+            }
+            uint64_t changesBefore = traffic.getLaneChanges();
+            auto start = chrono::steady_clock::now();
+            double stepUs = timePerStep(traffic, gen);
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            double simulated = seconds * 1.0e6 / stepUs * STEP;
+            double changesPerSecond = (traffic.getLaneChanges() - changesBefore) / simulated;
+            if (workers == 0) baseline = stepUs;
+            double speedup = baseline / stepUs;
+
+            BenchmarkRow row("traffic_flow");
+            row.column("vehicles", traffic.size(), 10);
+            row.field("lanes", static_cast<size_t>(LANES));
+            row.column("workers", static_cast<size_t>(workers), 7);
+            row.column("step_us", stepUs, 7);
+            row.column("ns_per_vehicle", stepUs * 1000.0 / traffic.size(), 10);
+            row.column("speedup", speedup, 7);
+            row.column("lane_changes_per_second", changesPerSecond, 14, 0);
+            row.write();
+        }
+
+        if (!compareWorkers(count, maxWorkers)) {
+            cout << "  MISMATCH: " << count << " vehicles with " << maxWorkers << " workers differ from the main thread alone" << endl;
+            agreed = false;
+        }
+    }
+
+    return agreed ? 0 : 1;
+}
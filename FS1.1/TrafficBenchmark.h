@@ -0,0 +1,13 @@
+#pragma once
+
+using namespace std;
+
+//=== TRAFFIC FLOW MICRO-BENCHMARK ===
+// Times one TrafficFlow step (car following, lane changes, recycling) for several traffic sizes,
+// up to 100k vehicles on 32 lanes, with 0, 1, 3 and every other hardware thread as workers
+// The speedup over the main thread alone shows how the step scales with the core count; every
+// worker count must produce exactly the same traffic (checked after 10 simulated seconds)
+// Prints a table to the console and writes one "traffic_flow" record per size to the benchmark log
+// Run with --microbench; no window or audio is created
+// Returns: process exit code (non-zero if the worker counts disagree)
+int runTrafficBenchmark();
@@ -0,0 +1,286 @@
+#include "TrafficFlow.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+//=== SETUP ===
+
+void TrafficFlow::reset(const TrafficFlowSetup& newSetup, Pcg32& gen) {
+    setup = newSetup;
+    setup.lanes = max(1, setup.lanes);
+    float minSpacing = setup.vehicleLength + MIN_GAP;
+    uniform_real_distribution<float> spreadDist(0.5f, 1.5f);
+    uniform_real_distribution<float> speedDist(0.6f, 1.4f);
+    uniform_real_distribution<float> timerDist(0.0f, DECISION_INTERVAL);
+
+    // Reserve for the densest possible fill, so later resets of the same layout never allocate
+    size_t perLane = static_cast<size_t>(max(0.0f, setup.start - setup.top) / max(minSpacing, setup.spacing * 0.5f)) + 1;
+    size_t reserved = perLane * setup.lanes;
+    vector<float>* floats[] = { &y, &speed, &desiredSpeed, &acceleration, &moveY, &lanePosition, &decisionTimer };
+    for (vector<float>* component : floats) {
+        component->clear();
+        component->reserve(reserved);
+    }
+    lane.clear();
+    lane.reserve(reserved);
+    slot.clear();
+    slot.reserve(reserved);
+    lanes.resize(setup.lanes);
+    for (vector<uint32_t>& order : lanes) {
+        order.clear();
+        order.reserve(reserved);    // Lane changes may gather every vehicle in one lane
+    }
+    laneChanges = 0;
+
+    // Each lane from the start line back to the far end, at a random spacing around the average
+    for (int l = 0; l < setup.lanes; ++l) {
+        vector<uint32_t>& order = lanes[l];
+        for (float position = setup.start - setup.spacing * spreadDist(gen) * 0.5f; position > setup.top;
+             position -= max(minSpacing, setup.spacing * spreadDist(gen))) {
+            order.push_back(static_cast<uint32_t>(y.size()));
+            slot.push_back(static_cast<uint32_t>(order.size() - 1));
+            y.push_back(position);
+            desiredSpeed.push_back(setup.desiredSpeed * speedDist(gen));
+            speed.push_back(desiredSpeed.back());
+            acceleration.push_back(0.0f);
+            moveY.push_back(0.0f);
+            lanePosition.push_back(static_cast<float>(l));
+            lane.push_back(static_cast<uint16_t>(l));
+            decisionTimer.push_back(timerDist(gen));
+        }
+    }
+
+    requestDirection.assign(reserved, 0);
+    requestDirection.resize(size());
+    recycled.clear();
+    recycled.reserve(reserved);
+}
+
+size_t TrafficFlow::getFootprint() const {
+    size_t bytes = (y.capacity() + speed.capacity() + desiredSpeed.capacity() + acceleration.capacity() +
+                    moveY.capacity() + lanePosition.capacity() + decisionTimer.capacity()) * sizeof(float);
+    bytes += lane.capacity() * sizeof(uint16_t) + (slot.capacity() + recycled.capacity()) * sizeof(uint32_t) + requestDirection.capacity();
+    for (const vector<uint32_t>& order : lanes) {
+        bytes += order.capacity() * sizeof(uint32_t);
+    }
+    for (const vector<uint32_t>& requests : laneRequests) {
+        bytes += requests.capacity() * sizeof(uint32_t);
+    }
+    return bytes;
+}
+
+//=== CAR FOLLOWING (IDM) ===
+
+float TrafficFlow::freeAcceleration(size_t i) const {
+    float ratio = speed[i] / desiredSpeed[i];
+    return MAX_ACCEL * (1.0f - ratio * ratio * ratio * ratio);
+}
+
+float TrafficFlow::followAcceleration(size_t i, float leaderY, float leaderSpeed) const {
+    float gap = max(1.0f, leaderY - y[i] - setup.vehicleLength);
+    float v = speed[i];
+    float desiredGap = MIN_GAP + max(0.0f, v * HEADWAY + v * (v - leaderSpeed) / (2.0f * sqrt(MAX_ACCEL * COMFORT_DECEL)));
+    float interaction = desiredGap / gap;
+    return freeAcceleration(i) - MAX_ACCEL * interaction * interaction;
+}
+
+float TrafficFlow::laneAcceleration(size_t i) const {
+    uint32_t position = slot[i];
+    if (position == 0) return freeAcceleration(i);  // Front of the lane: open road
+    uint32_t leader = lanes[lane[i]][position - 1];
+    return followAcceleration(i, y[leader], speed[leader]);
+}
+
+//=== LANE CHANGES (MOBIL) ===
+
+size_t TrafficFlow::firstBehind(const vector<uint32_t>& order, float position) const {
+    return partition_point(order.begin(), order.end(), [&](uint32_t k) { return y[k] >= position; }) - order.begin();
+}
+
+int TrafficFlow::decideLane(size_t i) const {
+    if (fabs(lanePosition[i] - lane[i]) > 0.05f) return 0;  // Still moving over
+    // No lane beats the open road: unless the vehicle ahead holds it back, there is nothing to gain
+    float current = acceleration[i];
+    if (freeAcceleration(i) - current <= CHANGE_THRESHOLD) return 0;
+    float bestGain = CHANGE_THRESHOLD;
+    int best = 0;
+    for (int direction = -1; direction <= 1; direction += 2) {
+        int target = lane[i] + direction;
+        if (target < 0 || target >= getLaneCount()) continue;
+        const vector<uint32_t>& order = lanes[target];
+        size_t k = firstBehind(order, y[i]);
+
+        // Room to move over, and the acceleration behind the new leader
+        float ahead = freeAcceleration(i);
+        if (k > 0) {
+            uint32_t leader = order[k - 1];
+            if (y[leader] - y[i] - setup.vehicleLength < MIN_GAP) continue;
+            ahead = followAcceleration(i, y[leader], speed[leader]);
+        }
+
+        // The vehicle cut in front of must stay safe; its loss counts against the gain
+        float followerLoss = 0.0f;
+        if (k < order.size()) {
+            uint32_t follower = order[k];
+            if (y[i] - y[follower] - setup.vehicleLength < MIN_GAP) continue;
+            float followerAfter = followAcceleration(follower, y[i], speed[i]);
+            if (followerAfter < -SAFE_DECEL) continue;
+            followerLoss = laneAcceleration(follower) - followerAfter;
+        }
+
+        float gain = ahead - current - POLITENESS * max(0.0f, followerLoss);
+        if (gain > bestGain) {
+            bestGain = gain;
+            best = direction;
+        }
+    }
+    return best;
+}
+
+bool TrafficFlow::applyLaneChange(size_t i, int direction) {
+    vector<uint32_t>& to = lanes[lane[i] + direction];
+    size_t k = firstBehind(to, y[i]);
+    if (k > 0 && y[to[k - 1]] - y[i] - setup.vehicleLength < MIN_GAP) return false;
+    if (k < to.size()) {
+        uint32_t follower = to[k];
+        if (y[i] - y[follower] - setup.vehicleLength < MIN_GAP) return false;
+        if (followAcceleration(follower, y[i], speed[i]) < -SAFE_DECEL) return false;
+    }
+
+    // Earlier changes this step shifted the old lane by a few entries at most: search outwards
+    vector<uint32_t>& from = lanes[lane[i]];
+    size_t at = min<size_t>(slot[i], from.size() - 1);
+    for (size_t d = 0;; ++d) {
+        if (at + d < from.size() && from[at + d] == i) { at += d; break; }
+        if (d <= at && from[at - d] == i) { at -= d; break; }
+    }
+    from.erase(from.begin() + at);
+    to.insert(to.begin() + k, static_cast<uint32_t>(i));
+    lane[i] = static_cast<uint16_t>(lane[i] + direction);
+    decisionTimer[i] = DECISION_INTERVAL * 2.0f;  // Settle in before deciding again
+    return true;
+}
+
+//=== SIMULATION ===
+
+void TrafficFlow::step(float deltaTime, float roadSpeed, Pcg32& gen) {
+    if (y.empty()) return;
+    recycle(gen);
+
+    // Small traffic stays on this thread (same jobs, run in order)
+    bool parallel = jobs.getWorkerCount() > 0 && size() >= MIN_PARALLEL_VEHICLES;
+    auto runJobs = [&](size_t count, const auto& job) {
+        if (parallel) {
+            jobs.run(count, job);
+        } else {
+            for (size_t index = 0; index < count; ++index) job(index);
+        }
+    };
+    size_t chunks = parallel ? jobs.getThreadCount() : 1;
+    size_t chunkSize = (size() + chunks - 1) / chunks;
+    prepareRequests(chunks);
+
+    //--- Lane Order ---
+    runJobs(lanes.size(), [&](size_t l) { sortLane(lanes[l]); });
+
+    //--- Car Following and Lane Decisions ---
+    // Reads positions and speeds only: every chunk sees the same traffic
+    runJobs(chunks, [&](size_t chunk) {
+        size_t first = min(size(), chunk * chunkSize);
+        size_t last = min(size(), first + chunkSize);
+        vector<uint32_t>& requests = laneRequests[chunk];
+        for (size_t i = first; i < last; ++i) {
+            acceleration[i] = laneAcceleration(i);
+            requestDirection[i] = 0;
+            decisionTimer[i] -= deltaTime;
+            if (decisionTimer[i] > 0.0f) continue;
+            decisionTimer[i] += DECISION_INTERVAL;
+            int direction = decideLane(i);
+            if (direction != 0) {
+                requestDirection[i] = static_cast<int8_t>(direction);
+                requests.push_back(static_cast<uint32_t>(i));
+            }
+        }
+    });
+
+    //--- Integration ---
+    // Speed never goes negative (traffic does not reverse); the average speed over the step moves the car
+    runJobs(chunks, [&](size_t chunk) {
+        size_t first = min(size(), chunk * chunkSize);
+        size_t last = min(size(), first + chunkSize);
+        float sideways = LANE_CHANGE_RATE * deltaTime;
+        for (size_t i = first; i < last; ++i) {
+            float newSpeed = max(0.0f, speed[i] + acceleration[i] * deltaTime);
+            moveY[i] = (roadSpeed + (speed[i] + newSpeed) * 0.5f) * deltaTime;
+            y[i] += moveY[i];
+            speed[i] = newSpeed;
+            float target = static_cast<float>(lane[i]);
+            lanePosition[i] += max(-sideways, min(sideways, target - lanePosition[i]));
+        }
+    });
+
+    //--- Lane Changes ---
+    // In vehicle order (chunks are consecutive ranges), checked again against the moved traffic
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        for (uint32_t i : laneRequests[chunk]) {
+            if (applyLaneChange(i, requestDirection[i])) laneChanges++;
+        }
+    }
+}
+
+// Vehicles that passed the exit re-enter behind the last vehicle of their lane (or at the far
+// end if the lane thinned out) as a new car: new cruising speed, full speed
+void TrafficFlow::recycle(Pcg32& gen) {
+    float minSpacing = setup.vehicleLength + MIN_GAP;
+    uniform_real_distribution<float> spreadDist(0.5f, 1.5f);
+    recycled.clear();
+    for (vector<uint32_t>& order : lanes) {
+        while (order.size() > 1 && y[order.front()] >= setup.exit) {
+            uint32_t i = order.front();
+            rotate(order.begin(), order.begin() + 1, order.end());
+            float behind = y[order[order.size() - 2]] - max(minSpacing, setup.spacing * spreadDist(gen));
+            respawn(i, min(setup.top, behind), gen);
+        }
+        if (order.size() == 1 && y[order.front()] >= setup.exit) {
+            respawn(order.front(), setup.top, gen);
+        }
+    }
+}
+
+void TrafficFlow::respawn(uint32_t i, float newY, Pcg32& gen) {
+    uniform_real_distribution<float> speedDist(0.6f, 1.4f);
+    y[i] = newY;
+    desiredSpeed[i] = setup.desiredSpeed * speedDist(gen);
+    speed[i] = desiredSpeed[i];
+    moveY[i] = 0.0f;
+    lanePosition[i] = static_cast<float>(lane[i]);
+    recycled.push_back(i);
+}
+
+// Insertion sort, front (largest y) first: the order barely changes between steps
+void TrafficFlow::sortLane(vector<uint32_t>& order) {
+    for (size_t k = 1; k < order.size(); ++k) {
+        uint32_t vehicle = order[k];
+        size_t j = k;
+        for (; j > 0 && y[order[j - 1]] < y[vehicle]; --j) {
+            order[j] = order[j - 1];
+        }
+        order[j] = vehicle;
+    }
+    for (size_t k = 0; k < order.size(); ++k) {
+        slot[order[k]] = static_cast<uint32_t>(k);
+    }
+}
+
+// One request list per chunk, each large enough for the whole chunk (never grows while stepping)
+void TrafficFlow::prepareRequests(size_t chunks) {
+    size_t chunkSize = (y.capacity() + chunks - 1) / chunks;
+    if (laneRequests.size() != chunks) {
+        laneRequests.assign(chunks, vector<uint32_t>());
+    }
+    for (vector<uint32_t>& requests : laneRequests) {
+        requests.clear();
+        requests.reserve(chunkSize);
+    }
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "JobSystem.h"
+#include "Random.h"
+
+using namespace std;
+
+//=== TRAFFIC FLOW SETUP ===
+// Where the traffic lives, in screen y (traffic drives down the screen, towards larger y)
+struct TrafficFlowSetup {
+    int lanes = 4;
+    float top = -20000.0f;              // Far end of the simulated stretch (above the screen)
+    float start = -500.0f;              // Every vehicle starts above this line (a clear road ahead)
+    float exit = 1200.0f;               // Vehicles passing this line re-enter at the top
+    float spacing = 1200.0f;            // Average distance between vehicles in a lane
+    float vehicleLength = 40.0f;
+    float desiredSpeed = 200.0f;        // Average cruising speed (each vehicle varies +/-40%)
+};
+
+//=== TRAFFIC FLOW CLASS DECLARATION ===
+// Multi-lane traffic along a stretch of road much longer than the screen
+// - Car following: the Intelligent Driver Model (IDM). Each vehicle accelerates towards its own
+//   desired speed and brakes for the vehicle ahead in its lane, keeping a minimum gap plus a
+//   time headway; slow vehicles gather platoons behind them
+// - Lane changes: MOBIL. A vehicle moves to a neighbouring lane when that lane lets it accelerate
+//   more (minus a share of what it costs the vehicle it cuts in front of) and the new follower
+//   would not have to brake harder than SAFE_DECEL. Decided every DECISION_INTERVAL per vehicle
+// - Closed loop: a vehicle passing the exit re-enters at the far end of its lane, so the number
+//   of vehicles stays constant and nothing allocates after reset()
+// - Each lane keeps its vehicles sorted front (largest y) to back, so the vehicle ahead is the
+//   previous entry and a neighbouring lane is searched by bisection
+// step() runs in parallel chunks on the flow's JobSystem: sorting (one job per lane), car
+// following with lane change decisions, then integration (one job per chunk of vehicles).
+// Recycling and applying lane changes stay on the calling thread; they touch few vehicles
+// and are applied in vehicle order, so any worker count gives the same traffic
+// Speeds are along the road relative to its surface (pixels/second); the road's own scroll is
+// added when moving, so y stays in screen coordinates
+class TrafficFlow {
+public:
+    //=== TUNING ===
+    static constexpr float MIN_GAP = 20.0f;             // Bumper gap when stopped (pixels)
+    static constexpr float HEADWAY = 0.8f;              // Desired time gap to the vehicle ahead (seconds)
+    static constexpr float MAX_ACCEL = 120.0f;          // Pixels/second^2
+    static constexpr float COMFORT_DECEL = 200.0f;
+    static constexpr float SAFE_DECEL = 400.0f;         // Hardest braking a lane change may force
+    static constexpr float POLITENESS = 0.3f;           // Share of the new follower's loss counted
+    static constexpr float CHANGE_THRESHOLD = 15.0f;    // Gain needed to change lanes (pixels/second^2)
+    static constexpr float DECISION_INTERVAL = 0.5f;    // Seconds between a vehicle's lane decisions
+    static constexpr float LANE_CHANGE_RATE = 1.5f;     // Lanes per second moved sideways
+
+    TrafficFlow() = default;
+
+    TrafficFlow(const TrafficFlow&) = delete;
+    TrafficFlow& operator=(const TrafficFlow&) = delete;
+
+    //=== SETUP ===
+    // Fill every lane from setup.start up to setup.top; allocates only if the traffic grew
+    void reset(const TrafficFlowSetup& setup, Pcg32& gen);
+
+    //=== SIMULATION ===
+    // Advance every vehicle by deltaTime; roadSpeed scrolls the whole road down the screen
+    void step(float deltaTime, float roadSpeed, Pcg32& gen);
+
+    // Threads helping step() besides the calling thread (0 = calling thread only)
+    void setWorkerCount(unsigned count) { jobs.setWorkerCount(count); }
+    unsigned getWorkerCount() const { return jobs.getWorkerCount(); }
+
+    //=== QUERIES ===
+    size_t size() const { return y.size(); }
+    size_t capacity() const { return y.capacity(); }     // Most vehicles a reset of this layout can place
+    int getLaneCount() const { return static_cast<int>(lanes.size()); }
+    const TrafficFlowSetup& getSetup() const { return setup; }
+    uint64_t getLaneChanges() const { return laneChanges; }    // Since reset()
+    // Vehicles that passed the exit during the last step (now at the far end)
+    const vector<uint32_t>& getRecycled() const { return recycled; }
+    size_t getFootprint() const;        // Bytes reserved by every array
+
+    // Calls visit(index) for every vehicle with minY <= y < maxY (each lane front to back)
+    template <typename Visitor>
+    void forEachBetween(float minY, float maxY, Visitor visit) const {
+        for (const vector<uint32_t>& order : lanes) {
+            for (size_t k = firstBehind(order, maxY); k < order.size() && y[order[k]] >= minY; ++k) {
+                visit(static_cast<size_t>(order[k]));
+            }
+        }
+    }
+
+    //=== COMPONENT ARRAYS ===
+    // One element per vehicle, indices stable from reset() to reset(). Read only outside the flow
+    vector<float> y;                    // Center position (screen pixels)
+    vector<float> speed;                // Along the road, relative to it (pixels/second)
+    vector<float> desiredSpeed;
+    vector<float> acceleration;         // Car following result of the last step
+    vector<float> moveY;                // Screen displacement during the last step (road included)
+    vector<float> lanePosition;         // Sideways position in lanes (eases towards lane)
+    vector<uint16_t> lane;
+    vector<uint32_t> slot;              // Position in the lane order (valid during a step)
+    vector<float> decisionTimer;        // Seconds until the next lane decision
+
+private:
+    TrafficFlowSetup setup;
+    vector<vector<uint32_t>> lanes;     // Vehicle indices per lane, front (largest y) to back
+    vector<vector<uint32_t>> laneRequests;  // Lane change candidates per chunk (reused)
+    vector<int8_t> requestDirection;    // -1 / +1 lane wanted by a candidate
+    vector<uint32_t> recycled;
+    uint64_t laneChanges = 0;
+    JobSystem jobs;
+
+    static constexpr size_t MIN_PARALLEL_VEHICLES = 2048;  // Below this threads cost more than they save
+
+    // First entry of order whose vehicle is behind (y below) position
+    size_t firstBehind(const vector<uint32_t>& order, float position) const;
+    // IDM acceleration of vehicle i behind a vehicle at leaderY driving leaderSpeed
+    float followAcceleration(size_t i, float leaderY, float leaderSpeed) const;
+    float freeAcceleration(size_t i) const;
+    // Acceleration of vehicle i in its lane (slot must be current)
+    float laneAcceleration(size_t i) const;
+    // MOBIL: 0 to stay, or the lane offset (-1 / +1) vehicle i would gain most from
+    int decideLane(size_t i) const;
+    // Re-check a decided change against the moved traffic and apply it
+    bool applyLaneChange(size_t i, int direction);
+    void recycle(Pcg32& gen);
+    // Restart vehicle i at newY as a new car (new cruising speed, no carried motion)
+    void respawn(uint32_t i, float newY, Pcg32& gen);
+    void sortLane(vector<uint32_t>& order);
+    void prepareRequests(size_t chunks);
+};
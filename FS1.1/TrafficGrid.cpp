@@ -0,0 +1,41 @@
+#include "TrafficGrid.h"
+#include <cmath>
+
+using namespace std;
+
+//=== CONSTRUCTOR ===
+TrafficGrid::TrafficGrid(size_t capacity) {
+    nextInCell.reserve(capacity);
+    cellHeads.assign(1, -1);
+}
+
+//=== LAYOUT ===
+
+void TrafficGrid::configure(float gridLeft, float gridRight, float minLaneWidth, float gridTop, float gridBottom, float minBandHeight) {
+    left = gridLeft;
+    top = gridTop;
+    lanes = max(1, static_cast<int>(floor((gridRight - gridLeft) / minLaneWidth)));
+    bands = max(1, static_cast<int>(floor((gridBottom - gridTop) / minBandHeight)));
+    laneWidth = (gridRight - gridLeft) / lanes;
+    bandHeight = (gridBottom - gridTop) / bands;
+    cellHeads.assign(static_cast<size_t>(lanes) * bands, -1);
+}
+
+//=== CONTENTS ===
+
+void TrafficGrid::rebuild(const CarStore& cars) {
+    fill(cellHeads.begin(), cellHeads.end(), -1);
+    if (nextInCell.size() < cars.size()) {
+        nextInCell.resize(cars.capacity());  // Only when the store itself grew
+    }
+    maxHalfWidth = 0.0f;
+    maxHalfHeight = 0.0f;
+    for (size_t i = 0; i < cars.size(); ++i) {
+        if (cars.kind[i] != CarKind::Obstacle) continue;
+        int32_t& head = cellHeads[bandOf(cars.y[i]) * lanes + laneOf(cars.x[i])];
+        nextInCell[i] = head;
+        head = static_cast<int32_t>(i);
+        maxHalfWidth = max(maxHalfWidth, cars.halfWidth[i]);
+        maxHalfHeight = max(maxHalfHeight, cars.halfHeight[i]);
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "CarStore.h"
+
+using namespace std;
+
+//=== TRAFFIC GRID CLASS DECLARATION ===
+// Uniform-grid broadphase for Level 3 traffic, keyed by track lane (column) and y-band (row)
+// - Each obstacle is filed under the cell holding its center; cells are intrusive linked
+//   lists over dense car indices, so rebuilding allocates nothing
+// - A query visits only the cells overlapping a rectangle, so spawn validation and
+//   collision cost depend on local traffic, not on how many cars are on the road
+// - Positions outside the grid are clamped into the edge cells (spawn rows above the
+//   screen, cars leaving below it)
+// Dense indices change when cars despawn: rebuild() after every despawn pass
+class TrafficGrid {
+public:
+    explicit TrafficGrid(size_t capacity);
+
+    //=== LAYOUT ===
+    // Lanes split [left, right), bands split [top, bottom); cell sizes are rounded so
+    // the cells cover the area exactly
+    void configure(float left, float right, float laneWidth, float top, float bottom, float bandHeight);
+
+    //=== CONTENTS ===
+    void rebuild(const CarStore& cars);             // File every obstacle
+
+    // Largest obstacle hitbox half extents filed since the last rebuild
+    float getMaxHalfWidth() const { return maxHalfWidth; }
+    float getMaxHalfHeight() const { return maxHalfHeight; }
+
+    //=== QUERIES ===
+    // Calls visit(index) for every obstacle whose center lies in a cell overlapping the
+    // rectangle; visit returns false to stop early
+    // Returns: false if a visit stopped the query
+    template <typename Visitor>
+    bool forEachNear(float minX, float minY, float maxX, float maxY, Visitor visit) const {
+        int firstLane = laneOf(minX), lastLane = laneOf(maxX);
+        int firstBand = bandOf(minY), lastBand = bandOf(maxY);
+        for (int band = firstBand; band <= lastBand; ++band) {
+            for (int lane = firstLane; lane <= lastLane; ++lane) {
+                for (int32_t index = cellHeads[band * lanes + lane]; index >= 0; index = nextInCell[index]) {
+                    if (!visit(static_cast<size_t>(index))) return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    int getLaneCount() const { return lanes; }
+    int getBandCount() const { return bands; }
+
+private:
+    float left = 0.0f, top = 0.0f;
+    float laneWidth = 1.0f, bandHeight = 1.0f;
+    int lanes = 1, bands = 1;
+    float maxHalfWidth = 0.0f, maxHalfHeight = 0.0f;
+
+    vector<int32_t> cellHeads;          // First car index per cell (-1: empty)
+    vector<int32_t> nextInCell;         // Next car index in the same cell, per dense index
+
+    int laneOf(float x) const { return clamp(static_cast<int>((x - left) / laneWidth), 0, lanes - 1); }
+    int bandOf(float y) const { return clamp(static_cast<int>((y - top) / bandHeight), 0, bands - 1); }
+};
@@ -0,0 +1,174 @@
+#include "UiSoundMixer.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace sf;
+using namespace std;
+
+//=== CONSTRUCTOR / DESTRUCTOR ===
+UiSoundMixer::UiSoundMixer(unsigned int sampleRate)
+    : mixBuffer(ChunkFrames * 2), outputBuffer(ChunkFrames * 2) {
+    awaiting.reserve(started.capacity());
+    initialize(2, sampleRate, { SoundChannel::FrontLeft, SoundChannel::FrontRight });
+}
+
+// The mix thread reads the sounds: stop it before members are destroyed
+UiSoundMixer::~UiSoundMixer() {
+    stop();
+}
+
+//=== SOUND SETUP ===
+
+UiSoundMixer::SoundId UiSoundMixer::addSound(const SoundBuffer& buffer, size_t voiceCount) {
+    unsigned int channels = buffer.getChannelCount();
+    size_t sourceFrames = channels > 0 ? static_cast<size_t>(buffer.getSampleCount()) / channels : 0;
+    if (sourceFrames == 0 || voiceCount == 0) {
+        return InvalidId;
+    }
+
+    //=== CONVERSION TO OUTPUT FORMAT ===
+    // Stereo float at the stream rate, so the mix thread only adds samples
+    // (mono is copied to both sides; other rates are linearly resampled once, here)
+    const int16_t* source = buffer.getSamples();
+    double step = static_cast<double>(buffer.getSampleRate()) / getSampleRate();
+    size_t frames = static_cast<size_t>(ceil(sourceFrames / step));
+
+    Sound sound;
+    sound.samples.resize(frames * 2);
+    sound.frames = frames;
+    sound.voices.resize(voiceCount);
+
+    unsigned int right = channels > 1 ? 1 : 0;
+    for (size_t frame = 0; frame < frames; ++frame) {
+        double position = frame * step;
+        size_t index = min(static_cast<size_t>(position), sourceFrames - 1);
+        size_t nextIndex = min(index + 1, sourceFrames - 1);
+        float blend = static_cast<float>(position - index);
+        for (unsigned int side = 0; side < 2; ++side) {
+            unsigned int channel = side == 0 ? 0 : right;
+            float a = source[index * channels + channel] / 32768.0f;
+            float b = source[nextIndex * channels + channel] / 32768.0f;
+            sound.samples[frame * 2 + side] = a + (b - a) * blend;
+        }
+    }
+
+    sounds.push_back(move(sound));
+    return static_cast<SoundId>(sounds.size() - 1);
+}
+
+//=== PLAYBACK ===
+
+void UiSoundMixer::trigger(SoundId sound) {
+    if (sound < 0 || sound >= static_cast<SoundId>(sounds.size())) return;
+    triggers.push({ sound, chrono::steady_clock::now() });  // Dropped only if 64 are pending
+}
+
+//=== LATENCY MEASUREMENT ===
+// A voice counts as heard once the stream's playing offset has passed its first frame;
+// the latency is the time from its trigger to this call
+void UiSoundMixer::updateLatency() {
+    Started start;
+    while (awaiting.size() < started.capacity() && started.pop(start)) {
+        awaiting.push_back(start);
+    }
+    if (awaiting.empty()) return;
+
+    TimePoint now = chrono::steady_clock::now();
+    uint64_t played = static_cast<uint64_t>(getPlayingOffset().asMicroseconds()) * getSampleRate() / 1000000;
+    auto heard = [&](const Started& voice) {
+        if (voice.frame > played) return false;
+        float latency = static_cast<float>(chrono::duration<double, micro>(now - voice.time).count());
+        measuredCount++;
+        averageLatency += (latency - averageLatency) / measuredCount;
+        lastLatency = latency;
+        maxLatency = max(maxLatency, latency);
+        return true;
+    };
+    awaiting.erase(remove_if(awaiting.begin(), awaiting.end(), heard), awaiting.end());
+}
+
+float UiSoundMixer::getChunkMicroseconds() const {
+    return ChunkFrames * 1000000.0f / getSampleRate();
+}
+
+//=== TRIGGER SCHEDULING (mix thread) ===
+// A trigger issued t seconds before this chunk was requested starts (ChunkFrames - t * rate)
+// frames into it: every sound plays exactly one chunk after its trigger, wherever the
+// input fell between two callbacks (a trigger older than a chunk starts immediately)
+void UiSoundMixer::startVoice(const Trigger& trigger, TimePoint chunkTime) {
+    Sound& sound = sounds[trigger.sound];
+    unsigned int rate = getSampleRate();
+
+    double waited = max(0.0, chrono::duration<double>(chunkTime - trigger.time).count());
+    double offset = static_cast<double>(ChunkFrames) - waited * rate;
+    size_t startOffset = static_cast<size_t>(clamp(offset, 0.0, static_cast<double>(ChunkFrames - 1)));
+
+    //=== ROUND-ROBIN VOICE ===
+    Voice& voice = sound.voices[sound.nextVoice];
+    sound.nextVoice = (sound.nextVoice + 1) % sound.voices.size();
+    if (voice.active) {
+        stolenVoices.fetch_add(1);  // All voices busy: the oldest restarts
+    }
+    voice.active = true;
+    voice.position = 0;
+    voice.startOffset = startOffset;
+
+    // The main thread times the voice when playback reaches this frame (see updateLatency)
+    triggerCount.fetch_add(1);
+    started.push({ trigger.time, framesMixed + startOffset });  // Unmeasured if 64 are pending
+}
+
+//=== SOUNDSTREAM OVERRIDES ===
+
+bool UiSoundMixer::onGetData(Chunk& data) {
+    TimePoint chunkTime = chrono::steady_clock::now();
+    size_t playing = 0;
+    Trigger trigger;
+    while (triggers.pop(trigger)) {
+        startVoice(trigger, chunkTime);
+    }
+
+    //=== VOICE MIX ===
+    fill(mixBuffer.begin(), mixBuffer.end(), 0.0f);
+    for (Sound& sound : sounds) {
+        for (Voice& voice : sound.voices) {
+            if (!voice.active) continue;
+            playing++;
+
+            size_t frames = min(ChunkFrames - voice.startOffset, sound.frames - voice.position);
+            const float* source = &sound.samples[voice.position * 2];
+            float* target = &mixBuffer[voice.startOffset * 2];
+            for (size_t i = 0; i < frames * 2; ++i) {
+                target[i] += source[i];
+            }
+
+            voice.position += frames;
+            voice.startOffset = 0;
+            if (voice.position >= sound.frames) {
+                voice.active = false;
+            }
+        }
+    }
+
+    //=== OUTPUT CONVERSION ===
+    for (size_t i = 0; i < mixBuffer.size(); ++i) {
+        float sample = clamp(mixBuffer[i], -1.0f, 1.0f);
+        outputBuffer[i] = static_cast<int16_t>(sample * 32767.0f);
+    }
+
+    data.samples = outputBuffer.data();
+    data.sampleCount = outputBuffer.size();
+    framesMixed += ChunkFrames;
+
+    //=== COST MEASUREMENT ===
+    playingVoices.store(playing);
+    busyNanoseconds.fetch_add(static_cast<uint64_t>(
+        chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - chunkTime).count()));
+    return true;  // Never ends: silence keeps the source primed
+}
+
+// Interface sounds have no timeline to seek in; stop() rewinds the playing offset to zero,
+// so the frame count restarts with it
+void UiSoundMixer::onSeek(Time) {
+    framesMixed = 0;
+}
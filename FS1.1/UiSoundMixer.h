@@ -0,0 +1,116 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "SpscQueue.h"
+
+using namespace sf;
+using namespace std;
+
+//=== UI SOUND MIXER CLASS DECLARATION ===
+// Low-latency player for short interface sounds, played as a single always-running SoundStream
+// - The stream is started once and outputs silence between sounds, so a trigger never waits
+//   for a source to start, rewind or prime
+// - Each sound owns a small round-robin pool of voices: rapid triggers overlap instead of
+//   cutting each other off (the oldest voice is reused when all are busy)
+// - Triggers are timestamped on the main thread and scheduled sample-accurately: each one
+//   starts exactly one chunk after the moment it was issued, so latency does not jitter
+//   with where in the audio callback the key press happened
+// - Trigger-to-playback latency is measured per trigger: the mix thread reports the stream
+//   frame each voice starts at, and updateLatency() stamps the time the stream's playing
+//   offset reaches it (queued stream buffers included)
+class UiSoundMixer : public SoundStream {
+public:
+    using SoundId = int;
+    static constexpr int InvalidId = -1;
+
+    explicit UiSoundMixer(unsigned int sampleRate = 44100);
+    ~UiSoundMixer() override;
+
+    UiSoundMixer(const UiSoundMixer&) = delete;
+    UiSoundMixer& operator=(const UiSoundMixer&) = delete;
+
+    //=== SOUND SETUP (stream stopped) ===
+    // Copy a decoded sound into the mixer with the given number of voices
+    // Returns: InvalidId if the buffer is empty
+    SoundId addSound(const SoundBuffer& buffer, size_t voiceCount);
+
+    //=== PLAYBACK (main thread) ===
+    // Never blocks; the sound starts in the next audio chunk
+    void trigger(SoundId sound);
+
+    //=== LATENCY MEASUREMENT (main thread) ===
+    // Call once per frame: every started voice whose first frame the stream has played
+    // since the last call gets its latency (resolution: one frame plus the device period)
+    void updateLatency();
+
+    //=== LATENCY STATISTICS ===
+    // Time from trigger() until getPlayingOffset() passed the sound's first sample
+    size_t getTriggerCount() const { return triggerCount.load(); }
+    size_t getStolenVoiceCount() const { return stolenVoices.load(); }   // Restarted while still playing
+    size_t getMeasuredCount() const { return measuredCount; }            // Triggers with a latency
+    float getLastLatencyMicroseconds() const { return lastLatency; }
+    float getAverageLatencyMicroseconds() const { return averageLatency; }
+    float getMaxLatencyMicroseconds() const { return maxLatency; }
+    float getChunkMicroseconds() const;   // Scheduling delay (one chunk)
+    size_t getPlayingVoiceCount() const { return playingVoices.load(); }
+    uint64_t getBusyNanoseconds() const { return busyNanoseconds.load(); }  // Mix work, total
+
+private:
+    using TimePoint = chrono::steady_clock::time_point;
+
+    //=== TRIGGER STRUCTURE ===
+    struct Trigger {
+        SoundId sound = InvalidId;
+        TimePoint time;                 // When the input was handled
+    };
+
+    //=== STARTED VOICE STRUCTURE ===
+    struct Started {
+        TimePoint time;                 // When the trigger was handled
+        uint64_t frame = 0;             // Stream frame of the voice's first sample
+    };
+
+    //=== VOICE STRUCTURE (mix thread) ===
+    struct Voice {
+        bool active = false;
+        size_t position = 0;            // Next source frame
+        size_t startOffset = 0;         // First output frame of the chunk to write (start chunk only)
+    };
+
+    //=== SOUND STRUCTURE ===
+    struct Sound {
+        vector<float> samples;          // Interleaved stereo at the output rate
+        size_t frames = 0;
+        vector<Voice> voices;           // Round-robin pool
+        size_t nextVoice = 0;
+    };
+
+    static constexpr size_t ChunkFrames = 256;  // ~5.8 ms at 44.1 kHz: the scheduling delay
+
+    vector<Sound> sounds;               // Fixed once the stream plays
+    SpscQueue<Trigger, 64> triggers;    // Main thread -> mix thread
+    SpscQueue<Started, 64> started;     // Mix thread -> main thread
+    vector<Started> awaiting;           // Main thread: started, not yet played
+    uint64_t framesMixed = 0;           // Mix thread: frames handed to SFML since play()
+
+    vector<float> mixBuffer;            // Stereo float accumulator
+    vector<int16_t> outputBuffer;       // Converted chunk handed to SFML
+
+    atomic<size_t> triggerCount{ 0 };
+    atomic<size_t> stolenVoices{ 0 };
+    size_t measuredCount = 0;           // Latency statistics: main thread only
+    float lastLatency = 0.0f;
+    float averageLatency = 0.0f;
+    float maxLatency = 0.0f;
+    atomic<size_t> playingVoices{ 0 };
+    atomic<uint64_t> busyNanoseconds{ 0 };
+
+    void startVoice(const Trigger& trigger, TimePoint chunkTime);
+
+    //=== SOUNDSTREAM OVERRIDES ===
+    bool onGetData(Chunk& data) override;
+    void onSeek(Time timeOffset) override;
+};
@@ -0,0 +1,207 @@
+//=== ASSET PACKER ===
+// Build-time tool that packs all game assets into a single archive (see AssetArchiveFormat.h)
+// Usage: AssetPacker <asset root directory> <output archive>
+// Packs: everything under Images/ and Sounds/, plus font files (*.ttf) in the root
+// The archive is only rewritten when the file set, a file's size or a file's mtime changed since
+// the last pack (recorded per file in <output archive>.manifest next to the archive)
+
+#include "../../FS1.1/AssetArchiveFormat.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace AssetArchiveFormat;
+namespace fs = std::filesystem;
+
+//=== SOURCE FILE DESCRIPTION ===
+struct SourceFile {
+    fs::path path;          // Absolute path on disk
+    string name;            // Normalized archive key (e.g. "images/cars.png")
+};
+
+//=== SOURCE COLLECTION ===
+// Gathers every packable file below the asset root in deterministic (sorted) order
+static vector<SourceFile> collectSources(const fs::path& root) {
+    vector<SourceFile> sources;
+
+    // Asset directories are packed recursively
+    for (const char* directory : { "Images", "Sounds" }) {
+        fs::path dirPath = root / directory;
+        if (!fs::is_directory(dirPath)) {
+            continue;
+        }
+        for (const auto& item : fs::recursive_directory_iterator(dirPath)) {
+            if (item.is_regular_file()) {
+                string relative = fs::relative(item.path(), root).generic_string();
+                sources.push_back({ item.path(), normalizePath(relative) });
+            }
+        }
+    }
+
+    // Fonts live next to the executable's working directory
+    for (const auto& item : fs::directory_iterator(root)) {
+        if (item.is_regular_file() && normalizePath(item.path().extension().string()) == ".ttf") {
+            sources.push_back({ item.path(), normalizePath(item.path().filename().string()) });
+        }
+    }
+
+    sort(sources.begin(), sources.end(),
+        [](const SourceFile& a, const SourceFile& b) { return a.name < b.name; });
+    return sources;
+}
+
+//=== INCREMENTAL BUILD CHECK ===
+// One manifest line per packed file: name, size and mtime as they were when packed
+// Exact comparison catches replaced files, renames with the same count and mtimes that went
+// backwards (files restored from version control or a zip), which an "archive is newer" test misses
+static fs::path manifestPath(const fs::path& output) {
+    fs::path manifest = output;
+    manifest += ".manifest";
+    return manifest;
+}
+
+static string describeSources(const vector<SourceFile>& sources) {
+    string manifest;
+    for (const auto& source : sources) {
+        error_code ec;
+        uintmax_t size = fs::file_size(source.path, ec);
+        auto time = fs::last_write_time(source.path, ec);
+        manifest += source.name + '\t' + to_string(size) + '\t' + to_string(time.time_since_epoch().count()) + '\n';
+    }
+    return manifest;
+}
+
+// The archive is up to date when it is intact and its manifest lists exactly the current files
+static bool isUpToDate(const fs::path& output, const string& manifest) {
+    ifstream in(output, ios::binary);
+    ArchiveHeader header{};
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in || header.magic != Magic || header.version != Version) {
+        return false;
+    }
+
+    ifstream recorded(manifestPath(output), ios::binary);
+    if (!recorded) {
+        return false;  // Never packed by this version of the tool
+    }
+    string previous((istreambuf_iterator<char>(recorded)), istreambuf_iterator<char>());
+    return previous == manifest;
+}
+
+static uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+//=== ARCHIVE WRITER ===
+static bool writeArchive(const fs::path& output, const vector<SourceFile>& sources) {
+    //=== LAYOUT CALCULATION ===
+    // Header, index and name table first, then aligned data blobs
+    vector<ArchiveEntry> entries(sources.size());
+    string nameTable;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        entries[i].nameOffset = static_cast<uint32_t>(nameTable.size());
+        entries[i].nameLength = static_cast<uint32_t>(sources[i].name.size());
+        nameTable += sources[i].name;
+    }
+
+    ArchiveHeader header{};
+    header.magic = Magic;
+    header.version = Version;
+    header.entryCount = static_cast<uint32_t>(sources.size());
+    header.nameTableOffset = sizeof(ArchiveHeader) + entries.size() * sizeof(ArchiveEntry);
+    header.nameTableSize = nameTable.size();
+
+    uint64_t offset = header.nameTableOffset + header.nameTableSize;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        offset = alignUp(offset, DataAlignment);
+        entries[i].dataOffset = offset;
+        entries[i].dataSize = fs::file_size(sources[i].path);
+        offset += entries[i].dataSize;
+    }
+
+    //=== FILE OUTPUT ===
+    // Write to a temporary file and rename, so a failed pack never leaves a broken archive
+    fs::path temporary = output;
+    temporary += ".tmp";
+    ofstream out(temporary, ios::binary | ios::trunc);
+    if (!out) {
+        cerr << "AssetPacker: cannot write " << temporary.string() << endl;
+        return false;
+    }
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(ArchiveEntry));
+    out.write(nameTable.data(), nameTable.size());
+
+    vector<char> buffer;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        // Zero padding up to the aligned blob start
+        uint64_t position = static_cast<uint64_t>(out.tellp());
+        vector<char> padding(entries[i].dataOffset - position, 0);
+        out.write(padding.data(), padding.size());
+
+        ifstream in(sources[i].path, ios::binary);
+        buffer.resize(entries[i].dataSize);
+        in.read(buffer.data(), buffer.size());
+        if (!in) {
+            cerr << "AssetPacker: cannot read " << sources[i].path.string() << endl;
+            return false;
+        }
+        out.write(buffer.data(), buffer.size());
+    }
+
+    out.close();
+    if (!out) {
+        cerr << "AssetPacker: write failed for " << temporary.string() << endl;
+        return false;
+    }
+
+    error_code ec;
+    fs::rename(temporary, output, ec);
+    if (ec) {
+        cerr << "AssetPacker: cannot replace " << output.string() << ": " << ec.message() << endl;
+        return false;
+    }
+
+    cout << "AssetPacker: packed " << sources.size() << " assets (" << offset / 1024
+         << " KB) into " << output.string() << endl;
+    return true;
+}
+
+//=== ENTRY POINT ===
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        cerr << "Usage: AssetPacker <asset root directory> <output archive>" << endl;
+        return 1;
+    }
+
+    fs::path root = argv[1];
+    fs::path output = argv[2];
+
+    if (!fs::is_directory(root)) {
+        cerr << "AssetPacker: " << root.string() << " is not a directory" << endl;
+        return 1;
+    }
+
+    vector<SourceFile> sources = collectSources(root);
+    string manifest = describeSources(sources);
+    if (isUpToDate(output, manifest)) {
+        cout << "AssetPacker: " << output.string() << " is up to date" << endl;
+        return 0;
+    }
+
+    // Remove the old manifest first: a failed pack must not look up to date next time
+    error_code ec;
+    fs::remove(manifestPath(output), ec);
+    if (!writeArchive(output, sources)) {
+        return 1;
+    }
+    ofstream(manifestPath(output), ios::binary | ios::trunc) << manifest;
+    return 0;
+}